@@ -58,14 +58,21 @@ extern "C" {
 #define KSTRING_ENCODING_MASK     0xC000'0000  // 2-bit encoding mask
 #define KSTRING_ENCODING_SHIFT    30
 
+// Size field sentinel of large strings (the 64-bit size is stored in a header in front of the payload)
+#define KSTRING_LARGE_SIZE        0x3FFF'FFFE
+
     // Storage classes for long strings
     typedef enum
     {
-        KSTRING_PERSISTENT = 0, // Valid forever (literals, constants)
-        KSTRING_TRANSIENT  = 1, // Temporarily valid
-        KSTRING_TEMPORARY  = 2  // Needs cleanup
+        KSTRING_PERSISTENT  = 0, // Valid forever (literals, constants)
+        KSTRING_TRANSIENT   = 1, // Temporarily valid
+        KSTRING_TEMPORARY   = 2, // Needs cleanup
+        KSTRING_RELOCATABLE = 3  // Offset into a registered base region
     } KStringStorageClass;
 
+// Number of base regions available for relocatable strings (8-bit region id)
+#define KSTRING_MAX_REGIONS 256
+
 // KString structure - exactly 16 bytes
 // Use pragma pack to eliminate padding
 #pragma pack(push, 1)
@@ -84,7 +91,7 @@ extern "C" {
             struct
             {
                 char     Prefix[4];   // First 4 characters (4 bytes)
-                uint64_t PtrAndClass; // 62-bit pointer + 2-bit storage class (8 bytes)
+                uint64_t PtrAndClass; // 62-bit pointer (or region offset) + 2-bit storage class (8 bytes)
             } LongStr;
         };
     } KString;
@@ -103,11 +110,19 @@ extern "C" {
     KString KStringCreatePersistent(const char* pStr, const size_t Size);
     KString KStringCreateTransient(const char* pStr, const size_t Size);
 
+    // Create TRANSIENT view of bytes that are not null-terminated (e.g. a field inside a larger buffer)
+    // KStringCStr returns NULL for such long strings, read them with KStringData
+    KString KStringCreateTransientView(const char* pStr, const size_t Size);
+
     // Create KString with explicit encoding
     KString KStringCreateWithEncoding(const char* pStr, const size_t Size, const KStringEncoding Encoding);
     KString KStringCreatePersistentWithEncoding(const char* pStr, const size_t Size, const KStringEncoding Encoding);
     KString KStringCreateTransientWithEncoding(const char* pStr, const size_t Size, const KStringEncoding Encoding);
 
+    // Create relocatable KString from an offset into a registered base region
+    KString KStringCreateRelocatable(const uint8_t RegionId, const size_t Offset, const size_t Size);
+    KString KStringCreateRelocatableWithEncoding(const uint8_t RegionId, const size_t Offset, const size_t Size, const KStringEncoding Encoding);
+
     // Convenience functions for null-terminated strings (less secure, use with caution)
     KString KStringCreateFromCStr(const char* pStr);
     KString KStringCreatePersistentFromCStr(const char* pStr);
@@ -115,14 +130,101 @@ extern "C" {
     // Cleanup (only needed for temporary strings)
     void KStringDestroy(const KString Str);
 
+    //
+    // Arena Operations (bulk allocation, released at once)
+    //
+
+    // Opaque handle to a chunked bump allocator
+    typedef struct KStringArena KStringArena;
+
+    // Create arena with given chunk size (0 selects the default of 64KB)
+    KStringArena* KStringArenaCreate(const size_t ChunkSize);
+
+    // Allocate 8-byte aligned memory from the arena (not zero-initialized)
+    void* KStringArenaAlloc(KStringArena* pArena, const size_t Size);
+
+    // Copy string into the arena (returns TRANSIENT string valid until reset/destroy)
+    KString KStringArenaCreateString(KStringArena* pArena, const char* pStr, const size_t Size, const KStringEncoding Encoding);
+
+    // Release all arena allocations at once (strings created from the arena become invalid)
+    void KStringArenaReset(KStringArena* pArena);
+    void KStringArenaDestroy(KStringArena* pArena);
+
+    //
+    // Builder Operations (incremental construction with amortized growth)
+    //
+
+    // Builder state (caller-allocated, initialize with KStringBuilderInit)
+    typedef struct KStringBuilder
+    {
+        char*           pBuffer;  // Buffer (heap or arena)
+        size_t          Size;     // Bytes written
+        size_t          Capacity; // Usable capacity in bytes (excluding null terminator)
+        KStringEncoding Encoding; // Encoding of the result
+        KStringArena*   pArena;   // Optional arena backing (NULL: heap)
+        bool            Failed;   // Sticky error flag (allocation failure or size limit)
+    } KStringBuilder;
+
+    // Initialize empty builder (pArena may be NULL)
+    void KStringBuilderInit(KStringBuilder* pBuilder, const KStringEncoding Encoding, KStringArena* pArena);
+
+    // Make sure Capacity bytes fit without further growth
+    bool KStringBuilderReserve(KStringBuilder* pBuilder, const size_t Capacity);
+
+    // Append raw bytes, strings, integers and printf-style formatted text
+    bool KStringBuilderAppendBytes(KStringBuilder* pBuilder, const char* pData, const size_t Size);
+    bool KStringBuilderAppend(KStringBuilder* pBuilder, const KString Str);
+    bool KStringBuilderAppendInt(KStringBuilder* pBuilder, const int64_t Value);
+    bool KStringBuilderAppendUInt(KStringBuilder* pBuilder, const uint64_t Value);
+    bool KStringBuilderAppendFormat(KStringBuilder* pBuilder, const char* pFormat, ...);
+
+    // Hand the buffer over as TEMPORARY string (TRANSIENT when arena-backed, inline if short), builder is reset
+    // Invalid after a failed append or if the buffer cannot be tagged (the buffer is released then)
+    KString KStringBuilderFinish(KStringBuilder* pBuilder);
+
+    // Discard contents without creating a string
+    void KStringBuilderDestroy(KStringBuilder* pBuilder);
+
+    //
+    // Streaming Writer Operations (strings of any size, including large strings)
+    //
+
+    // Writer state (caller-allocated, initialize with KStringWriterBegin)
+    typedef struct KStringWriter
+    {
+        char*           pBlock;   // Heap block: space for the large-string header, then the payload
+        size_t          Size;     // Bytes written
+        size_t          Capacity; // Payload capacity in bytes (excluding null terminator)
+        KStringEncoding Encoding; // Encoding of the result
+        bool            Failed;   // Sticky error flag (allocation failure)
+    } KStringWriter;
+
+    // Start writing, optionally reserving SizeHint bytes up front
+    bool KStringWriterBegin(KStringWriter* pWriter, const KStringEncoding Encoding, const size_t SizeHint);
+
+    // Append a chunk (amortized O(1), payload is never copied into a second buffer)
+    bool KStringWriterWrite(KStringWriter* pWriter, const void* pData, const size_t Size);
+
+    // Hand the block over as TEMPORARY string (large beyond the 30-bit Size field, inline if short), writer is reset
+    // Invalid after a failed write or if the block cannot be tagged (the block is released then)
+    KString KStringWriterFinish(KStringWriter* pWriter);
+
+    // Discard contents without creating a string
+    void KStringWriterAbort(KStringWriter* pWriter);
+
     //
     // Access Operations
     //
 
     // Get C-string representation (may allocate for short strings)
+    // NULL for long views that end inside their source (substring views, split slices, file reader lines, CSV fields)
     const char* KStringCStr(const KString Str);
 
-    // Get size in bytes (always fast - O(1))
+    // Get payload pointer and size in bytes of any string, terminated or not (NULL and size 0 if unavailable)
+    // Short strings point into the handle itself, ropes are flattened once
+    const char* KStringData(const KString* pStr, size_t* pSize);
+
+    // Get size in bytes (always fast - O(1), large strings read their payload header)
     size_t KStringSize(const KString Str);
 
     // Get character encoding
@@ -131,6 +233,151 @@ extern "C" {
     // Check if string is stored inline
     bool KStringIsShort(const KString Str);
 
+    // Check if string is a view of memory it does not own (KStringDestroy is a no-op)
+    bool KStringIsBorrowed(const KString Str);
+
+    // Check if string is stored as an offset into a base region
+    bool KStringIsRelocatable(const KString Str);
+
+    // Check if string uses the large-string header (size beyond the 30-bit Size field)
+    bool KStringIsLarge(const KString Str);
+
+    // Check if string is stored as a rope (balanced chunk tree, flattened lazily by KStringCStr)
+    bool KStringIsRope(const KString Str);
+
+    // Get byte at Index (O(log n) for ropes, no flattening), -1 if out of range
+    int KStringByteAt(const KString Str, const size_t Index);
+
+    // Chunked reading: get the contiguous run starting at Offset without copying or flattening (NULL at the end)
+    // Takes a pointer because short strings hand out their inline content
+    const char* KStringGetChunk(const KString* pStr, const size_t Offset, size_t* pChunkSize);
+
+    // Copy up to Capacity bytes starting at Offset, returns bytes copied
+    size_t KStringCopyTo(const KString Str, const size_t Offset, char* pBuffer, const size_t Capacity);
+
+    //
+    // Base Region Registry (relocatable strings)
+    //
+
+    // Register the base address of a region in this process (shared memory, mmap'd file, buffer pool)
+    // Fails if the id is registered to a different base (unregister first to move a region), the same base updates the size
+    bool KStringRegisterRegion(const uint8_t RegionId, const void* pBase, const size_t Size);
+
+    // Remove a region; relocatable strings referring to it (or lying beyond a shrunk region) become unresolvable:
+    // operations on them fail (invalid results, false or 0) instead of reading through the missing base
+    void KStringUnregisterRegion(const uint8_t RegionId);
+
+    // Get the base address of a registered region (NULL if not registered)
+    const void* KStringGetRegionBase(const uint8_t RegionId);
+
+    // Get region id and offset of a long relocatable string without resolving it (false for other strings)
+    bool KStringGetRelocation(const KString Str, uint8_t* pRegionId, size_t* pOffset);
+
+    //
+    // Shared String Table (cross-process, zero-copy)
+    //
+
+// Shared table file layout identification
+#define KSTRING_SHARED_TABLE_MAGIC   0x5453'534B // "KSST" in little endian
+#define KSTRING_SHARED_TABLE_VERSION 1
+
+    // Shared table layout: header, KString entry array, string heap
+    // All long entries are RELOCATABLE strings with offsets relative to the start of the header
+    typedef struct KStringSharedTableHeader
+    {
+        uint32_t Magic;         // KSTRING_SHARED_TABLE_MAGIC
+        uint32_t Version;       // KSTRING_SHARED_TABLE_VERSION
+        uint64_t Count;         // Number of KString entries
+        uint64_t EntriesOffset; // Offset of the KString entry array (16-byte aligned)
+        uint64_t HeapOffset;    // Offset of the string heap
+        uint64_t HeapSize;      // Size of the string heap in bytes
+        uint64_t TotalSize;     // Size of the whole region in bytes
+        uint8_t  RegionId;      // Region id used by the relocatable entries
+        uint8_t  Reserved[15];  // Zero
+    } KStringSharedTableHeader;
+
+    _Static_assert(sizeof(KStringSharedTableHeader) == 64, "KStringSharedTableHeader must be exactly 64 bytes");
+
+    // Opaque handle to a mapped shared table
+    typedef struct KStringSharedTable KStringSharedTable;
+
+    // Build a table into a new POSIX shared memory object (NULL name: anonymous memfd, share via the descriptor)
+    // Create and Attach fail if RegionId is already registered in this process (one table per region id)
+    KStringSharedTable* KStringSharedTableCreate(const char* pName, const uint8_t RegionId, const KString* pStrings, const size_t Count);
+
+    // Attach read-only to an existing table by name or inherited descriptor
+    // Header and entries are validated first: entries must be short or RELOCATABLE into the table's own heap
+    KStringSharedTable* KStringSharedTableAttach(const char* pName);
+    KStringSharedTable* KStringSharedTableAttachFd(const int Fd);
+
+    // Unmap the table and unregister its region
+    void KStringSharedTableClose(KStringSharedTable* pTable);
+
+    // Remove a named shared memory object (mapped tables stay valid)
+    bool KStringSharedTableUnlink(const char* pName);
+
+    // Access entries (views into the mapping, never destroy them)
+    size_t         KStringSharedTableCount(const KStringSharedTable* pTable);
+    KString        KStringSharedTableGet(const KStringSharedTable* pTable, const size_t Index);
+    const KString* KStringSharedTableEntries(const KStringSharedTable* pTable);
+
+    // Get the descriptor backing the table (for passing to other processes)
+    int KStringSharedTableGetFd(const KStringSharedTable* pTable);
+
+    //
+    // File Reader (zero-copy line/record iteration)
+    //
+
+    // Opaque handle to a memory-mapped input file
+    typedef struct KStringFileReader KStringFileReader;
+
+    // Map a file for sequential reading (NULL on failure)
+    KStringFileReader* KStringFileReaderOpen(const char* pPath);
+
+    // Unmap the file; all records handed out become invalid
+    void KStringFileReaderClose(KStringFileReader* pReader);
+
+    // Get next line without line terminator (LF or CRLF) as TRANSIENT view into the mapping
+    // False at end of file, or before a line beyond the regular size limit (position stays at its start):
+    // KStringFileReaderIsEof tells the two apart
+    bool KStringFileReaderNextLine(KStringFileReader* pReader, KString* pLine);
+
+    // Get next record terminated by Delimiter as TRANSIENT view into the mapping (same failure rules)
+    bool KStringFileReaderNextRecord(KStringFileReader* pReader, const char Delimiter, KString* pRecord);
+
+    // Check if the whole file has been read (true for NULL); false after a failed NextLine/NextRecord means
+    // the next line or record is beyond the regular size limit
+    bool KStringFileReaderIsEof(const KStringFileReader* pReader);
+
+    // Restart iteration at the beginning of the file
+    void KStringFileReaderRewind(KStringFileReader* pReader);
+
+    // Get file size and current read offset in bytes
+    size_t KStringFileReaderSize(const KStringFileReader* pReader);
+    size_t KStringFileReaderPosition(const KStringFileReader* pReader);
+
+    //
+    // CSV/TSV Parser (column-oriented, zero-copy)
+    //
+
+    // Opaque handle to a parsed delimiter-separated table
+    typedef struct KStringCsvTable KStringCsvTable;
+
+    // Parse delimiter-separated data into columns (input must outlive the table)
+    // Plain and quoted fields are unterminated TRANSIENT views into the input (see KStringData), fields with escaped quotes are unescaped into the table's arena
+    KStringCsvTable* KStringCsvParse(const char* pData, const size_t Size, const char Delimiter, const char Quote);
+
+    // Release table, column arrays and unescaped fields
+    void KStringCsvDestroy(KStringCsvTable* pTable);
+
+    // Table dimensions (rows shorter than the widest row are padded with empty strings)
+    size_t KStringCsvRowCount(const KStringCsvTable* pTable);
+    size_t KStringCsvColumnCount(const KStringCsvTable* pTable);
+
+    // Access a whole column (RowCount entries) or a single field
+    const KString* KStringCsvColumn(const KStringCsvTable* pTable, const size_t Column);
+    KString        KStringCsvGet(const KStringCsvTable* pTable, const size_t Row, const size_t Column);
+
     //
     // Comparison Operations (optimized with prefix)
     //
@@ -144,26 +391,100 @@ extern "C" {
     // Check if string starts with prefix
     bool KStringStartsWith(const KString Str, const KString Prefix);
 
-    // Case-insensitive comparison operations
+    // Case-insensitive comparison operations (Unicode simple case folding, any mix of encodings)
+    // Compare orders by length in code points first, then by folded code points
     int  KStringCompareIgnoreCase(const KString StrA, const KString StrB);
     bool KStringEqualsIgnoreCase(const KString StrA, const KString StrB);
     bool KStringStartsWithIgnoreCase(const KString Str, const KString Prefix);
 
+    // Compare by code points across encodings without converting (-1, 0, 1, lexicographic)
+    // Invalid sequences compare as U+FFFD, invalid strings order before valid ones
+    int  KStringCompareCodepoints(const KString StrA, const KString StrB);
+    bool KStringEqualsCodepoints(const KString StrA, const KString StrB);
+
     //
     // String Operations (create new strings)
     //
 
-    // Concatenate two strings
+    // Concatenate two strings (raw bytes, encoding of StrA; see KStringConcatWithEncoding for mixed encodings)
     KString KStringConcat(const KString StrA, const KString StrB);
 
+    // Concatenate or join N strings with a single allocation (none if the result is short)
+    KString KStringConcatN(const KString* pParts, const size_t Count);
+    KString KStringJoin(const KString* pParts, const size_t Count, const KString Separator);
+
+    // Concatenate into a rope (O(log n), chunks are shared; PERSISTENT payloads are referenced, others copied)
+    // KStringConcat and KStringSubstring keep rope inputs as ropes, KStringDestroy releases them
+    KString KStringRopeConcat(const KString StrA, const KString StrB);
+
     // Extract substring
     KString KStringSubstring(const KString Str, const size_t Offset, const size_t Size);
 
+    // Extract substring without copying (borrowed view into the parent payload, must not outlive Str)
+    KString KStringSubstringView(const KString Str, const size_t Offset, const size_t Size);
+
+    //
+    // Split Operations (zero-copy slices of the source)
+    //
+
+    // Slices of up to 12 bytes are inline, longer slices are views into the source payload
+    // Views never need KStringDestroy and must not outlive the source string
+
+    // Callback invoked for each slice (return false to stop splitting)
+    typedef bool (*KStringSplitCallback)(const KString Slice, void* pContext);
+
+    // Split iterator state (caller-allocated)
+    typedef struct KStringSplitIterator
+    {
+        KString Source;    // String being split
+        KString Delimiter; // Delimiter (empty: whole string is one slice)
+        size_t  Position;  // Offset of the next slice
+        bool    Done;      // No slices left
+    } KStringSplitIterator;
+
+    // Iterator form
+    void KStringSplitBegin(KStringSplitIterator* pIterator, const KString Str, const KString Delimiter);
+    bool KStringSplitNext(KStringSplitIterator* pIterator, KString* pSlice);
+
+    // Callback form (returns number of slices visited)
+    size_t KStringSplit(const KString Str, const KString Delimiter, const KStringSplitCallback Callback, void* pContext);
+
+    // Out-array form (stores up to Capacity slices, returns total number of slices)
+    size_t KStringSplitInto(const KString Str, const KString Delimiter, KString* pSlices, const size_t Capacity);
+
+    //
+    // Validation Operations
+    //
+
+    // Validate UTF-8 (rejects overlongs, surrogates and code points beyond U+10FFFF)
+    // The result is recorded in long strings, so revalidation, conversions and case operations skip the scan
+    bool KStringValidateUtf8(KString* pStr);
+
+    // Check if string is known to be valid UTF-8 (validated long strings, short strings are checked on the fly)
+    bool KStringIsValidatedUtf8(const KString Str);
+
+    // Create validated UTF-8 string (invalid input yields an invalid KString without allocating)
+    KString KStringCreateValidated(const char* pStr, const size_t Size);
+    KString KStringCreateTransientValidated(const char* pStr, const size_t Size);
+
+    // Detect the encoding of raw text: a byte order mark decides, else NUL bytes on one side of 16-bit units mean UTF-16 LE/BE,
+    // valid UTF-8 means UTF-8 and anything else is taken as ANSI (UTF-16 without BOM and without ASCII characters is not recognized)
+    // *pBomSize (may be NULL) receives the size of the byte order mark (0 if none)
+    KStringEncoding KStringDetectEncoding(const char* pStr, const size_t Size, size_t* pBomSize);
+
+    // Create string with the detected encoding, the BOM is not part of the string
+    // Transient strings are views past the BOM without copying, detected UTF-8 is recorded as validated
+    KString KStringCreateDetectEncoding(const char* pStr, const size_t Size);
+    KString KStringCreatePersistentDetectEncoding(const char* pStr, const size_t Size);
+    KString KStringCreateTransientDetectEncoding(const char* pStr, const size_t Size);
+
     //
     // Encoding Conversion Operations
     //
 
     // Convert string to different encoding (creates new string)
+    // Conversions, their size queries, code point counts and the transcoder read a trailing odd UTF-16 byte as U+FFFD,
+    // so "A\0B\0C" as UTF-16LE becomes "AB\uFFFD" in every target (same-encoding copies included)
     KString KStringConvertToEncoding(const KString Str, const KStringEncoding TargetEncoding);
 
     // UTF-8 <-> UTF-16LE conversion
@@ -178,10 +499,118 @@ extern "C" {
     KString KStringConvertUtf16LeToUtf16Be(const KString Str);
     KString KStringConvertUtf16BeToUtf16Le(const KString Str);
 
+    // Swap UTF-16LE <-> UTF-16BE in place (inline or TEMPORARY strings the caller exclusively owns)
+    // Returns false for other storage classes, ropes, non-UTF-16 strings and odd sizes (the U+FFFD would not fit in place)
+    bool KStringSwapUtf16InPlace(KString* pStr);
+
     // UTF-8 <-> ANSI conversion (Windows-1252)
     KString KStringConvertUtf8ToAnsi(const KString Str);
     KString KStringConvertAnsiToUtf8(const KString Str);
 
+    // Exact size in bytes of KStringConvertToEncoding(Str, TargetEncoding) (0 for invalid or unresolvable strings)
+    size_t KStringConvertedSize(const KString Str, const KStringEncoding TargetEncoding);
+
+    // Convert into a caller-owned buffer without allocating
+    // Returns false if the buffer is too small, *pWritten then holds the required size
+    bool KStringConvertInto(const KString Str, const KStringEncoding TargetEncoding, void* pBuffer, const size_t Capacity, size_t* pWritten);
+
+    // Convert Count strings at once: results of up to 12 bytes stay inline, all others share one arena allocation
+    // Invalid inputs (or inputs whose validated flag no longer matches their bytes) yield invalid results, pInput and pOutput must not overlap (false on invalid arguments or out of memory)
+    bool KStringConvertBatch(const KString* pInput, const size_t Count, const KStringEncoding TargetEncoding, KStringArena* pArena, KString* pOutput);
+
+    // Concatenate strings of different encodings: operands not in TargetEncoding are transcoded
+    // straight into the result (KStringConcat joins raw bytes and keeps the encoding of StrA)
+    KString KStringConcatWithEncoding(const KString StrA, const KString StrB, const KStringEncoding TargetEncoding);
+
+    //
+    // Code Point Operations (character semantics for SQL LENGTH/SUBSTRING)
+    //
+
+    // Number of code points (invalid sequences count as one U+FFFD each, 0 for invalid strings)
+    size_t KStringCodepointCount(const KString Str);
+
+    // Sparse index of a string: byte offset of every 64th code point (caller-owned, heap-allocated table)
+    // The index refers to the string it was built for and must be rebuilt or destroyed when that string goes away
+    typedef struct KStringCodepointIndex
+    {
+        KString Str;             // Indexed string (not owned)
+        size_t  CodepointCount;  // Code points in Str
+        size_t  CheckpointCount; // Entries in pOffsets
+        size_t* pOffsets;        // Byte offset of code point 64 * i
+    } KStringCodepointIndex;
+
+    // Initialize an empty index, build it for a string (no-op if already built for it), release its table
+    void KStringCodepointIndexInit(KStringCodepointIndex* pIndex);
+    bool KStringCodepointIndexBuild(KStringCodepointIndex* pIndex, const KString Str);
+    void KStringCodepointIndexDestroy(KStringCodepointIndex* pIndex);
+
+    // Substring by code points (Count is clamped to the end, invalid if Offset is beyond the last code point)
+    // With pIndex (may be NULL) long strings are indexed on first use: each call then decodes at most 64 code points to reach Offset
+    KString KStringSubstringCodepoints(const KString Str, const size_t Offset, const size_t Count, KStringCodepointIndex* pIndex);
+
+    //
+    // Case Conversion Operations (SQL LOWER/UPPER)
+    //
+
+    // Simple Unicode case mapping into a new string of the same encoding (invalid sequences are kept)
+    // One code point maps to one code point: U+00DF stays U+00DF, UTF-8 sizes may change (e.g. U+0131 to 'I')
+    KString KStringToLower(const KString Str);
+    KString KStringToUpper(const KString Str);
+
+    // Only 'A'..'Z' and 'a'..'z' change (locale-independent identifiers), the size never changes
+    KString KStringToLowerAscii(const KString Str);
+    KString KStringToUpperAscii(const KString Str);
+
+    // Case mapping without allocation for inline strings and TEMPORARY strings (not ropes)
+    // Returns false and leaves the string unchanged for other storage classes or if a UTF-8 size would change
+    bool KStringToLowerInPlace(KString* pStr, const bool AsciiOnly);
+    bool KStringToUpperInPlace(KString* pStr, const bool AsciiOnly);
+
+    //
+    // Normalization Operations (Unicode canonical equivalence, UAX #15)
+    //
+
+    // Normalization forms
+    typedef enum
+    {
+        KSTRING_NORMALIZATION_NFC = 0, // Canonical composition (precomposed characters, e.g. Windows/Linux input)
+        KSTRING_NORMALIZATION_NFD = 1  // Canonical decomposition (base character + combining marks, e.g. macOS file names)
+    } KStringNormalizationForm;
+
+    // Check if a string is normalized (quick check scan, full normalization only for characters that may combine)
+    bool KStringIsNormalized(const KString Str, const KStringNormalizationForm Form);
+
+    // Normalize in the string's own encoding, invalid sequences are kept
+    // Normalized input yields a borrowed view of Str without allocating (must not outlive Str), other input a new string
+    // ANSI strings that would need combining characters in NFD yield an invalid string (Windows-1252 has none)
+    KString KStringNormalizeNFC(const KString Str);
+    KString KStringNormalizeNFD(const KString Str);
+
+    //
+    // Streaming Transcoder (chunked input, caller-provided output buffers)
+    //
+
+    // Transcoder state (caller-allocated, initialize with KStringTranscoderInit)
+    typedef struct KStringTranscoder
+    {
+        KStringEncoding SourceEncoding; // Encoding of the input chunks
+        KStringEncoding TargetEncoding; // Encoding of the output
+        uint8_t         Pending[4];     // Incomplete sequence carried over from the previous chunk
+        uint8_t         PendingSize;    // Bytes in Pending
+    } KStringTranscoder;
+
+    // Start a new stream
+    void KStringTranscoderInit(KStringTranscoder* pTranscoder, const KStringEncoding SourceEncoding, const KStringEncoding TargetEncoding);
+
+    // Transcode as much input as fits into the output buffer (chunks may split sequences anywhere)
+    // Call again with the unconsumed input once the output has been drained, invalid input becomes U+FFFD
+    // OutputCapacity must hold one encoded code point (4 bytes for every target): false if no progress is possible
+    bool KStringTranscoderProcess(KStringTranscoder* pTranscoder, const void* pInput, const size_t InputSize, size_t* pInputConsumed, void* pOutput,
+                                  const size_t OutputCapacity, size_t* pOutputWritten);
+
+    // End the stream: a sequence left incomplete by the last chunk becomes U+FFFD (false if it does not fit)
+    bool KStringTranscoderFinish(KStringTranscoder* pTranscoder, void* pOutput, const size_t OutputCapacity, size_t* pOutputWritten);
+
     //
     // Error Handling
     //
@@ -25,8 +25,13 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "KString.h"
+#include "KStringSimd.h"
+#include "KStringUnicodeData.h"
 #include <assert.h>
+#include <stdarg.h>
+#include <stdatomic.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -40,6 +45,26 @@
 #define KSTRING_CLASS_MASK   0xC000'0000'0000'0000ULL  // 2-bit storage class mask
 #define KSTRING_CLASS_SHIFT  62
 
+// Relocatable strings: 8-bit region id + 48-bit offset inside the 62-bit pointer field
+#define KSTRING_OFFSET_MASK   0x0000'FFFF'FFFF'FFFFULL // 48-bit offset mask (max 256TB per region)
+#define KSTRING_REGION_MASK   0x00FF'0000'0000'0000ULL // 8-bit region id mask
+#define KSTRING_REGION_SHIFT  48
+
+// Validated UTF-8 flag of long strings (bit 61 is above every user-space address and relocatable region id)
+#define KSTRING_UTF8_VALID_FLAG 0x2000'0000'0000'0000ULL
+
+// Unterminated view flag of long strings: the payload is not followed by a null terminator (bit 60, also above every address)
+#define KSTRING_VIEW_FLAG 0x1000'0000'0000'0000ULL
+
+// Pointer or region/offset bits without flags
+#define KSTRING_ADDRESS_MASK (KSTRING_PTR_MASK & ~(KSTRING_UTF8_VALID_FLAG | KSTRING_VIEW_FLAG))
+
+// Rope strings: TEMPORARY storage class with lowest pointer bit set (nodes are at least 8-byte aligned)
+#define KSTRING_ROPE_TAG 0x1ULL
+
+// Largest size that fits the Size field (larger strings use the large-string header)
+#define KSTRING_MAX_REGULAR_SIZE (KSTRING_LARGE_SIZE - 1)
+
 // Invalid length marker for error handling
 #define KSTRING_INVALID_LENGTH UINT32_MAX
 
@@ -77,6 +102,48 @@ inline static void KS_Release(void** ppPtr)
     }
 }
 
+// Resize memory allocated with KS_Alloc (private function)
+// Rounds up Size to next 8-byte boundary, new bytes are not initialized
+inline static void* KS_Realloc(void* pPtr, size_t Size)
+{
+    if (0 == Size || Size > SIZE_MAX - KSTRING_ALIGNMENT)
+    {
+        return NULL;
+    }
+
+    size_t AlignedSize = (Size + KSTRING_ALIGNMENT - 1) & ~(KSTRING_ALIGNMENT - 1);
+    return realloc(pPtr, AlignedSize);
+}
+
+//
+// Private Region Registry
+//
+
+// Base region for relocatable strings
+typedef struct KS_Region
+{
+    const char* pBase; // Base address in this process (NULL if not registered)
+    size_t      Size;  // Size of the region in bytes
+} KS_Region;
+
+// Process-wide region table, indexed by region id
+// Registration is not synchronized: register regions before strings referring to them are used
+static KS_Region KS_Regions[KSTRING_MAX_REGIONS];
+
+// Resolve region id + offset of a Size byte payload to an address in this process
+// NULL if the region is not registered (anymore) or the payload does not lie inside it
+inline static void* KS_ResolveOffset(uint64_t PtrAndClass, size_t Size)
+{
+    const KS_Region* pRegion = &KS_Regions[(PtrAndClass & KSTRING_REGION_MASK) >> KSTRING_REGION_SHIFT];
+    size_t           Offset  = (size_t)(PtrAndClass & KSTRING_OFFSET_MASK);
+    if (NULL == pRegion->pBase || Offset > pRegion->Size || Size > pRegion->Size - Offset)
+    {
+        return NULL;
+    }
+
+    return (void*)(pRegion->pBase + Offset);
+}
+
 //
 // Private Helper Functions
 //
@@ -93,10 +160,39 @@ inline static KStringStorageClass KS_GetStorageClass(uint64_t PtrAndClass)
     return (KStringStorageClass)((PtrAndClass & KSTRING_CLASS_MASK) >> KSTRING_CLASS_SHIFT);
 }
 
+// Rope node (defined with the rope operations)
+typedef struct KS_RopeNode KS_RopeNode;
+
+// Flatten rope into a cached contiguous buffer (defined with the rope operations)
+static const char* KS_RopeFlatten(KS_RopeNode* pNode);
+
+// Check if tagged pointer refers to a rope node
+inline static bool KS_IsRope(uint64_t PtrAndClass)
+{
+    return KSTRING_TEMPORARY == KS_GetStorageClass(PtrAndClass) && 0 != (PtrAndClass & KSTRING_ROPE_TAG);
+}
+
+// Extract rope node from tagged pointer
+inline static KS_RopeNode* KS_GetRopeNode(uint64_t PtrAndClass)
+{
+    return (KS_RopeNode*)(PtrAndClass & KSTRING_ADDRESS_MASK & ~KSTRING_ROPE_TAG);
+}
+
 // Extract pointer from tagged pointer
+// Resolves relocatable offsets through the region registry (offset only, see KS_GetData) and flattens ropes lazily
 inline static void* KS_GetPointer(uint64_t PtrAndClass)
 {
-    return (void*)(PtrAndClass & KSTRING_PTR_MASK);
+    if (KSTRING_RELOCATABLE == KS_GetStorageClass(PtrAndClass))
+    {
+        return KS_ResolveOffset(PtrAndClass, 0);
+    }
+
+    if (true == KS_IsRope(PtrAndClass))
+    {
+        return (void*)KS_RopeFlatten(KS_GetRopeNode(PtrAndClass));
+    }
+
+    return (void*)(PtrAndClass & KSTRING_ADDRESS_MASK);
 }
 
 // Create tagged pointer with storage class
@@ -104,10 +200,10 @@ inline static uint64_t KS_CreateTaggedPointer(void* pPointer, KStringStorageClas
 {
     uint64_t Ptr = (uint64_t)pPointer;
 
-    // Validate that pointer fits in 62-bit space (security check)
-    if ((Ptr & ~KSTRING_PTR_MASK) != 0)
+    // Validate that pointer fits in the address bits (security check)
+    if ((Ptr & ~KSTRING_ADDRESS_MASK) != 0)
     {
-        // Pointer has bits set in the upper 2 bits, which would be corrupted
+        // Pointer has bits set in the class or flag bits, which would be corrupted
         // This is a critical error that should not happen in normal operation
         return 0; // Return invalid tagged pointer
     }
@@ -116,6 +212,14 @@ inline static uint64_t KS_CreateTaggedPointer(void* pPointer, KStringStorageClas
     return (Ptr & KSTRING_PTR_MASK) | Class;
 }
 
+// Create tagged offset with RELOCATABLE storage class
+inline static uint64_t KS_CreateTaggedOffset(uint8_t RegionId, size_t Offset)
+{
+    uint64_t Region = ((uint64_t)RegionId) << KSTRING_REGION_SHIFT;
+    uint64_t Class  = ((uint64_t)KSTRING_RELOCATABLE) << KSTRING_CLASS_SHIFT;
+    return ((uint64_t)Offset & KSTRING_OFFSET_MASK) | Region | Class;
+}
+
 // Extract size from Size field (30 bits)
 inline static size_t KS_GetSizeFromField(uint32_t SizeField)
 {
@@ -128,1193 +232,5269 @@ inline static KStringEncoding KS_GetEncodingFromField(uint32_t SizeField)
     return (KStringEncoding)((SizeField & KSTRING_ENCODING_MASK) >> KSTRING_ENCODING_SHIFT);
 }
 
-// Create Size field with size and encoding
-inline static uint32_t KS_CreateSizeField(size_t Size, KStringEncoding Encoding)
+// Payload header of large strings (the tagged pointer refers to the payload right behind it)
+typedef struct KS_LargeHeader
 {
-    // Enhanced size validation to prevent truncation and overflow
-    if (Size > KSTRING_SIZE_MASK || Size > UINT32_MAX)
-    {
-        return KSTRING_INVALID_LENGTH; // Size too large
-    }
+    uint64_t Size;     // Actual size in bytes
+    uint64_t Reserved; // Keeps the payload 16-byte aligned
+} KS_LargeHeader;
 
-    uint32_t SizeField     = (uint32_t)Size;
-    uint32_t EncodingField = ((uint32_t)Encoding) << KSTRING_ENCODING_SHIFT;
-    return SizeField | EncodingField;
+// Check if Size field holds the large-string sentinel
+inline static bool KS_IsLargeField(uint32_t SizeField)
+{
+    return KSTRING_LARGE_SIZE == (SizeField & KSTRING_SIZE_MASK);
 }
 
-//
-// Core Operations
-//
-
-KString KStringCreate(const char* pStr, const size_t Size)
+// Get header of a large string
+inline static KS_LargeHeader* KS_GetLargeHeader(uint64_t PtrAndClass)
 {
-    // Use UTF-8 as default encoding
-    return KStringCreateWithEncoding(pStr, Size, KSTRING_ENCODING_UTF8);
+    return (KS_LargeHeader*)((char*)(PtrAndClass & KSTRING_ADDRESS_MASK) - sizeof(KS_LargeHeader));
 }
 
-KString KStringCreateWithEncoding(const char* pStr, const size_t Size, const KStringEncoding Encoding)
+// Get size of a string in bytes, resolving the large-string sentinel
+inline static size_t KS_GetSize(const KString* pStr)
 {
-    if (NULL == pStr)
+    if (false == KS_IsLargeField(pStr->Size))
     {
-        return KStringInvalid();
+        return KS_GetSizeFromField(pStr->Size);
     }
 
-    KString Result;
-    Result.Size = KS_CreateSizeField(Size, Encoding);
+    return (size_t)KS_GetLargeHeader(pStr->LongStr.PtrAndClass)->Size;
+}
 
-    if (KSTRING_INVALID_LENGTH == Result.Size)
+// Get payload of a string: inline content, resolved relocatable range or (flattened) heap payload
+// NULL if it cannot be resolved (unregistered region, range beyond the region, failed rope flatten)
+inline static const char* KS_GetData(const KString* pStr)
+{
+    if (true == KS_IsShortString(KS_GetSizeFromField(pStr->Size)))
     {
-        return KStringInvalid();
+        return pStr->Content;
     }
 
-    if (KS_IsShortString(Size))
+    uint64_t PtrAndClass = pStr->LongStr.PtrAndClass;
+    if (KSTRING_RELOCATABLE == KS_GetStorageClass(PtrAndClass))
     {
-        // Short string: store inline
-        memcpy(Result.Content, pStr, Size);
-        // Zero-fill remaining bytes for consistent comparison
-        if (Size < KSTRING_MAX_SHORT_LENGTH)
-        {
-            memset(Result.Content + Size, 0, KSTRING_MAX_SHORT_LENGTH - Size);
-        }
+        // Relocatable strings are never large (the size lives in the Size field)
+        return (true == KS_IsLargeField(pStr->Size)) ? NULL : (const char*)KS_ResolveOffset(PtrAndClass, KS_GetSizeFromField(pStr->Size));
     }
-    else
-    {
-        // Long string: allocate memory and store prefix
-        char* pData = KS_Alloc(Size + 1); // +1 for null terminator, zero-initialized
-        if (NULL == pData)
-        {
-            return KStringInvalid();
-        }
-
-        memcpy(pData, pStr, Size);
-        pData[Size] = '\0';
-
-        // Store first 4 characters as prefix (safe copy with bounds checking)
-        size_t PrefixSize = (Size >= 4) ? 4 : Size;
-        memcpy(Result.LongStr.Prefix, pStr, PrefixSize);
-        if (PrefixSize < 4)
-        {
-            memset(Result.LongStr.Prefix + PrefixSize, 0, 4 - PrefixSize);
-        }
 
-        // Create tagged pointer with TEMPORARY storage class
-        Result.LongStr.PtrAndClass = KS_CreateTaggedPointer(pData, KSTRING_TEMPORARY);
+    return (const char*)KS_GetPointer(PtrAndClass);
+}
 
-        // Validate tagged pointer creation (security check)
-        if (0 == Result.LongStr.PtrAndClass)
-        {
-            KS_Release((void**)&pData);
-            return KStringInvalid();
-        }
+// Create Size field with size and encoding (sizes from KSTRING_LARGE_SIZE on need a large string)
+inline static uint32_t KS_CreateSizeField(size_t Size, KStringEncoding Encoding)
+{
+    // Enhanced size validation to prevent truncation and overflow
+    if (Size >= KSTRING_LARGE_SIZE || Size > UINT32_MAX)
+    {
+        return KSTRING_INVALID_LENGTH; // Size too large
     }
 
-    return Result;
+    uint32_t SizeField     = (uint32_t)Size;
+    uint32_t EncodingField = ((uint32_t)Encoding) << KSTRING_ENCODING_SHIFT;
+    return SizeField | EncodingField;
 }
 
-KString KStringCreatePersistent(const char* pStr, const size_t Size)
+// Prepare a large TEMPORARY string: header, payload and null terminator in one zero-initialized block
+static char* KS_PrepareLargeString(KString* pResult, size_t Size, KStringEncoding Encoding)
 {
-    // Use UTF-8 as default encoding
-    return KStringCreatePersistentWithEncoding(pStr, Size, KSTRING_ENCODING_UTF8);
+    if (Size > SIZE_MAX - sizeof(KS_LargeHeader) - KSTRING_ALIGNMENT)
+    {
+        return NULL;
+    }
+
+    KS_LargeHeader* pHeader = KS_Alloc(sizeof(KS_LargeHeader) + Size + 1);
+    if (NULL == pHeader)
+    {
+        return NULL;
+    }
+
+    pHeader->Size = Size;
+
+    char* pData                  = (char*)(pHeader + 1);
+    pResult->Size                = KSTRING_LARGE_SIZE | ((uint32_t)Encoding << KSTRING_ENCODING_SHIFT);
+    pResult->LongStr.PtrAndClass = KS_CreateTaggedPointer(pData, KSTRING_TEMPORARY);
+
+    // Validate tagged pointer creation (security check)
+    if (0 == pResult->LongStr.PtrAndClass)
+    {
+        KS_Release((void**)&pHeader);
+        return NULL;
+    }
+
+    return pData;
 }
 
-KString KStringCreatePersistentWithEncoding(const char* pStr, const size_t Size, const KStringEncoding Encoding)
+// Prepare a result string of Size bytes and return the location to write the payload to
+// Short results are written inline, long results get a zero-initialized TEMPORARY payload
+// (with a large-string header if Size exceeds the 30-bit Size field)
+static char* KS_PrepareString(KString* pResult, size_t Size, KStringEncoding Encoding)
 {
-    if (NULL == pStr)
+    if (Size >= KSTRING_LARGE_SIZE)
     {
-        return KStringInvalid();
+        return KS_PrepareLargeString(pResult, Size, Encoding);
     }
 
-    KString Result;
-    Result.Size = KS_CreateSizeField(Size, Encoding);
+    pResult->Size = KS_CreateSizeField(Size, Encoding);
 
-    if (KSTRING_INVALID_LENGTH == Result.Size)
+    if (KSTRING_INVALID_LENGTH == pResult->Size)
     {
-        return KStringInvalid();
+        return NULL;
     }
 
     if (KS_IsShortString(Size))
     {
-        // Short strings are always persistent (no pointer needed)
-        memcpy(Result.Content, pStr, Size);
-        if (Size < KSTRING_MAX_SHORT_LENGTH)
-        {
-            memset(Result.Content + Size, 0, KSTRING_MAX_SHORT_LENGTH - Size);
-        }
+        memset(pResult->Content, 0, KSTRING_MAX_SHORT_LENGTH);
+        return pResult->Content;
     }
-    else
+
+    char* pData = KS_Alloc(Size + 1); // +1 for null terminator, zero-initialized
+    if (NULL == pData)
     {
-        // Long persistent string: point directly to source (no allocation)
-        // Store first 4 characters as prefix (safe copy with bounds checking)
-        size_t PrefixSize = (Size >= 4) ? 4 : Size;
-        memcpy(Result.LongStr.Prefix, pStr, PrefixSize);
-        if (PrefixSize < 4)
-        {
-            memset(Result.LongStr.Prefix + PrefixSize, 0, 4 - PrefixSize);
-        }
-        Result.LongStr.PtrAndClass = KS_CreateTaggedPointer((void*)pStr, KSTRING_PERSISTENT);
+        return NULL;
     }
 
-    return Result;
-}
+    pResult->LongStr.PtrAndClass = KS_CreateTaggedPointer(pData, KSTRING_TEMPORARY);
 
-KString KStringCreateTransient(const char* pStr, const size_t Size)
-{
-    // Use UTF-8 as default encoding
-    return KStringCreateTransientWithEncoding(pStr, Size, KSTRING_ENCODING_UTF8);
+    // Validate tagged pointer creation (security check)
+    if (0 == pResult->LongStr.PtrAndClass)
+    {
+        KS_Release((void**)&pData);
+        return NULL;
+    }
+
+    return pData;
 }
 
-KString KStringCreateTransientWithEncoding(const char* pStr, const size_t Size, const KStringEncoding Encoding)
+// Complete a string prepared with KS_PrepareString once its payload has been written
+inline static void KS_FinishString(KString* pResult, const char* pData)
 {
-    if (NULL == pStr)
+    if (false == KStringIsShort(*pResult))
     {
-        return KStringInvalid();
+        memcpy(pResult->LongStr.Prefix, pData, 4);
     }
+}
 
-    KString Result;
-    Result.Size = KS_CreateSizeField(Size, Encoding);
+//
+// Private UTF-8 Validation Functions
+//
 
-    if (KSTRING_INVALID_LENGTH == Result.Size)
+// Sequence length by lead byte, 0 for bytes that cannot start a sequence
+// (continuation bytes 0x80-0xBF, overlong leads 0xC0/0xC1, leads beyond U+10FFFF 0xF5-0xFF)
+static const uint8_t KS_Utf8SequenceLength[256] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x00
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x10
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x20
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x30
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x40
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x50
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x60
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x70
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x80
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x90
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0xA0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0xB0
+    0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,  // 0xC0
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,  // 0xD0
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,  // 0xE0
+    4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0xF0
+};
+
+// Validate UTF-8 according to Unicode Table 3-7 (no overlongs, no surrogates, nothing beyond U+10FFFF)
+// ASCII runs are skipped 64 bytes at a time, multi-byte runs are checked with the lead byte table
+static bool KS_ValidateUtf8(const uint8_t* pData, size_t Size)
+{
+    size_t i = 0;
+    while (i < Size)
     {
-        return KStringInvalid();
-    }
+        i += KS_SimdAsciiPrefix(pData + i, Size - i);
 
-    if (KS_IsShortString(Size))
-    {
-        // Short string: copy inline
-        memcpy(Result.Content, pStr, Size);
-        if (Size < KSTRING_MAX_SHORT_LENGTH)
+        // Non-ASCII text tends to come in runs: stay scalar until the next ASCII byte
+        while (i < Size && pData[i] >= 0x80)
         {
-            memset(Result.Content + Size, 0, KSTRING_MAX_SHORT_LENGTH - Size);
+            size_t Length = KS_Utf8SequenceLength[pData[i]];
+            if (0 == Length || Length > Size - i)
+            {
+                return false;
+            }
+
+            // Second byte range depends on the lead byte (excludes overlongs, surrogates and > U+10FFFF)
+            uint8_t Low  = 0x80;
+            uint8_t High = 0xBF;
+            switch (pData[i])
+            {
+                case 0xE0:
+                    Low = 0xA0;
+                    break;
+                case 0xED:
+                    High = 0x9F;
+                    break;
+                case 0xF0:
+                    Low = 0x90;
+                    break;
+                case 0xF4:
+                    High = 0x8F;
+                    break;
+                default:
+                    break;
+            }
+
+            if (pData[i + 1] < Low || pData[i + 1] > High)
+            {
+                return false;
+            }
+
+            for (size_t k = 2; k < Length; ++k)
+            {
+                if (0x80 != (pData[i + k] & 0xC0))
+                {
+                    return false;
+                }
+            }
+
+            i += Length;
         }
     }
-    else
+
+    return true;
+}
+
+// Check if long string carries the validated UTF-8 flag
+inline static bool KS_HasUtf8ValidFlag(const KString* pStr)
+{
+    return false == KStringIsShort(*pStr) && 0 != (pStr->LongStr.PtrAndClass & KSTRING_UTF8_VALID_FLAG);
+}
+
+// Check if string is known to be valid UTF-8 (flag for long strings, short strings are checked on the fly)
+static bool KS_IsKnownValidUtf8(const KString* pStr)
+{
+    if (KSTRING_ENCODING_UTF8 != KS_GetEncodingFromField(pStr->Size))
     {
-        // Long transient string: point directly to source
-        // Store first 4 characters as prefix (safe copy with bounds checking)
-        size_t PrefixSize = (Size >= 4) ? 4 : Size;
-        memcpy(Result.LongStr.Prefix, pStr, PrefixSize);
-        if (PrefixSize < 4)
-        {
-            memset(Result.LongStr.Prefix + PrefixSize, 0, 4 - PrefixSize);
-        }
-        Result.LongStr.PtrAndClass = KS_CreateTaggedPointer((void*)pStr, KSTRING_TRANSIENT);
+        return false;
     }
 
-    return Result;
+    if (true == KStringIsShort(*pStr))
+    {
+        return KS_ValidateUtf8((const uint8_t*)pStr->Content, KS_GetSize(pStr));
+    }
+
+    return true == KS_HasUtf8ValidFlag(pStr);
 }
 
 //
-// Convenience Functions for Null-Terminated Strings (less secure)
+// Private Rope Functions
 //
 
-KString KStringCreateFromCStr(const char* pStr)
+// Leaves up to this size are merged on concatenation (keeps append-heavy ropes shallow)
+#define KSTRING_ROPE_LEAF_SIZE 512
+
+// Immutable, reference-counted rope node (concatenation node or leaf)
+struct KS_RopeNode
 {
-    if (NULL == pStr)
-    {
-        return KStringInvalid();
-    }
+    atomic_size_t   RefCount; // Shared between rope strings
+    size_t          Size;     // Total bytes below this node
+    uint32_t        Depth;    // 0 for leaves, 1 + max child depth otherwise
+    KS_RopeNode*    pLeft;    // Concatenation: left child
+    KS_RopeNode*    pRight;   // Concatenation: right child
+    const char*     pData;    // Leaf: payload (own storage, PERSISTENT source or slice of pOwner)
+    KS_RopeNode*    pOwner;   // Leaf slice: leaf owning pData (NULL otherwise)
+    _Atomic(char*)  pFlat;    // Lazily flattened contents (null-terminated)
+    char            Storage[]; // Leaf: own payload
+};
+
+inline static uint32_t KS_RopeDepth(const KS_RopeNode* pNode)
+{
+    return pNode->Depth;
+}
 
-    size_t Size = strlen(pStr);
-    return KStringCreate(pStr, Size);
+inline static KS_RopeNode* KS_RopeRetain(KS_RopeNode* pNode)
+{
+    atomic_fetch_add_explicit(&pNode->RefCount, 1, memory_order_relaxed);
+    return pNode;
 }
 
-KString KStringCreatePersistentFromCStr(const char* pStr)
+static void KS_RopeRelease(KS_RopeNode* pNode)
 {
-    if (NULL == pStr)
+    if (NULL == pNode || 1 != atomic_fetch_sub_explicit(&pNode->RefCount, 1, memory_order_acq_rel))
     {
-        return KStringInvalid();
+        return;
     }
 
-    size_t Size = strlen(pStr);
-    return KStringCreatePersistent(pStr, Size);
+    KS_RopeRelease(pNode->pLeft);
+    KS_RopeRelease(pNode->pRight);
+    KS_RopeRelease(pNode->pOwner);
+    char* pFlat = atomic_load_explicit(&pNode->pFlat, memory_order_relaxed);
+    KS_Release((void**)&pFlat);
+    free(pNode);
 }
 
-void KStringDestroy(const KString Str)
+// Allocate node with StorageSize bytes of own leaf payload
+static KS_RopeNode* KS_RopeAllocNode(size_t StorageSize)
 {
-    // Only temporary long strings need cleanup
-    if (false == KStringIsShort(Str))
+    KS_RopeNode* pNode = malloc(sizeof(KS_RopeNode) + StorageSize);
+    if (NULL == pNode)
     {
-        KStringStorageClass StorageClass = KS_GetStorageClass(Str.LongStr.PtrAndClass);
-        if (KSTRING_TEMPORARY == StorageClass)
-        {
-            void* pData = KS_GetPointer(Str.LongStr.PtrAndClass);
-            KS_Release((void**)&pData);
-        }
+        return NULL;
     }
-}
 
-//
-// Access Operations
-//
+    atomic_init(&pNode->RefCount, 1);
+    atomic_init(&pNode->pFlat, NULL);
+    pNode->Size   = 0;
+    pNode->Depth  = 0;
+    pNode->pLeft  = NULL;
+    pNode->pRight = NULL;
+    pNode->pData  = NULL;
+    pNode->pOwner = NULL;
+    return pNode;
+}
 
-const char* KStringCStr(const KString Str)
+// Create leaf with copied payload (optionally two pieces, for merging adjacent leaves)
+static KS_RopeNode* KS_RopeNewLeaf(const char* pDataA, size_t SizeA, const char* pDataB, size_t SizeB)
 {
-    if (false == KStringIsValid(Str))
+    KS_RopeNode* pNode = KS_RopeAllocNode(SizeA + SizeB);
+    if (NULL == pNode)
     {
         return NULL;
     }
 
-    if (KStringIsShort(Str))
+    memcpy(pNode->Storage, pDataA, SizeA);
+    if (0 != SizeB)
     {
-        // For short strings, we need to return a null-terminated copy
-        // Use rotating buffers to handle multiple calls in one expression
-        static __thread char ShortBuffers[4][KSTRING_MAX_SHORT_LENGTH + 1];
-        static __thread int  BufferIndex = 0;
-
-        char* Buffer = ShortBuffers[BufferIndex];
-        BufferIndex  = (BufferIndex + 1) % 4;
-
-        size_t Size = KS_GetSizeFromField(Str.Size);
-        memcpy(Buffer, Str.Content, Size);
-        Buffer[Size] = '\0';
-        return Buffer;
-    }
-    else
-    {
-        // Long strings are already null-terminated
-        return (const char*)KS_GetPointer(Str.LongStr.PtrAndClass);
+        memcpy(pNode->Storage + SizeA, pDataB, SizeB);
     }
-}
 
-size_t KStringSize(const KString Str)
-{
-    return KStringIsValid(Str) ? KS_GetSizeFromField(Str.Size) : 0;
+    pNode->Size  = SizeA + SizeB;
+    pNode->pData = pNode->Storage;
+    return pNode;
 }
 
-KStringEncoding KStringGetEncoding(const KString Str)
+// Create leaf referencing memory that is kept alive elsewhere (PERSISTENT source or owner leaf)
+static KS_RopeNode* KS_RopeNewLeafView(const char* pData, size_t Size, KS_RopeNode* pOwner)
 {
-    return KStringIsValid(Str) ? KS_GetEncodingFromField(Str.Size) : KSTRING_ENCODING_UTF8;
-}
+    KS_RopeNode* pNode = KS_RopeAllocNode(0);
+    if (NULL == pNode)
+    {
+        KS_RopeRelease(pOwner);
+        return NULL;
+    }
 
-bool KStringIsShort(const KString Str)
-{
-    return KS_IsShortString(KS_GetSizeFromField(Str.Size));
+    pNode->Size   = Size;
+    pNode->pData  = pData;
+    pNode->pOwner = pOwner;
+    return pNode;
 }
 
-//
-// Comparison Operations
-//
-
-int KStringCompare(const KString StrA, const KString StrB)
+// Create concatenation node (consumes both references)
+static KS_RopeNode* KS_RopeNewConcat(KS_RopeNode* pLeft, KS_RopeNode* pRight)
 {
-    // Extract actual sizes for comparison
-    size_t SizeA = KS_GetSizeFromField(StrA.Size);
-    size_t SizeB = KS_GetSizeFromField(StrB.Size);
-
-    // Fast path: compare lengths first
-    if (SizeA != SizeB)
+    if (NULL == pLeft || NULL == pRight)
     {
-        return (SizeA < SizeB) ? -1 : 1;
+        KS_RopeRelease(pLeft);
+        KS_RopeRelease(pRight);
+        return NULL;
     }
 
-    // Same length - compare content
-    if (true == KStringIsShort(StrA) && true == KStringIsShort(StrB))
-    {
-        // Both short: direct memory comparison
-        return memcmp(StrA.Content, StrB.Content, SizeA);
-    }
-    else if (true == KStringIsShort(StrA) || true == KStringIsShort(StrB))
+    KS_RopeNode* pNode = KS_RopeAllocNode(0);
+    if (NULL == pNode)
     {
-        // One short, one long: get actual data
-        const char* pDataA = (true == KStringIsShort(StrA)) ? StrA.Content : (const char*)KS_GetPointer(StrA.LongStr.PtrAndClass);
-        const char* pDataB = (true == KStringIsShort(StrB)) ? StrB.Content : (const char*)KS_GetPointer(StrB.LongStr.PtrAndClass);
-        return memcmp(pDataA, pDataB, SizeA);
+        KS_RopeRelease(pLeft);
+        KS_RopeRelease(pRight);
+        return NULL;
     }
-    else
-    {
-        // Both long: compare prefixes first (fast path)
-        int PrefixCmp = memcmp(StrA.LongStr.Prefix, StrB.LongStr.Prefix, 4);
-        if (0 != PrefixCmp)
-        {
-            return PrefixCmp;
-        }
 
-        // Prefixes match: compare full strings
-        const char* pDataA = (const char*)KS_GetPointer(StrA.LongStr.PtrAndClass);
-        const char* pDataB = (const char*)KS_GetPointer(StrB.LongStr.PtrAndClass);
-        return memcmp(pDataA, pDataB, SizeA);
-    }
-}
+    uint32_t DepthLeft  = KS_RopeDepth(pLeft);
+    uint32_t DepthRight = KS_RopeDepth(pRight);
 
-bool KStringEquals(const KString StrA, const KString StrB)
-{
-    return KStringCompare(StrA, StrB) == 0;
+    pNode->Size   = pLeft->Size + pRight->Size;
+    pNode->Depth  = 1 + ((DepthLeft > DepthRight) ? DepthLeft : DepthRight);
+    pNode->pLeft  = pLeft;
+    pNode->pRight = pRight;
+    return pNode;
 }
 
-bool KStringStartsWith(const KString Str, const KString Prefix)
+// Create concatenation node, restoring the AVL balance with one rotation (consumes both references)
+// Children may differ in depth by at most 2 (guaranteed by KS_RopeJoin)
+static KS_RopeNode* KS_RopeBalance(KS_RopeNode* pLeft, KS_RopeNode* pRight)
 {
-    // Extract actual sizes using helper functions (security fix)
-    size_t StrSize    = KS_GetSizeFromField(Str.Size);
-    size_t PrefixSize = KS_GetSizeFromField(Prefix.Size);
-
-    if (PrefixSize > StrSize)
+    if (NULL == pLeft || NULL == pRight)
     {
-        return false;
+        return KS_RopeNewConcat(pLeft, pRight);
     }
 
-    if (0 == PrefixSize)
-    {
-        return true;
-    }
+    uint32_t DepthLeft  = KS_RopeDepth(pLeft);
+    uint32_t DepthRight = KS_RopeDepth(pRight);
 
-    // Compare prefixes efficiently
-    if (true == KStringIsShort(Str) && true == KStringIsShort(Prefix))
-    {
-        return memcmp(Str.Content, Prefix.Content, PrefixSize) == 0;
-    }
-    else if (true == KStringIsShort(Str))
-    {
-        const char* pPrefixData = (true == KStringIsShort(Prefix)) ? Prefix.Content : (const char*)KS_GetPointer(Prefix.LongStr.PtrAndClass);
-        return memcmp(Str.Content, pPrefixData, PrefixSize) == 0;
-    }
-    else if (true == KStringIsShort(Prefix))
+    if (DepthRight > DepthLeft + 1)
     {
-        // Str is long, Prefix is short: check against stored prefix first
-        if (PrefixSize <= 4)
-        {
-            return memcmp(Str.LongStr.Prefix, Prefix.Content, PrefixSize) == 0;
-        }
-        else
+        // Right-heavy: nodes are immutable, so rotate by rebuilding with retained grandchildren
+        KS_RopeNode* pInner = KS_RopeRetain(pRight->pLeft);
+        KS_RopeNode* pOuter = KS_RopeRetain(pRight->pRight);
+        KS_RopeRelease(pRight);
+
+        if (KS_RopeDepth(pInner) > KS_RopeDepth(pOuter))
         {
-            const char* pStrData = (const char*)KS_GetPointer(Str.LongStr.PtrAndClass);
-            return memcmp(pStrData, Prefix.Content, PrefixSize) == 0;
+            // Double rotation
+            KS_RopeNode* pInnerLeft  = KS_RopeRetain(pInner->pLeft);
+            KS_RopeNode* pInnerRight = KS_RopeRetain(pInner->pRight);
+            KS_RopeRelease(pInner);
+            return KS_RopeNewConcat(KS_RopeNewConcat(pLeft, pInnerLeft), KS_RopeNewConcat(pInnerRight, pOuter));
         }
+
+        return KS_RopeNewConcat(KS_RopeNewConcat(pLeft, pInner), pOuter);
     }
-    else
+
+    if (DepthLeft > DepthRight + 1)
     {
-        // Both long: use stored prefixes for fast comparison
-        if (PrefixSize <= 4)
-        {
-            return memcmp(Str.LongStr.Prefix, Prefix.LongStr.Prefix, PrefixSize) == 0;
-        }
-        else
+        // Left-heavy: mirror image of the above
+        KS_RopeNode* pOuter = KS_RopeRetain(pLeft->pLeft);
+        KS_RopeNode* pInner = KS_RopeRetain(pLeft->pRight);
+        KS_RopeRelease(pLeft);
+
+        if (KS_RopeDepth(pInner) > KS_RopeDepth(pOuter))
         {
-            // Prefix is longer than 4 chars: need full comparison
-            const char* pStrData    = (const char*)KS_GetPointer(Str.LongStr.PtrAndClass);
-            const char* pPrefixData = (const char*)KS_GetPointer(Prefix.LongStr.PtrAndClass);
-            return memcmp(pStrData, pPrefixData, PrefixSize) == 0;
+            KS_RopeNode* pInnerLeft  = KS_RopeRetain(pInner->pLeft);
+            KS_RopeNode* pInnerRight = KS_RopeRetain(pInner->pRight);
+            KS_RopeRelease(pInner);
+            return KS_RopeNewConcat(KS_RopeNewConcat(pOuter, pInnerLeft), KS_RopeNewConcat(pInnerRight, pRight));
         }
-    }
-}
 
-//
-// Private Helper Functions for Case-Insensitive Operations
-//
+        return KS_RopeNewConcat(pOuter, KS_RopeNewConcat(pInner, pRight));
+    }
 
-// Convert character to lowercase (ASCII only for performance)
-inline static char KS_ToLowerAscii(char c)
-{
-    return (c >= 'A' && c <= 'Z') ? (c + 32) : c;
+    return KS_RopeNewConcat(pLeft, pRight);
 }
 
-// Case-insensitive memory comparison (ASCII only)
-inline static int KS_MemcmpIgnoreCase(const char* pStr1, const char* pStr2, size_t Size)
+// Join two ropes in O(log n): descend the spine of the deeper rope and rebalance on the way up
+// Consumes both references, returns NULL on allocation failure
+static KS_RopeNode* KS_RopeJoin(KS_RopeNode* pLeft, KS_RopeNode* pRight)
 {
-    for (size_t i = 0; i < Size; ++i)
+    if (NULL == pLeft || NULL == pRight)
     {
-        char c1 = KS_ToLowerAscii(pStr1[i]);
-        char c2 = KS_ToLowerAscii(pStr2[i]);
-        if (c1 != c2)
-        {
-            return (c1 < c2) ? -1 : 1;
-        }
+        return KS_RopeNewConcat(pLeft, pRight);
     }
-    return 0;
-}
-
-//
-// Case-Insensitive Comparison Operations
-//
 
-int KStringCompareIgnoreCase(const KString StrA, const KString StrB)
-{
-    // Fast path: compare lengths first
-    if (StrA.Size != StrB.Size)
+    if (0 == pLeft->Size)
     {
-        return (StrA.Size < StrB.Size) ? -1 : 1;
+        KS_RopeRelease(pLeft);
+        return pRight;
     }
 
-    // Same length - compare content case-insensitively
-    if (true == KStringIsShort(StrA) && true == KStringIsShort(StrB))
+    if (0 == pRight->Size)
     {
-        // Both short: direct memory comparison
-        return KS_MemcmpIgnoreCase(StrA.Content, StrB.Content, StrA.Size);
+        KS_RopeRelease(pRight);
+        return pLeft;
     }
-    else if (true == KStringIsShort(StrA) || true == KStringIsShort(StrB))
+
+    // Small adjacent leaves: merge into one leaf instead of adding a node
+    if (0 == pLeft->Depth && 0 == pRight->Depth && pLeft->Size + pRight->Size <= KSTRING_ROPE_LEAF_SIZE)
     {
-        // One short, one long: get actual data
-        const char* pDataA = (true == KStringIsShort(StrA)) ? StrA.Content : (const char*)KS_GetPointer(StrA.LongStr.PtrAndClass);
-        const char* pDataB = (true == KStringIsShort(StrB)) ? StrB.Content : (const char*)KS_GetPointer(StrB.LongStr.PtrAndClass);
-        return KS_MemcmpIgnoreCase(pDataA, pDataB, StrA.Size);
+        KS_RopeNode* pMerged = KS_RopeNewLeaf(pLeft->pData, pLeft->Size, pRight->pData, pRight->Size);
+        KS_RopeRelease(pLeft);
+        KS_RopeRelease(pRight);
+        return pMerged;
     }
-    else
+
+    uint32_t DepthLeft  = KS_RopeDepth(pLeft);
+    uint32_t DepthRight = KS_RopeDepth(pRight);
+
+    if (DepthLeft > DepthRight + 1)
     {
-        // Both long: compare prefixes first (fast path)
-        int PrefixCmp = KS_MemcmpIgnoreCase(StrA.LongStr.Prefix, StrB.LongStr.Prefix, 4);
-        if (0 != PrefixCmp)
-        {
-            return PrefixCmp;
-        }
+        KS_RopeNode* pKeep   = KS_RopeRetain(pLeft->pLeft);
+        KS_RopeNode* pJoined = KS_RopeJoin(KS_RopeRetain(pLeft->pRight), pRight);
+        KS_RopeRelease(pLeft);
+        return KS_RopeBalance(pKeep, pJoined);
+    }
 
-        // Prefixes match: compare full strings
-        const char* pDataA = (const char*)KS_GetPointer(StrA.LongStr.PtrAndClass);
-        const char* pDataB = (const char*)KS_GetPointer(StrB.LongStr.PtrAndClass);
-        return KS_MemcmpIgnoreCase(pDataA, pDataB, StrA.Size);
+    if (DepthRight > DepthLeft + 1)
+    {
+        KS_RopeNode* pKeep   = KS_RopeRetain(pRight->pRight);
+        KS_RopeNode* pJoined = KS_RopeJoin(pLeft, KS_RopeRetain(pRight->pLeft));
+        KS_RopeRelease(pRight);
+        return KS_RopeBalance(pJoined, pKeep);
     }
-}
 
-bool KStringEqualsIgnoreCase(const KString StrA, const KString StrB)
-{
-    return 0 == KStringCompareIgnoreCase(StrA, StrB);
+    return KS_RopeNewConcat(pLeft, pRight);
 }
 
-bool KStringStartsWithIgnoreCase(const KString Str, const KString Prefix)
+// Extract Size bytes at Offset as a rope sharing all fully covered nodes (returns new reference)
+static KS_RopeNode* KS_RopeSlice(KS_RopeNode* pNode, size_t Offset, size_t Size)
 {
-    // Extract actual sizes using helper functions (security fix)
-    size_t StrSize    = KS_GetSizeFromField(Str.Size);
-    size_t PrefixSize = KS_GetSizeFromField(Prefix.Size);
-
-    if (PrefixSize > StrSize)
+    if (0 == Offset && Size == pNode->Size)
     {
-        return false;
+        return KS_RopeRetain(pNode);
     }
 
-    if (0 == PrefixSize)
+    if (0 == pNode->Depth)
     {
-        return true;
-    }
+        // Leaf: reference the owning leaf (PERSISTENT views need no owner)
+        KS_RopeNode* pOwner = pNode->pOwner;
+        if (pNode->pData == pNode->Storage)
+        {
+            pOwner = pNode;
+        }
 
-    // Compare prefixes efficiently (case-insensitive)
-    if (true == KStringIsShort(Str) && true == KStringIsShort(Prefix))
-    {
-        return 0 == KS_MemcmpIgnoreCase(Str.Content, Prefix.Content, PrefixSize);
+        return KS_RopeNewLeafView(pNode->pData + Offset, Size, (NULL != pOwner) ? KS_RopeRetain(pOwner) : NULL);
     }
-    else if (true == KStringIsShort(Str))
+
+    size_t LeftSize = pNode->pLeft->Size;
+    if (Offset + Size <= LeftSize)
     {
-        const char* pPrefixData = (true == KStringIsShort(Prefix)) ? Prefix.Content : (const char*)KS_GetPointer(Prefix.LongStr.PtrAndClass);
-        return 0 == KS_MemcmpIgnoreCase(Str.Content, pPrefixData, PrefixSize);
+        return KS_RopeSlice(pNode->pLeft, Offset, Size);
     }
-    else if (true == KStringIsShort(Prefix))
+
+    if (Offset >= LeftSize)
     {
-        // Str is long, Prefix is short: check against stored prefix first
-        if (PrefixSize <= 4)
-        {
-            return 0 == KS_MemcmpIgnoreCase(Str.LongStr.Prefix, Prefix.Content, PrefixSize);
-        }
-        else
-        {
-            const char* pStrData = (const char*)KS_GetPointer(Str.LongStr.PtrAndClass);
-            return 0 == KS_MemcmpIgnoreCase(pStrData, Prefix.Content, PrefixSize);
-        }
+        return KS_RopeSlice(pNode->pRight, Offset - LeftSize, Size);
     }
-    else
+
+    KS_RopeNode* pLeftPart  = KS_RopeSlice(pNode->pLeft, Offset, LeftSize - Offset);
+    KS_RopeNode* pRightPart = KS_RopeSlice(pNode->pRight, 0, Offset + Size - LeftSize);
+    return KS_RopeJoin(pLeftPart, pRightPart);
+}
+
+// Copy Size bytes starting at Offset into pDest
+static void KS_RopeCopyOut(const KS_RopeNode* pNode, size_t Offset, size_t Size, char* pDest)
+{
+    while (0 != Size)
     {
-        // Both long: use stored prefixes for fast comparison
-        if (PrefixSize <= 4)
+        if (0 == pNode->Depth)
         {
-            return 0 == KS_MemcmpIgnoreCase(Str.LongStr.Prefix, Prefix.LongStr.Prefix, PrefixSize);
+            memcpy(pDest, pNode->pData + Offset, Size);
+            return;
         }
-        else
+
+        size_t LeftSize = pNode->pLeft->Size;
+        if (Offset >= LeftSize)
         {
-            // Prefix is longer than 4 chars: need full comparison
-            const char* pStrData    = (const char*)KS_GetPointer(Str.LongStr.PtrAndClass);
-            const char* pPrefixData = (const char*)KS_GetPointer(Prefix.LongStr.PtrAndClass);
-            return 0 == KS_MemcmpIgnoreCase(pStrData, pPrefixData, PrefixSize);
+            Offset -= LeftSize;
+            pNode   = pNode->pRight;
+            continue;
         }
+
+        size_t LeftPart = (Offset + Size <= LeftSize) ? Size : LeftSize - Offset;
+        KS_RopeCopyOut(pNode->pLeft, Offset, LeftPart, pDest);
+
+        pDest  += LeftPart;
+        Size   -= LeftPart;
+        Offset  = 0;
+        pNode   = pNode->pRight;
     }
 }
 
-//
-// String Operations
-//
-
-KString KStringConcat(const KString StrA, const KString StrB)
+static const char* KS_RopeFlatten(KS_RopeNode* pNode)
 {
-    if (false == KStringIsValid(StrA) || false == KStringIsValid(StrB))
+    char* pFlat = atomic_load_explicit(&pNode->pFlat, memory_order_acquire);
+    if (NULL != pFlat)
     {
-        return KStringInvalid();
+        return pFlat;
     }
 
-    size_t SizeA = KS_GetSizeFromField(StrA.Size);
-    size_t SizeB = KS_GetSizeFromField(StrB.Size);
-
-    // Check for arithmetic overflow in addition (security check)
-    if (SizeA > SIZE_MAX - SizeB)
+    pFlat = KS_Alloc(pNode->Size + 1); // +1 for null terminator, zero-initialized
+    if (NULL == pFlat)
     {
-        return KStringInvalid(); // Overflow would occur
+        return NULL;
     }
 
-    size_t TotalLength = SizeA + SizeB;
+    KS_RopeCopyOut(pNode, 0, pNode->Size, pFlat);
 
-    if (TotalLength > KSTRING_SIZE_MASK)
+    // Publish; if another thread won the race, use its buffer
+    char* pExpected = NULL;
+    if (false == atomic_compare_exchange_strong_explicit(&pNode->pFlat, &pExpected, pFlat, memory_order_acq_rel, memory_order_acquire))
     {
-        return KStringInvalid();
+        KS_Release((void**)&pFlat);
+        return pExpected;
     }
 
-    // Use encoding from first string
-    KStringEncoding Encoding = KS_GetEncodingFromField(StrA.Size);
+    return pFlat;
+}
+
+// Get rope node for a string: ropes are shared, PERSISTENT payloads referenced, everything else copied
+static KS_RopeNode* KS_RopeFromString(const KString* pStr)
+{
+    size_t Size = KS_GetSize(pStr);
 
-    // Allocate buffer for concatenated string
-    char* pBuffer = KS_Alloc(TotalLength + 1); // Zero-initialized
-    if (NULL == pBuffer)
+    if (true == KStringIsShort(*pStr))
     {
-        return KStringInvalid();
+        return KS_RopeNewLeaf(pStr->Content, Size, NULL, 0);
     }
 
-    // Copy data from both strings
-    const char* pDataA = (true == KStringIsShort(StrA)) ? StrA.Content : (const char*)KS_GetPointer(StrA.LongStr.PtrAndClass);
-    const char* pDataB = (true == KStringIsShort(StrB)) ? StrB.Content : (const char*)KS_GetPointer(StrB.LongStr.PtrAndClass);
-
-    memcpy(pBuffer, pDataA, SizeA);
-    memcpy(pBuffer + SizeA, pDataB, SizeB);
-    pBuffer[TotalLength] = '\0';
-
-    // Create result KString with encoding from first string
-    KString Result;
-    Result.Size = KS_CreateSizeField(TotalLength, Encoding);
-
-    if (KSTRING_INVALID_LENGTH == Result.Size)
+    if (true == KS_IsRope(pStr->LongStr.PtrAndClass))
     {
-        KS_Release((void**)&pBuffer);
-        return KStringInvalid();
+        return KS_RopeRetain(KS_GetRopeNode(pStr->LongStr.PtrAndClass));
     }
 
-    if (KS_IsShortString(TotalLength))
+    const char* pData = KS_GetData(pStr);
+    if (NULL == pData)
     {
-        // Result fits in short string
-        memcpy(Result.Content, pBuffer, TotalLength);
-        if (TotalLength < KSTRING_MAX_SHORT_LENGTH)
-        {
-            memset(Result.Content + TotalLength, 0, KSTRING_MAX_SHORT_LENGTH - TotalLength);
-        }
-        KS_Release((void**)&pBuffer); // Don't need allocated buffer
+        return NULL;
     }
-    else
+
+    if (KSTRING_PERSISTENT == KS_GetStorageClass(pStr->LongStr.PtrAndClass))
     {
-        // Result is long string
-        memcpy(Result.LongStr.Prefix, pBuffer, 4);
-        Result.LongStr.PtrAndClass = KS_CreateTaggedPointer(pBuffer, KSTRING_TEMPORARY);
+        return KS_RopeNewLeafView(pData, Size, NULL);
     }
 
-    return Result;
+    return KS_RopeNewLeaf(pData, Size, NULL, 0);
 }
 
-KString KStringSubstring(const KString Str, const size_t Offset, const size_t Size)
+// Wrap rope node in a KString (consumes the reference); short results are flattened inline
+static KString KS_RopeToString(KS_RopeNode* pNode, KStringEncoding Encoding)
 {
-    if (false == KStringIsValid(Str))
+    if (NULL == pNode)
     {
         return KStringInvalid();
     }
 
-    size_t          StrSize  = KS_GetSizeFromField(Str.Size);
-    KStringEncoding Encoding = KS_GetEncodingFromField(Str.Size);
+    KString Result;
+    Result.Size = KS_CreateSizeField(pNode->Size, Encoding);
 
-    if (Offset >= StrSize)
+    if (KSTRING_INVALID_LENGTH == Result.Size)
     {
+        KS_RopeRelease(pNode);
         return KStringInvalid();
     }
 
-    // Create local copy for modification
-    size_t LocalSize = Size;
-
-    // Clamp size to available characters
-    if (Offset + LocalSize > StrSize)
+    if (KS_IsShortString(pNode->Size))
     {
-        LocalSize = StrSize - Offset;
+        memset(Result.Content, 0, KSTRING_MAX_SHORT_LENGTH);
+        KS_RopeCopyOut(pNode, 0, pNode->Size, Result.Content);
+        KS_RopeRelease(pNode);
+        return Result;
     }
 
-    if (LocalSize > KSTRING_SIZE_MASK)
+    // Prefix stays inline so comparisons never touch the tree
+    KS_RopeCopyOut(pNode, 0, 4, Result.LongStr.Prefix);
+    uint64_t Tagged = KS_CreateTaggedPointer(pNode, KSTRING_TEMPORARY);
+
+    // Validate tagged pointer creation (security check)
+    if (0 == Tagged)
     {
+        KS_RopeRelease(pNode);
         return KStringInvalid();
     }
 
-    const char* pSourceData = (true == KStringIsShort(Str)) ? Str.Content : (const char*)KS_GetPointer(Str.LongStr.PtrAndClass);
+    Result.LongStr.PtrAndClass = Tagged | KSTRING_ROPE_TAG;
+    return Result;
+}
+
+//
+// Core Operations
+//
+
+KString KStringCreate(const char* pStr, const size_t Size)
+{
+    // Use UTF-8 as default encoding
+    return KStringCreateWithEncoding(pStr, Size, KSTRING_ENCODING_UTF8);
+}
+
+KString KStringCreateWithEncoding(const char* pStr, const size_t Size, const KStringEncoding Encoding)
+{
+    if (NULL == pStr)
+    {
+        return KStringInvalid();
+    }
 
     KString Result;
-    Result.Size = KS_CreateSizeField(LocalSize, Encoding);
+
+    // Copies beyond the 30-bit Size field become large strings
+    if (Size >= KSTRING_LARGE_SIZE)
+    {
+        char* pData = KS_PrepareLargeString(&Result, Size, Encoding);
+        if (NULL == pData)
+        {
+            return KStringInvalid();
+        }
+
+        memcpy(pData, pStr, Size);
+        KS_FinishString(&Result, pData);
+        return Result;
+    }
+
+    Result.Size = KS_CreateSizeField(Size, Encoding);
 
     if (KSTRING_INVALID_LENGTH == Result.Size)
     {
         return KStringInvalid();
     }
 
-    if (KS_IsShortString(LocalSize))
+    if (KS_IsShortString(Size))
     {
-        // Result fits in short string
-        memcpy(Result.Content, pSourceData + Offset, LocalSize);
-        if (LocalSize < KSTRING_MAX_SHORT_LENGTH)
+        // Short string: store inline
+        memcpy(Result.Content, pStr, Size);
+        // Zero-fill remaining bytes for consistent comparison
+        if (Size < KSTRING_MAX_SHORT_LENGTH)
         {
-            memset(Result.Content + LocalSize, 0, KSTRING_MAX_SHORT_LENGTH - LocalSize);
+            memset(Result.Content + Size, 0, KSTRING_MAX_SHORT_LENGTH - Size);
         }
     }
     else
     {
-        // Result requires long string
-        char* pBuffer = KS_Alloc(LocalSize + 1); // Zero-initialized
-        if (NULL == pBuffer)
+        // Long string: allocate memory and store prefix
+        char* pData = KS_Alloc(Size + 1); // +1 for null terminator, zero-initialized
+        if (NULL == pData)
         {
             return KStringInvalid();
         }
 
-        memcpy(pBuffer, pSourceData + Offset, LocalSize);
-        pBuffer[LocalSize] = '\0';
+        memcpy(pData, pStr, Size);
+        pData[Size] = '\0';
+
+        // Store first 4 characters as prefix (safe copy with bounds checking)
+        size_t PrefixSize = (Size >= 4) ? 4 : Size;
+        memcpy(Result.LongStr.Prefix, pStr, PrefixSize);
+        if (PrefixSize < 4)
+        {
+            memset(Result.LongStr.Prefix + PrefixSize, 0, 4 - PrefixSize);
+        }
+
+        // Create tagged pointer with TEMPORARY storage class
+        Result.LongStr.PtrAndClass = KS_CreateTaggedPointer(pData, KSTRING_TEMPORARY);
 
-        memcpy(Result.LongStr.Prefix, pBuffer, 4);
-        Result.LongStr.PtrAndClass = KS_CreateTaggedPointer(pBuffer, KSTRING_TEMPORARY);
+        // Validate tagged pointer creation (security check)
+        if (0 == Result.LongStr.PtrAndClass)
+        {
+            KS_Release((void**)&pData);
+            return KStringInvalid();
+        }
     }
 
     return Result;
 }
 
-//
-// Encoding Conversion Operations
-//
-
-// Helper function: Convert UTF-8 to UTF-16 (Little Endian)
-static size_t KS_ConvertUtf8ToUtf16Le(const char* pUtf8, size_t Utf8Size, uint16_t* pUtf16, size_t MaxUtf16Size)
+KString KStringCreatePersistent(const char* pStr, const size_t Size)
 {
-    size_t Utf16Count = 0;
-    size_t i          = 0;
+    // Use UTF-8 as default encoding
+    return KStringCreatePersistentWithEncoding(pStr, Size, KSTRING_ENCODING_UTF8);
+}
 
-    while (i < Utf8Size && Utf16Count < MaxUtf16Size - 1)
+KString KStringCreatePersistentWithEncoding(const char* pStr, const size_t Size, const KStringEncoding Encoding)
+{
+    if (NULL == pStr)
     {
-        uint32_t CodePoint = 0;
-        size_t   BytesRead = 0;
-
-        uint8_t FirstByte = (uint8_t)pUtf8[i];
+        return KStringInvalid();
+    }
+
+    KString Result;
+    Result.Size = KS_CreateSizeField(Size, Encoding);
+
+    if (KSTRING_INVALID_LENGTH == Result.Size)
+    {
+        return KStringInvalid();
+    }
+
+    if (KS_IsShortString(Size))
+    {
+        // Short strings are always persistent (no pointer needed)
+        memcpy(Result.Content, pStr, Size);
+        if (Size < KSTRING_MAX_SHORT_LENGTH)
+        {
+            memset(Result.Content + Size, 0, KSTRING_MAX_SHORT_LENGTH - Size);
+        }
+    }
+    else
+    {
+        // Long persistent string: point directly to source (no allocation)
+        // Store first 4 characters as prefix (safe copy with bounds checking)
+        size_t PrefixSize = (Size >= 4) ? 4 : Size;
+        memcpy(Result.LongStr.Prefix, pStr, PrefixSize);
+        if (PrefixSize < 4)
+        {
+            memset(Result.LongStr.Prefix + PrefixSize, 0, 4 - PrefixSize);
+        }
+        Result.LongStr.PtrAndClass = KS_CreateTaggedPointer((void*)pStr, KSTRING_PERSISTENT);
+    }
+
+    return Result;
+}
+
+KString KStringCreateTransient(const char* pStr, const size_t Size)
+{
+    // Use UTF-8 as default encoding
+    return KStringCreateTransientWithEncoding(pStr, Size, KSTRING_ENCODING_UTF8);
+}
+
+KString KStringCreateTransientView(const char* pStr, const size_t Size)
+{
+    KString Result = KStringCreateTransientWithEncoding(pStr, Size, KSTRING_ENCODING_UTF8);
+    if (true == KStringIsValid(Result) && false == KStringIsShort(Result))
+    {
+        Result.LongStr.PtrAndClass |= KSTRING_VIEW_FLAG;
+    }
+
+    return Result;
+}
+
+KString KStringCreateTransientWithEncoding(const char* pStr, const size_t Size, const KStringEncoding Encoding)
+{
+    if (NULL == pStr)
+    {
+        return KStringInvalid();
+    }
+
+    KString Result;
+    Result.Size = KS_CreateSizeField(Size, Encoding);
+
+    if (KSTRING_INVALID_LENGTH == Result.Size)
+    {
+        return KStringInvalid();
+    }
+
+    if (KS_IsShortString(Size))
+    {
+        // Short string: copy inline
+        memcpy(Result.Content, pStr, Size);
+        if (Size < KSTRING_MAX_SHORT_LENGTH)
+        {
+            memset(Result.Content + Size, 0, KSTRING_MAX_SHORT_LENGTH - Size);
+        }
+    }
+    else
+    {
+        // Long transient string: point directly to source
+        // Store first 4 characters as prefix (safe copy with bounds checking)
+        size_t PrefixSize = (Size >= 4) ? 4 : Size;
+        memcpy(Result.LongStr.Prefix, pStr, PrefixSize);
+        if (PrefixSize < 4)
+        {
+            memset(Result.LongStr.Prefix + PrefixSize, 0, 4 - PrefixSize);
+        }
+        Result.LongStr.PtrAndClass = KS_CreateTaggedPointer((void*)pStr, KSTRING_TRANSIENT);
+    }
+
+    return Result;
+}
+
+KString KStringCreateRelocatable(const uint8_t RegionId, const size_t Offset, const size_t Size)
+{
+    // Use UTF-8 as default encoding
+    return KStringCreateRelocatableWithEncoding(RegionId, Offset, Size, KSTRING_ENCODING_UTF8);
+}
+
+KString KStringCreateRelocatableWithEncoding(const uint8_t RegionId, const size_t Offset, const size_t Size, const KStringEncoding Encoding)
+{
+    const KS_Region* pRegion = &KS_Regions[RegionId];
+    if (NULL == pRegion->pBase)
+    {
+        return KStringInvalid();
+    }
+
+    // Validate range against region bounds (security check)
+    if (Offset > pRegion->Size || Size > pRegion->Size - Offset || Offset > KSTRING_OFFSET_MASK)
+    {
+        return KStringInvalid();
+    }
+
+    const char* pStr = pRegion->pBase + Offset;
+
+    KString Result;
+    Result.Size = KS_CreateSizeField(Size, Encoding);
+
+    if (KSTRING_INVALID_LENGTH == Result.Size)
+    {
+        return KStringInvalid();
+    }
+
+    if (KS_IsShortString(Size))
+    {
+        // Short strings are position-independent by design: copy inline
+        memcpy(Result.Content, pStr, Size);
+        if (Size < KSTRING_MAX_SHORT_LENGTH)
+        {
+            memset(Result.Content + Size, 0, KSTRING_MAX_SHORT_LENGTH - Size);
+        }
+    }
+    else
+    {
+        // Long relocatable string: store prefix and region offset (no pointer)
+        memcpy(Result.LongStr.Prefix, pStr, 4);
+        Result.LongStr.PtrAndClass = KS_CreateTaggedOffset(RegionId, Offset);
+    }
+
+    return Result;
+}
+
+//
+// Convenience Functions for Null-Terminated Strings (less secure)
+//
+
+KString KStringCreateFromCStr(const char* pStr)
+{
+    if (NULL == pStr)
+    {
+        return KStringInvalid();
+    }
+
+    size_t Size = strlen(pStr);
+    return KStringCreate(pStr, Size);
+}
+
+KString KStringCreatePersistentFromCStr(const char* pStr)
+{
+    if (NULL == pStr)
+    {
+        return KStringInvalid();
+    }
+
+    size_t Size = strlen(pStr);
+    return KStringCreatePersistent(pStr, Size);
+}
+
+void KStringDestroy(const KString Str)
+{
+    // Only temporary long strings need cleanup
+    if (false == KStringIsShort(Str))
+    {
+        KStringStorageClass StorageClass = KS_GetStorageClass(Str.LongStr.PtrAndClass);
+        if (true == KS_IsRope(Str.LongStr.PtrAndClass))
+        {
+            KS_RopeRelease(KS_GetRopeNode(Str.LongStr.PtrAndClass));
+        }
+        else if (true == KS_IsLargeField(Str.Size) && KSTRING_TEMPORARY == StorageClass)
+        {
+            KS_LargeHeader* pHeader = KS_GetLargeHeader(Str.LongStr.PtrAndClass);
+            KS_Release((void**)&pHeader);
+        }
+        else if (KSTRING_TEMPORARY == StorageClass)
+        {
+            void* pData = KS_GetPointer(Str.LongStr.PtrAndClass);
+            KS_Release((void**)&pData);
+        }
+    }
+}
+
+//
+// Arena Operations
+//
+
+// Arena chunk header, followed by chunk payload
+typedef struct KS_ArenaChunk
+{
+    struct KS_ArenaChunk* pNext;    // Previously filled chunk
+    size_t                Capacity; // Payload size in bytes
+    size_t                Used;     // Bytes handed out from payload
+} KS_ArenaChunk;
+
+struct KStringArena
+{
+    KS_ArenaChunk* pHead;     // Current chunk (allocations are served from here)
+    size_t         ChunkSize; // Default payload size for new chunks
+};
+
+// Default chunk payload size for arenas
+#define KSTRING_ARENA_CHUNK_SIZE (64 * 1024)
+
+// Allocate a new chunk able to hold at least MinSize bytes
+static KS_ArenaChunk* KS_ArenaNewChunk(KStringArena* pArena, size_t MinSize)
+{
+    size_t Capacity = (MinSize > pArena->ChunkSize) ? MinSize : pArena->ChunkSize;
+    if (Capacity > SIZE_MAX - sizeof(KS_ArenaChunk))
+    {
+        return NULL;
+    }
+
+    KS_ArenaChunk* pChunk = malloc(sizeof(KS_ArenaChunk) + Capacity);
+    if (NULL == pChunk)
+    {
+        return NULL;
+    }
+
+    pChunk->pNext    = pArena->pHead;
+    pChunk->Capacity = Capacity;
+    pChunk->Used     = 0;
+    pArena->pHead    = pChunk;
+    return pChunk;
+}
+
+KStringArena* KStringArenaCreate(const size_t ChunkSize)
+{
+    KStringArena* pArena = malloc(sizeof(KStringArena));
+    if (NULL == pArena)
+    {
+        return NULL;
+    }
+
+    pArena->pHead     = NULL;
+    pArena->ChunkSize = (0 != ChunkSize) ? ChunkSize : KSTRING_ARENA_CHUNK_SIZE;
+    return pArena;
+}
+
+void* KStringArenaAlloc(KStringArena* pArena, const size_t Size)
+{
+    if (NULL == pArena || 0 == Size || Size > SIZE_MAX - KSTRING_ALIGNMENT)
+    {
+        return NULL;
+    }
+
+    // Round up to next 8-byte boundary (same policy as KS_Alloc)
+    size_t AlignedSize = (Size + KSTRING_ALIGNMENT - 1) & ~(KSTRING_ALIGNMENT - 1);
+
+    KS_ArenaChunk* pChunk = pArena->pHead;
+    if (NULL == pChunk || AlignedSize > pChunk->Capacity - pChunk->Used)
+    {
+        pChunk = KS_ArenaNewChunk(pArena, AlignedSize);
+        if (NULL == pChunk)
+        {
+            return NULL;
+        }
+    }
+
+    void* pData   = (char*)(pChunk + 1) + pChunk->Used;
+    pChunk->Used += AlignedSize;
+    return pData;
+}
+
+// Grow an arena allocation, extending in place if it is the most recent one (private function)
+static void* KS_ArenaGrow(KStringArena* pArena, void* pOld, size_t OldSize, size_t NewSize)
+{
+    KS_ArenaChunk* pChunk = pArena->pHead;
+    if (NULL != pOld && NULL != pChunk && NewSize <= SIZE_MAX - KSTRING_ALIGNMENT)
+    {
+        char*  pChunkData   = (char*)(pChunk + 1);
+        size_t OldAligned   = (OldSize + KSTRING_ALIGNMENT - 1) & ~(KSTRING_ALIGNMENT - 1);
+        size_t NewAligned   = (NewSize + KSTRING_ALIGNMENT - 1) & ~(KSTRING_ALIGNMENT - 1);
+        bool   IsMostRecent = ((char*)pOld + OldAligned == pChunkData + pChunk->Used);
+
+        if (true == IsMostRecent && NewAligned - OldAligned <= pChunk->Capacity - pChunk->Used)
+        {
+            pChunk->Used += NewAligned - OldAligned;
+            return pOld;
+        }
+    }
+
+    void* pNew = KStringArenaAlloc(pArena, NewSize);
+    if (NULL != pNew && NULL != pOld)
+    {
+        memcpy(pNew, pOld, OldSize);
+    }
+    return pNew;
+}
+
+KString KStringArenaCreateString(KStringArena* pArena, const char* pStr, const size_t Size, const KStringEncoding Encoding)
+{
+    if (NULL == pArena || NULL == pStr)
+    {
+        return KStringInvalid();
+    }
+
+    if (KS_IsShortString(Size))
+    {
+        // Short strings never touch the arena
+        return KStringCreateTransientWithEncoding(pStr, Size, Encoding);
+    }
+
+    char* pData = KStringArenaAlloc(pArena, Size + 1); // +1 for null terminator
+    if (NULL == pData)
+    {
+        return KStringInvalid();
+    }
+
+    memcpy(pData, pStr, Size);
+    pData[Size] = '\0';
+
+    // Arena memory is released with the arena: hand out TRANSIENT strings
+    return KStringCreateTransientWithEncoding(pData, Size, Encoding);
+}
+
+void KStringArenaReset(KStringArena* pArena)
+{
+    if (NULL == pArena || NULL == pArena->pHead)
+    {
+        return;
+    }
+
+    // Keep the most recent chunk for reuse, release all others
+    KS_ArenaChunk* pChunk = pArena->pHead->pNext;
+    while (NULL != pChunk)
+    {
+        KS_ArenaChunk* pNext = pChunk->pNext;
+        free(pChunk);
+        pChunk = pNext;
+    }
+
+    pArena->pHead->pNext = NULL;
+    pArena->pHead->Used  = 0;
+}
+
+void KStringArenaDestroy(KStringArena* pArena)
+{
+    if (NULL == pArena)
+    {
+        return;
+    }
+
+    KS_ArenaChunk* pChunk = pArena->pHead;
+    while (NULL != pChunk)
+    {
+        KS_ArenaChunk* pNext = pChunk->pNext;
+        free(pChunk);
+        pChunk = pNext;
+    }
+
+    free(pArena);
+}
+
+//
+// Builder Operations
+//
+
+// Minimum builder capacity on first growth
+#define KSTRING_BUILDER_MIN_CAPACITY 32
+
+// Grow builder so that Additional more bytes fit (geometric growth, amortized O(1) appends)
+static bool KS_BuilderGrow(KStringBuilder* pBuilder, size_t Additional)
+{
+    if (true == pBuilder->Failed)
+    {
+        return false;
+    }
+
+    if (Additional <= pBuilder->Capacity - pBuilder->Size)
+    {
+        return true;
+    }
+
+    if (Additional > KSTRING_MAX_REGULAR_SIZE - pBuilder->Size)
+    {
+        pBuilder->Failed = true;
+        return false; // Result would exceed maximum string size
+    }
+
+    size_t Required    = pBuilder->Size + Additional;
+    size_t NewCapacity = (pBuilder->Capacity > KSTRING_MAX_REGULAR_SIZE / 2) ? KSTRING_MAX_REGULAR_SIZE : pBuilder->Capacity * 2;
+    if (NewCapacity < Required)
+    {
+        NewCapacity = Required;
+    }
+    if (NewCapacity < KSTRING_BUILDER_MIN_CAPACITY)
+    {
+        NewCapacity = KSTRING_BUILDER_MIN_CAPACITY;
+    }
+
+    // +1 keeps room for the null terminator written by KStringBuilderFinish
+    char* pBuffer = (NULL != pBuilder->pArena) ? KS_ArenaGrow(pBuilder->pArena, pBuilder->pBuffer, pBuilder->Capacity + 1, NewCapacity + 1)
+                                               : KS_Realloc(pBuilder->pBuffer, NewCapacity + 1);
+    if (NULL == pBuffer)
+    {
+        pBuilder->Failed = true;
+        return false;
+    }
+
+    pBuilder->pBuffer  = pBuffer;
+    pBuilder->Capacity = NewCapacity;
+    return true;
+}
+
+void KStringBuilderInit(KStringBuilder* pBuilder, const KStringEncoding Encoding, KStringArena* pArena)
+{
+    if (NULL == pBuilder)
+    {
+        return;
+    }
+
+    pBuilder->pBuffer  = NULL;
+    pBuilder->Size     = 0;
+    pBuilder->Capacity = 0;
+    pBuilder->Encoding = Encoding;
+    pBuilder->pArena   = pArena;
+    pBuilder->Failed   = false;
+}
+
+bool KStringBuilderReserve(KStringBuilder* pBuilder, const size_t Capacity)
+{
+    if (NULL == pBuilder)
+    {
+        return false;
+    }
+
+    return (Capacity <= pBuilder->Size) ? (false == pBuilder->Failed) : KS_BuilderGrow(pBuilder, Capacity - pBuilder->Size);
+}
+
+bool KStringBuilderAppendBytes(KStringBuilder* pBuilder, const char* pData, const size_t Size)
+{
+    if (NULL == pBuilder || (NULL == pData && 0 != Size))
+    {
+        return false;
+    }
+
+    if (false == KS_BuilderGrow(pBuilder, Size))
+    {
+        return false;
+    }
+
+    if (0 != Size)
+    {
+        memcpy(pBuilder->pBuffer + pBuilder->Size, pData, Size);
+        pBuilder->Size += Size;
+    }
+
+    return true;
+}
+
+bool KStringBuilderAppend(KStringBuilder* pBuilder, const KString Str)
+{
+    // Invalid strings and payloads that cannot be resolved poison the builder
+    const char* pData = (true == KStringIsValid(Str)) ? KS_GetData(&Str) : NULL;
+    if (NULL == pData)
+    {
+        if (NULL != pBuilder)
+        {
+            pBuilder->Failed = true;
+        }
+        return false;
+    }
+
+    return KStringBuilderAppendBytes(pBuilder, pData, KS_GetSize(&Str));
+}
+
+bool KStringBuilderAppendUInt(KStringBuilder* pBuilder, const uint64_t Value)
+{
+    // Write digits backwards into a local buffer (20 digits max for 64-bit)
+    char     Digits[20];
+    size_t   Count     = 0;
+    uint64_t Remaining = Value;
+    do
+    {
+        Digits[sizeof(Digits) - 1 - Count++]  = (char)('0' + (Remaining % 10));
+        Remaining                            /= 10;
+    } while (0 != Remaining);
+
+    return KStringBuilderAppendBytes(pBuilder, Digits + sizeof(Digits) - Count, Count);
+}
+
+bool KStringBuilderAppendInt(KStringBuilder* pBuilder, const int64_t Value)
+{
+    if (Value < 0)
+    {
+        if (false == KStringBuilderAppendBytes(pBuilder, "-", 1))
+        {
+            return false;
+        }
+
+        // Negate in unsigned arithmetic (INT64_MIN has no positive counterpart)
+        return KStringBuilderAppendUInt(pBuilder, (uint64_t)0 - (uint64_t)Value);
+    }
+
+    return KStringBuilderAppendUInt(pBuilder, (uint64_t)Value);
+}
+
+bool KStringBuilderAppendFormat(KStringBuilder* pBuilder, const char* pFormat, ...)
+{
+    if (NULL == pBuilder || NULL == pFormat || true == pBuilder->Failed)
+    {
+        return false;
+    }
+
+    // First attempt: format straight into the spare capacity
+    va_list Arguments;
+    va_start(Arguments, pFormat);
+    size_t Spare   = pBuilder->Capacity - pBuilder->Size;
+    char*  pOutput = (NULL != pBuilder->pBuffer) ? pBuilder->pBuffer + pBuilder->Size : NULL;
+    int    Length  = vsnprintf(pOutput, (NULL != pOutput) ? Spare + 1 : 0, pFormat, Arguments);
+    va_end(Arguments);
+
+    if (Length < 0)
+    {
+        pBuilder->Failed = true;
+        return false;
+    }
+
+    if ((size_t)Length > Spare)
+    {
+        // Output did not fit: grow and format again
+        if (false == KS_BuilderGrow(pBuilder, (size_t)Length))
+        {
+            return false;
+        }
+
+        va_start(Arguments, pFormat);
+        vsnprintf(pBuilder->pBuffer + pBuilder->Size, (size_t)Length + 1, pFormat, Arguments);
+        va_end(Arguments);
+    }
+
+    pBuilder->Size += (size_t)Length;
+    return true;
+}
+
+KString KStringBuilderFinish(KStringBuilder* pBuilder)
+{
+    if (NULL == pBuilder || true == pBuilder->Failed)
+    {
+        KStringBuilderDestroy(pBuilder);
+        return KStringInvalid();
+    }
+
+    KString Result;
+    Result.Size = KS_CreateSizeField(pBuilder->Size, pBuilder->Encoding);
+
+    if (KS_IsShortString(pBuilder->Size))
+    {
+        // Short result: inline it and drop the buffer
+        memset(Result.Content, 0, KSTRING_MAX_SHORT_LENGTH);
+        if (0 != pBuilder->Size)
+        {
+            memcpy(Result.Content, pBuilder->pBuffer, pBuilder->Size);
+        }
+        KStringBuilderDestroy(pBuilder);
+        return Result;
+    }
+
+    // Long result: hand the buffer over without copying
+    pBuilder->pBuffer[pBuilder->Size] = '\0';
+    memcpy(Result.LongStr.Prefix, pBuilder->pBuffer, 4);
+
+    // Arena memory is released with the arena: TRANSIENT, heap buffer is owned by the string: TEMPORARY
+    KStringStorageClass StorageClass = (NULL != pBuilder->pArena) ? KSTRING_TRANSIENT : KSTRING_TEMPORARY;
+    Result.LongStr.PtrAndClass       = KS_CreateTaggedPointer(pBuilder->pBuffer, StorageClass);
+
+    // Validate tagged pointer creation (security check), the buffer is released like on any other failure
+    if (0 == Result.LongStr.PtrAndClass)
+    {
+        KStringBuilderDestroy(pBuilder);
+        return KStringInvalid();
+    }
+
+    // Builder is empty again (buffer now belongs to the result)
+    KStringBuilderInit(pBuilder, pBuilder->Encoding, pBuilder->pArena);
+    return Result;
+}
+
+void KStringBuilderDestroy(KStringBuilder* pBuilder)
+{
+    if (NULL == pBuilder)
+    {
+        return;
+    }
+
+    // Arena-backed buffers are released with the arena
+    if (NULL == pBuilder->pArena)
+    {
+        KS_Release((void**)&pBuilder->pBuffer);
+    }
+
+    KStringBuilderInit(pBuilder, pBuilder->Encoding, pBuilder->pArena);
+}
+
+//
+// Streaming Writer Operations (strings of any size, including large strings)
+//
+
+// Minimum writer capacity on first growth
+#define KSTRING_WRITER_MIN_CAPACITY 4096
+
+// Grow writer so that Additional more bytes fit (geometric growth, header space stays in front)
+static bool KS_WriterGrow(KStringWriter* pWriter, size_t Additional)
+{
+    if (true == pWriter->Failed)
+    {
+        return false;
+    }
+
+    if (Additional <= pWriter->Capacity - pWriter->Size)
+    {
+        return true;
+    }
+
+    size_t Limit = SIZE_MAX / 2 - sizeof(KS_LargeHeader);
+    if (Additional > Limit - pWriter->Size)
+    {
+        pWriter->Failed = true;
+        return false;
+    }
+
+    size_t Required    = pWriter->Size + Additional;
+    size_t NewCapacity = pWriter->Capacity * 2;
+    if (NewCapacity < Required)
+    {
+        NewCapacity = Required;
+    }
+    if (NewCapacity < KSTRING_WRITER_MIN_CAPACITY)
+    {
+        NewCapacity = KSTRING_WRITER_MIN_CAPACITY;
+    }
+
+    char* pNewBlock = KS_Realloc(pWriter->pBlock, sizeof(KS_LargeHeader) + NewCapacity + 1); // +1 for null terminator
+    if (NULL == pNewBlock)
+    {
+        pWriter->Failed = true;
+        return false;
+    }
+
+    pWriter->pBlock   = pNewBlock;
+    pWriter->Capacity = NewCapacity;
+    return true;
+}
+
+bool KStringWriterBegin(KStringWriter* pWriter, const KStringEncoding Encoding, const size_t SizeHint)
+{
+    if (NULL == pWriter)
+    {
+        return false;
+    }
+
+    pWriter->pBlock   = NULL;
+    pWriter->Size     = 0;
+    pWriter->Capacity = 0;
+    pWriter->Encoding = Encoding;
+    pWriter->Failed   = false;
+
+    return 0 == SizeHint || true == KS_WriterGrow(pWriter, SizeHint);
+}
+
+bool KStringWriterWrite(KStringWriter* pWriter, const void* pData, const size_t Size)
+{
+    if (NULL == pWriter || (NULL == pData && 0 != Size))
+    {
+        return false;
+    }
+
+    if (false == KS_WriterGrow(pWriter, Size))
+    {
+        return false;
+    }
+
+    if (0 != Size)
+    {
+        memcpy(pWriter->pBlock + sizeof(KS_LargeHeader) + pWriter->Size, pData, Size);
+        pWriter->Size += Size;
+    }
+
+    return true;
+}
+
+KString KStringWriterFinish(KStringWriter* pWriter)
+{
+    if (NULL == pWriter || true == pWriter->Failed)
+    {
+        KStringWriterAbort(pWriter);
+        return KStringInvalid();
+    }
+
+    KString Result;
+    size_t  Size  = pWriter->Size;
+    char*   pData = pWriter->pBlock + sizeof(KS_LargeHeader);
+
+    if (KS_IsShortString(Size))
+    {
+        // Short result: inline it and drop the block
+        Result.Size = KS_CreateSizeField(Size, pWriter->Encoding);
+        memset(Result.Content, 0, KSTRING_MAX_SHORT_LENGTH);
+        if (0 != Size)
+        {
+            memcpy(Result.Content, pData, Size);
+        }
+        KStringWriterAbort(pWriter);
+        return Result;
+    }
+
+    char* pBlock = pWriter->pBlock;
+    if (Size >= KSTRING_LARGE_SIZE)
+    {
+        // Large result: the block already starts with header space
+        ((KS_LargeHeader*)pBlock)->Size     = Size;
+        ((KS_LargeHeader*)pBlock)->Reserved = 0;
+        pData[Size]                         = '\0';
+        Result.Size                         = KSTRING_LARGE_SIZE | ((uint32_t)pWriter->Encoding << KSTRING_ENCODING_SHIFT);
+    }
+    else
+    {
+        // Regular long result: move payload to the start of the block and trim it
+        memmove(pBlock, pData, Size);
+        pBlock[Size] = '\0';
+
+        char* pTrimmed = KS_Realloc(pBlock, Size + 1);
+        pBlock         = (NULL != pTrimmed) ? pTrimmed : pBlock;
+        pData          = pBlock;
+        Result.Size    = KS_CreateSizeField(Size, pWriter->Encoding);
+    }
+
+    memcpy(Result.LongStr.Prefix, pData, 4);
+    Result.LongStr.PtrAndClass = KS_CreateTaggedPointer(pData, KSTRING_TEMPORARY);
+
+    // Validate tagged pointer creation (security check), the (possibly trimmed) block is released
+    if (0 == Result.LongStr.PtrAndClass)
+    {
+        pWriter->pBlock = pBlock;
+        KStringWriterAbort(pWriter);
+        return KStringInvalid();
+    }
+
+    // Writer is empty again (block now belongs to the result)
+    pWriter->pBlock   = NULL;
+    pWriter->Size     = 0;
+    pWriter->Capacity = 0;
+    return Result;
+}
+
+void KStringWriterAbort(KStringWriter* pWriter)
+{
+    if (NULL == pWriter)
+    {
+        return;
+    }
+
+    KS_Release((void**)&pWriter->pBlock);
+    pWriter->Size     = 0;
+    pWriter->Capacity = 0;
+    pWriter->Failed   = false;
+}
+
+const char* KStringGetChunk(const KString* pStr, const size_t Offset, size_t* pChunkSize)
+{
+    if (NULL == pStr || NULL == pChunkSize || Offset >= KStringSize(*pStr))
+    {
+        return NULL;
+    }
+
+    size_t StrSize = KS_GetSize(pStr);
+
+    if (true == KStringIsShort(*pStr))
+    {
+        *pChunkSize = StrSize - Offset;
+        return pStr->Content + Offset;
+    }
+
+    if (false == KS_IsRope(pStr->LongStr.PtrAndClass))
+    {
+        const char* pData = KS_GetData(pStr);
+        *pChunkSize       = StrSize - Offset;
+        return (NULL != pData) ? pData + Offset : NULL;
+    }
+
+    // Ropes: hand out the leaf containing Offset (or the flattened buffer if already built)
+    const KS_RopeNode* pNode = KS_GetRopeNode(pStr->LongStr.PtrAndClass);
+    const char*        pFlat = atomic_load_explicit(&((KS_RopeNode*)pNode)->pFlat, memory_order_acquire);
+    if (NULL != pFlat)
+    {
+        *pChunkSize = StrSize - Offset;
+        return pFlat + Offset;
+    }
+
+    size_t LeafOffset = Offset;
+    while (0 != pNode->Depth)
+    {
+        if (LeafOffset < pNode->pLeft->Size)
+        {
+            pNode = pNode->pLeft;
+        }
+        else
+        {
+            LeafOffset -= pNode->pLeft->Size;
+            pNode       = pNode->pRight;
+        }
+    }
+
+    *pChunkSize = pNode->Size - LeafOffset;
+    return pNode->pData + LeafOffset;
+}
+
+size_t KStringCopyTo(const KString Str, const size_t Offset, char* pBuffer, const size_t Capacity)
+{
+    if (NULL == pBuffer)
+    {
+        return 0;
+    }
+
+    // Walk contiguous chunks (never flattens ropes)
+    size_t Copied = 0;
+    while (Copied < Capacity)
+    {
+        size_t      ChunkSize = 0;
+        const char* pChunk    = KStringGetChunk(&Str, Offset + Copied, &ChunkSize);
+        if (NULL == pChunk)
+        {
+            break;
+        }
+
+        size_t Count = (ChunkSize < Capacity - Copied) ? ChunkSize : Capacity - Copied;
+        memcpy(pBuffer + Copied, pChunk, Count);
+        Copied += Count;
+    }
+
+    return Copied;
+}
+
+//
+// Access Operations
+//
+
+const char* KStringCStr(const KString Str)
+{
+    if (false == KStringIsValid(Str))
+    {
+        return NULL;
+    }
+
+    if (KStringIsShort(Str))
+    {
+        // For short strings, we need to return a null-terminated copy
+        // Use rotating buffers to handle multiple calls in one expression
+        static __thread char ShortBuffers[4][KSTRING_MAX_SHORT_LENGTH + 1];
+        static __thread int  BufferIndex = 0;
+
+        char* Buffer = ShortBuffers[BufferIndex];
+        BufferIndex  = (BufferIndex + 1) % 4;
+
+        size_t Size = KS_GetSize(&Str);
+        memcpy(Buffer, Str.Content, Size);
+        Buffer[Size] = '\0';
+        return Buffer;
+    }
+    else
+    {
+        // Long strings are already null-terminated, except views ending inside their source
+        return (0 != (Str.LongStr.PtrAndClass & KSTRING_VIEW_FLAG)) ? NULL : KS_GetData(&Str);
+    }
+}
+
+const char* KStringData(const KString* pStr, size_t* pSize)
+{
+    const char* pData = (NULL != pStr && true == KStringIsValid(*pStr)) ? KS_GetData(pStr) : NULL;
+    if (NULL != pSize)
+    {
+        *pSize = (NULL != pData) ? KS_GetSize(pStr) : 0;
+    }
+
+    return pData;
+}
+
+size_t KStringSize(const KString Str)
+{
+    return KStringIsValid(Str) ? KS_GetSize(&Str) : 0;
+}
+
+KStringEncoding KStringGetEncoding(const KString Str)
+{
+    return KStringIsValid(Str) ? KS_GetEncodingFromField(Str.Size) : KSTRING_ENCODING_UTF8;
+}
+
+bool KStringIsShort(const KString Str)
+{
+    return KS_IsShortString(KS_GetSizeFromField(Str.Size));
+}
+
+bool KStringIsBorrowed(const KString Str)
+{
+    if (false == KStringIsValid(Str) || true == KStringIsShort(Str))
+    {
+        return false;
+    }
+
+    // Only TEMPORARY strings own their payload
+    return KSTRING_TEMPORARY != KS_GetStorageClass(Str.LongStr.PtrAndClass);
+}
+
+bool KStringIsLarge(const KString Str)
+{
+    return true == KStringIsValid(Str) && true == KS_IsLargeField(Str.Size);
+}
+
+bool KStringIsRope(const KString Str)
+{
+    if (false == KStringIsValid(Str) || true == KStringIsShort(Str))
+    {
+        return false;
+    }
+
+    return KS_IsRope(Str.LongStr.PtrAndClass);
+}
+
+int KStringByteAt(const KString Str, const size_t Index)
+{
+    if (false == KStringIsValid(Str) || Index >= KS_GetSize(&Str))
+    {
+        return -1;
+    }
+
+    if (true == KStringIsShort(Str))
+    {
+        return (unsigned char)Str.Content[Index];
+    }
+
+    if (false == KS_IsRope(Str.LongStr.PtrAndClass))
+    {
+        const char* pData = KS_GetData(&Str);
+        return (NULL != pData) ? (unsigned char)pData[Index] : -1;
+    }
+
+    // Descend the rope without flattening
+    const KS_RopeNode* pNode  = KS_GetRopeNode(Str.LongStr.PtrAndClass);
+    size_t             Offset = Index;
+    while (0 != pNode->Depth)
+    {
+        if (Offset < pNode->pLeft->Size)
+        {
+            pNode = pNode->pLeft;
+        }
+        else
+        {
+            Offset -= pNode->pLeft->Size;
+            pNode   = pNode->pRight;
+        }
+    }
+
+    return (unsigned char)pNode->pData[Offset];
+}
+
+bool KStringIsRelocatable(const KString Str)
+{
+    if (false == KStringIsValid(Str) || true == KStringIsShort(Str))
+    {
+        return false;
+    }
+
+    return KSTRING_RELOCATABLE == KS_GetStorageClass(Str.LongStr.PtrAndClass);
+}
+
+//
+// Base Region Registry
+//
+
+bool KStringRegisterRegion(const uint8_t RegionId, const void* pBase, const size_t Size)
+{
+    if (NULL == pBase)
+    {
+        return false;
+    }
+
+    // A slot held by another base stays with its owner: unregister first to move a region
+    if (NULL != KS_Regions[RegionId].pBase && (const char*)pBase != KS_Regions[RegionId].pBase)
+    {
+        return false;
+    }
+
+    KS_Regions[RegionId].pBase = (const char*)pBase;
+    KS_Regions[RegionId].Size  = Size;
+    return true;
+}
+
+void KStringUnregisterRegion(const uint8_t RegionId)
+{
+    KS_Regions[RegionId].pBase = NULL;
+    KS_Regions[RegionId].Size  = 0;
+}
+
+const void* KStringGetRegionBase(const uint8_t RegionId)
+{
+    return KS_Regions[RegionId].pBase;
+}
+
+bool KStringGetRelocation(const KString Str, uint8_t* pRegionId, size_t* pOffset)
+{
+    if (false == KStringIsRelocatable(Str) || NULL == pRegionId || NULL == pOffset)
+    {
+        return false;
+    }
+
+    uint64_t PtrAndClass = Str.LongStr.PtrAndClass;
+    *pRegionId           = (uint8_t)((PtrAndClass & KSTRING_REGION_MASK) >> KSTRING_REGION_SHIFT);
+    *pOffset             = (size_t)(PtrAndClass & KSTRING_OFFSET_MASK);
+    return true;
+}
+
+//
+// Comparison Operations
+//
+
+// Compare the first Size bytes of two strings chunk by chunk, so ropes are walked instead of flattened.
+// A payload that cannot be resolved (unregistered region) orders before one that can.
+static int KS_CompareBytes(const KString* pA, const KString* pB, const size_t Size)
+{
+    // Same payload (e.g. a string compared with itself or with a view at offset 0)
+    if (false == KStringIsShort(*pA) && false == KStringIsShort(*pB) && pA->LongStr.PtrAndClass == pB->LongStr.PtrAndClass)
+    {
+        return 0;
+    }
+
+    size_t Offset = 0;
+    while (Offset < Size)
+    {
+        size_t      ChunkA  = 0;
+        size_t      ChunkB  = 0;
+        const char* pChunkA = KStringGetChunk(pA, Offset, &ChunkA);
+        const char* pChunkB = KStringGetChunk(pB, Offset, &ChunkB);
+        if (NULL == pChunkA || NULL == pChunkB)
+        {
+            // Distinct unresolvable payloads are never equal (same payloads were handled above)
+            if (pChunkA == pChunkB)
+            {
+                return (pA->LongStr.PtrAndClass < pB->LongStr.PtrAndClass) ? -1 : 1;
+            }
+            return (NULL == pChunkA) ? -1 : 1;
+        }
+
+        size_t Count = (ChunkA < ChunkB) ? ChunkA : ChunkB;
+        Count        = (Count < Size - Offset) ? Count : Size - Offset;
+
+        int Result = memcmp(pChunkA, pChunkB, Count);
+        if (0 != Result)
+        {
+            return Result;
+        }
+        Offset += Count;
+    }
+
+    return 0;
+}
+
+int KStringCompare(const KString StrA, const KString StrB)
+{
+    // Extract actual sizes for comparison
+    size_t SizeA = KS_GetSize(&StrA);
+    size_t SizeB = KS_GetSize(&StrB);
+
+    // Fast path: compare lengths first
+    if (SizeA != SizeB)
+    {
+        return (SizeA < SizeB) ? -1 : 1;
+    }
+
+    // Same length - compare content
+    if (true == KStringIsShort(StrA) && true == KStringIsShort(StrB))
+    {
+        // Both short: direct memory comparison
+        return memcmp(StrA.Content, StrB.Content, SizeA);
+    }
+    else if (false == KStringIsShort(StrA) && false == KStringIsShort(StrB))
+    {
+        // Both long: compare prefixes first (fast path)
+        int PrefixCmp = memcmp(StrA.LongStr.Prefix, StrB.LongStr.Prefix, 4);
+        if (0 != PrefixCmp)
+        {
+            return PrefixCmp;
+        }
+    }
+
+    // Compare the payloads in place (ropes are not flattened)
+    return KS_CompareBytes(&StrA, &StrB, SizeA);
+}
+
+bool KStringEquals(const KString StrA, const KString StrB)
+{
+    return KStringCompare(StrA, StrB) == 0;
+}
+
+bool KStringStartsWith(const KString Str, const KString Prefix)
+{
+    // Extract actual sizes using helper functions (security fix)
+    size_t StrSize    = KS_GetSize(&Str);
+    size_t PrefixSize = KS_GetSize(&Prefix);
+
+    if (PrefixSize > StrSize)
+    {
+        return false;
+    }
+
+    if (0 == PrefixSize)
+    {
+        return true;
+    }
+
+    // Compare prefixes efficiently
+    if (true == KStringIsShort(Str) && true == KStringIsShort(Prefix))
+    {
+        return memcmp(Str.Content, Prefix.Content, PrefixSize) == 0;
+    }
+    else if (false == KStringIsShort(Str) && PrefixSize <= 4)
+    {
+        // Str is long: the stored prefix answers short prefixes
+        const char* pPrefixData = (true == KStringIsShort(Prefix)) ? Prefix.Content : Prefix.LongStr.Prefix;
+        return memcmp(Str.LongStr.Prefix, pPrefixData, PrefixSize) == 0;
+    }
+
+    // Compare the payloads in place (ropes are not flattened)
+    return KS_CompareBytes(&Str, &Prefix, PrefixSize) == 0;
+}
+
+//
+// Case-Insensitive Comparison Operations
+//
+
+// Compare by simple case folded code points, defined with the code point cursors below
+static int KS_CompareFolded(const KString* pA, const KString* pB, bool PrefixOnly);
+
+int KStringCompareIgnoreCase(const KString StrA, const KString StrB)
+{
+    bool ValidA = KStringIsValid(StrA);
+    bool ValidB = KStringIsValid(StrB);
+    if (false == ValidA || false == ValidB)
+    {
+        // Invalid strings order before valid ones
+        return (ValidA == ValidB) ? 0 : ((true == ValidA) ? 1 : -1);
+    }
+
+    return KS_CompareFolded(&StrA, &StrB, false);
+}
+
+bool KStringEqualsIgnoreCase(const KString StrA, const KString StrB)
+{
+    if (false == KStringIsValid(StrA) || false == KStringIsValid(StrB))
+    {
+        return KStringIsValid(StrA) == KStringIsValid(StrB);
+    }
+
+    // Identical bytes in the same encoding are equal in any case
+    if (KS_GetEncodingFromField(StrA.Size) == KS_GetEncodingFromField(StrB.Size) && true == KStringEquals(StrA, StrB))
+    {
+        return true;
+    }
+
+    return 0 == KS_CompareFolded(&StrA, &StrB, false);
+}
+
+bool KStringStartsWithIgnoreCase(const KString Str, const KString Prefix)
+{
+    if (false == KStringIsValid(Str) || false == KStringIsValid(Prefix))
+    {
+        return false;
+    }
+
+    return 0 == KS_CompareFolded(&Str, &Prefix, true);
+}
+
+//
+// String Operations
+//
+
+KString KStringConcat(const KString StrA, const KString StrB)
+{
+    // Appending to a rope keeps it a rope (no contiguous reallocation per append)
+    if (true == KStringIsRope(StrA) || true == KStringIsRope(StrB))
+    {
+        return KStringRopeConcat(StrA, StrB);
+    }
+
+    const KString Parts[2] = {StrA, StrB};
+    return KStringConcatN(Parts, 2);
+}
+
+KString KStringRopeConcat(const KString StrA, const KString StrB)
+{
+    if (false == KStringIsValid(StrA) || false == KStringIsValid(StrB))
+    {
+        return KStringInvalid();
+    }
+
+    // Check the size limit before building any nodes
+    if (KS_GetSize(&StrB) > KSTRING_MAX_REGULAR_SIZE - KS_GetSize(&StrA))
+    {
+        return KStringInvalid();
+    }
+
+    KS_RopeNode* pLeft  = KS_RopeFromString(&StrA);
+    KS_RopeNode* pRight = KS_RopeFromString(&StrB);
+    return KS_RopeToString(KS_RopeJoin(pLeft, pRight), KS_GetEncodingFromField(StrA.Size));
+}
+
+// Join parts with optional separator into exactly one allocation (none if the result is short)
+static KString KS_JoinParts(const KString* pParts, size_t Count, const KString* pSeparator)
+{
+    if (NULL == pParts && 0 != Count)
+    {
+        return KStringInvalid();
+    }
+
+    if (NULL != pSeparator && false == KStringIsValid(*pSeparator))
+    {
+        return KStringInvalid();
+    }
+
+    // First pass: validate inputs (payloads must resolve) and compute total size
+    size_t SeparatorSize = (NULL != pSeparator) ? KS_GetSize(pSeparator) : 0;
+    size_t TotalLength   = 0;
+    if (0 != SeparatorSize && Count > 1 && NULL == KS_GetData(pSeparator))
+    {
+        return KStringInvalid();
+    }
+
+    for (size_t i = 0; i < Count; ++i)
+    {
+        if (false == KStringIsValid(pParts[i]) || NULL == KS_GetData(&pParts[i]))
+        {
+            return KStringInvalid();
+        }
+
+        size_t PartSize = KS_GetSize(&pParts[i]) + ((i > 0) ? SeparatorSize : 0);
+
+        // Check for arithmetic overflow in addition (security check), results beyond 1GB become large strings
+        if (PartSize > SIZE_MAX - TotalLength)
+        {
+            return KStringInvalid();
+        }
+
+        TotalLength += PartSize;
+    }
+
+    // Use encoding from first part
+    KStringEncoding Encoding = (Count > 0) ? KS_GetEncodingFromField(pParts[0].Size) : KSTRING_ENCODING_UTF8;
+
+    KString Result;
+    char*   pBuffer = KS_PrepareString(&Result, TotalLength, Encoding);
+    if (NULL == pBuffer)
+    {
+        return KStringInvalid();
+    }
+
+    // Second pass: copy parts straight into the result payload
+    const char* pSeparatorData = NULL;
+    if (0 != SeparatorSize)
+    {
+        pSeparatorData = KS_GetData(pSeparator);
+    }
+
+    size_t Written = 0;
+    for (size_t i = 0; i < Count; ++i)
+    {
+        if (i > 0 && 0 != SeparatorSize)
+        {
+            memcpy(pBuffer + Written, pSeparatorData, SeparatorSize);
+            Written += SeparatorSize;
+        }
+
+        size_t      PartSize = KS_GetSize(&pParts[i]);
+        const char* pData    = KS_GetData(&pParts[i]);
+        if (0 != PartSize)
+        {
+            memcpy(pBuffer + Written, pData, PartSize);
+            Written += PartSize;
+        }
+    }
+
+    KS_FinishString(&Result, pBuffer);
+
+    // Concatenating validated UTF-8 yields valid UTF-8: record it so the result needs no revalidation
+    if (false == KStringIsShort(Result) && KSTRING_ENCODING_UTF8 == Encoding)
+    {
+        bool Valid = (0 == SeparatorSize || true == KS_IsKnownValidUtf8(pSeparator));
+        for (size_t i = 0; i < Count && true == Valid; ++i)
+        {
+            Valid = (0 == KS_GetSize(&pParts[i]) || true == KS_IsKnownValidUtf8(&pParts[i]));
+        }
+
+        if (true == Valid)
+        {
+            Result.LongStr.PtrAndClass |= KSTRING_UTF8_VALID_FLAG;
+        }
+    }
+
+    return Result;
+}
+
+KString KStringConcatN(const KString* pParts, const size_t Count)
+{
+    return KS_JoinParts(pParts, Count, NULL);
+}
+
+KString KStringJoin(const KString* pParts, const size_t Count, const KString Separator)
+{
+    return KS_JoinParts(pParts, Count, &Separator);
+}
+
+KString KStringSubstring(const KString Str, const size_t Offset, const size_t Size)
+{
+    if (false == KStringIsValid(Str))
+    {
+        return KStringInvalid();
+    }
+
+    size_t          StrSize  = KS_GetSize(&Str);
+    KStringEncoding Encoding = KS_GetEncodingFromField(Str.Size);
+
+    if (Offset >= StrSize)
+    {
+        return KStringInvalid();
+    }
+
+    // Create local copy for modification
+    size_t LocalSize = Size;
+
+    // Clamp size to available characters
+    if (LocalSize > StrSize - Offset)
+    {
+        LocalSize = StrSize - Offset;
+    }
+
+    // Ropes share every chunk fully covered by the range
+    if (true == KStringIsRope(Str))
+    {
+        KS_RopeNode* pNode = KS_GetRopeNode(Str.LongStr.PtrAndClass);
+        return KS_RopeToString(KS_RopeSlice(pNode, Offset, LocalSize), Encoding);
+    }
+
+    const char* pSourceData = KS_GetData(&Str);
+    if (NULL == pSourceData)
+    {
+        return KStringInvalid();
+    }
+
+    // Short results are inline, long results get their own payload (large if beyond the 30-bit Size field)
+    KString Result;
+    char*   pBuffer = KS_PrepareString(&Result, LocalSize, Encoding);
+    if (NULL == pBuffer)
+    {
+        return KStringInvalid();
+    }
+
+    memcpy(pBuffer, pSourceData + Offset, LocalSize);
+    KS_FinishString(&Result, pBuffer);
+    return Result;
+}
+
+//
+// Slice and Split Operations (zero-copy views)
+//
+
+// Create a non-owning slice of a long or short string
+// Short slices are copied inline, long slices point into the parent payload:
+// PERSISTENT parents yield PERSISTENT slices, RELOCATABLE parents keep their region, all others yield TRANSIENT views
+// Long slices that end before the parent payload does (or slice an unterminated view) are unterminated views themselves
+static KString KS_CreateSlice(const KString* pStr, const char* pData, size_t Offset, size_t Size)
+{
+    KStringEncoding Encoding = KS_GetEncodingFromField(pStr->Size);
+
+    if (KS_IsShortString(Size) || true == KStringIsShort(*pStr))
+    {
+        return KStringCreateTransientWithEncoding(pData + Offset, Size, Encoding);
+    }
+
+    uint64_t            PtrAndClass  = pStr->LongStr.PtrAndClass;
+    KStringStorageClass StorageClass = KS_GetStorageClass(PtrAndClass);
+    KString             Result       = (KSTRING_PERSISTENT == StorageClass) ? KStringCreatePersistentWithEncoding(pData + Offset, Size, Encoding)
+                                                                             : KStringCreateTransientWithEncoding(pData + Offset, Size, Encoding);
+    if (false == KStringIsValid(Result))
+    {
+        return Result;
+    }
+
+    if (KSTRING_RELOCATABLE == StorageClass)
+    {
+        // Keep the slice position-independent: same region, shifted offset
+        uint8_t RegionId           = (uint8_t)((PtrAndClass & KSTRING_REGION_MASK) >> KSTRING_REGION_SHIFT);
+        Result.LongStr.PtrAndClass = KS_CreateTaggedOffset(RegionId, (size_t)(PtrAndClass & KSTRING_OFFSET_MASK) + Offset);
+    }
+
+    if (Offset + Size < KS_GetSize(pStr) || 0 != (PtrAndClass & KSTRING_VIEW_FLAG))
+    {
+        Result.LongStr.PtrAndClass |= KSTRING_VIEW_FLAG;
+    }
+
+    return Result;
+}
+
+// Find next delimiter at or after Start (returns Size if not found)
+static size_t KS_FindDelimiter(const char* pData, size_t Size, size_t Start, const char* pDelimiter, size_t DelimiterSize, size_t Alignment)
+{
+    while (Start + DelimiterSize <= Size)
+    {
+        // memchr is the vectorized byte search of the C library (SSE2/AVX2/NEON)
+        const char* pMatch = memchr(pData + Start, pDelimiter[0], Size - Start - DelimiterSize + 1);
+        if (NULL == pMatch)
+        {
+            break;
+        }
+
+        size_t Position = (size_t)(pMatch - pData);
+
+        // Multi-byte delimiters: first byte matched, verify the remainder
+        // UTF-16 strings only match on code unit boundaries
+        if (0 == Position % Alignment && (1 == DelimiterSize || 0 == memcmp(pMatch + 1, pDelimiter + 1, DelimiterSize - 1)))
+        {
+            return Position;
+        }
+
+        Start = Position + 1;
+    }
+
+    return Size;
+}
+
+// Code unit size used to align delimiter matches
+inline static size_t KS_GetCodeUnitSize(KStringEncoding Encoding)
+{
+    return (KSTRING_ENCODING_UTF16LE == Encoding || KSTRING_ENCODING_UTF16BE == Encoding) ? sizeof(uint16_t) : 1;
+}
+
+void KStringSplitBegin(KStringSplitIterator* pIterator, const KString Str, const KString Delimiter)
+{
+    if (NULL == pIterator)
+    {
+        return;
+    }
+
+    pIterator->Source    = Str;
+    pIterator->Delimiter = Delimiter;
+    pIterator->Position  = 0;
+    pIterator->Done      = (false == KStringIsValid(Str) || false == KStringIsValid(Delimiter));
+}
+
+bool KStringSplitNext(KStringSplitIterator* pIterator, KString* pSlice)
+{
+    if (NULL == pIterator || NULL == pSlice || true == pIterator->Done)
+    {
+        return false;
+    }
+
+    const KString* pStr          = &pIterator->Source;
+    const KString* pDelim        = &pIterator->Delimiter;
+    size_t         StrSize       = KS_GetSize(pStr);
+    size_t         DelimiterSize = KS_GetSize(pDelim);
+    const char*    pData         = KS_GetData(pStr);
+    const char*    pDelimiter    = KS_GetData(pDelim);
+    if (NULL == pData || NULL == pDelimiter)
+    {
+        // Payload cannot be resolved: no slices
+        pIterator->Done = true;
+        return false;
+    }
+
+    // Empty delimiter: the whole string is a single slice
+    size_t End = StrSize;
+    if (0 != DelimiterSize)
+    {
+        End = KS_FindDelimiter(pData, StrSize, pIterator->Position, pDelimiter, DelimiterSize, KS_GetCodeUnitSize(KS_GetEncodingFromField(pStr->Size)));
+    }
+
+    *pSlice = KS_CreateSlice(pStr, pData, pIterator->Position, End - pIterator->Position);
+
+    if (End == StrSize)
+    {
+        pIterator->Done = true;
+    }
+    else
+    {
+        pIterator->Position = End + DelimiterSize;
+    }
+
+    return true;
+}
+
+size_t KStringSplit(const KString Str, const KString Delimiter, const KStringSplitCallback Callback, void* pContext)
+{
+    if (NULL == Callback)
+    {
+        return 0;
+    }
+
+    KStringSplitIterator Iterator;
+    KStringSplitBegin(&Iterator, Str, Delimiter);
+
+    size_t  Count = 0;
+    KString Slice;
+    while (true == KStringSplitNext(&Iterator, &Slice))
+    {
+        Count++;
+        if (false == Callback(Slice, pContext))
+        {
+            break;
+        }
+    }
+
+    return Count;
+}
+
+size_t KStringSplitInto(const KString Str, const KString Delimiter, KString* pSlices, const size_t Capacity)
+{
+    KStringSplitIterator Iterator;
+    KStringSplitBegin(&Iterator, Str, Delimiter);
+
+    // Count all slices, store as many as fit
+    size_t  Count = 0;
+    KString Slice;
+    while (true == KStringSplitNext(&Iterator, &Slice))
+    {
+        if (NULL != pSlices && Count < Capacity)
+        {
+            pSlices[Count] = Slice;
+        }
+        Count++;
+    }
+
+    return Count;
+}
+
+KString KStringSubstringView(const KString Str, const size_t Offset, const size_t Size)
+{
+    if (false == KStringIsValid(Str))
+    {
+        return KStringInvalid();
+    }
+
+    size_t StrSize = KS_GetSize(&Str);
+
+    if (Offset >= StrSize)
+    {
+        return KStringInvalid();
+    }
+
+    // Clamp size to available characters
+    size_t LocalSize = (Size > StrSize - Offset) ? StrSize - Offset : Size;
+
+    const char* pSourceData = KS_GetData(&Str);
+    if (NULL == pSourceData)
+    {
+        return KStringInvalid();
+    }
+
+    // Borrowed view: prefix is taken from the slice itself, payload stays with the parent
+    return KS_CreateSlice(&Str, pSourceData, Offset, LocalSize);
+}
+
+//
+// Validation Operations
+//
+
+bool KStringValidateUtf8(KString* pStr)
+{
+    if (NULL == pStr || false == KStringIsValid(*pStr) || KSTRING_ENCODING_UTF8 != KS_GetEncodingFromField(pStr->Size))
+    {
+        return false;
+    }
+
+    if (true == KStringIsShort(*pStr))
+    {
+        return KS_ValidateUtf8((const uint8_t*)pStr->Content, KS_GetSize(pStr));
+    }
+
+    // Validated before: skip the scan
+    if (true == KS_HasUtf8ValidFlag(pStr))
+    {
+        return true;
+    }
+
+    const uint8_t* pData = (const uint8_t*)KS_GetData(pStr);
+    if (NULL == pData || false == KS_ValidateUtf8(pData, KS_GetSize(pStr)))
+    {
+        return false;
+    }
+
+    pStr->LongStr.PtrAndClass |= KSTRING_UTF8_VALID_FLAG;
+    return true;
+}
+
+bool KStringIsValidatedUtf8(const KString Str)
+{
+    return true == KStringIsValid(Str) && true == KS_IsKnownValidUtf8(&Str);
+}
+
+KString KStringCreateValidated(const char* pStr, const size_t Size)
+{
+    // Validate the source first: invalid input never allocates
+    if (NULL == pStr || false == KS_ValidateUtf8((const uint8_t*)pStr, Size))
+    {
+        return KStringInvalid();
+    }
+
+    KString Result = KStringCreateWithEncoding(pStr, Size, KSTRING_ENCODING_UTF8);
+    if (true == KStringIsValid(Result) && false == KStringIsShort(Result))
+    {
+        Result.LongStr.PtrAndClass |= KSTRING_UTF8_VALID_FLAG;
+    }
+
+    return Result;
+}
+
+KString KStringCreateTransientValidated(const char* pStr, const size_t Size)
+{
+    if (NULL == pStr || false == KS_ValidateUtf8((const uint8_t*)pStr, Size))
+    {
+        return KStringInvalid();
+    }
+
+    KString Result = KStringCreateTransientWithEncoding(pStr, Size, KSTRING_ENCODING_UTF8);
+    if (true == KStringIsValid(Result) && false == KStringIsShort(Result))
+    {
+        Result.LongStr.PtrAndClass |= KSTRING_UTF8_VALID_FLAG;
+    }
+
+    return Result;
+}
+
+// Detect the encoding of raw text, *pBomSize receives the size of a byte order mark (0 if none)
+// *pValidUtf8 is set if the text after the BOM was validated as UTF-8
+static KStringEncoding KS_DetectEncoding(const uint8_t* pData, size_t Size, size_t* pBomSize, bool* pValidUtf8)
+{
+    *pValidUtf8 = false;
+
+    // Byte order marks (a UTF-32LE BOM starts like the UTF-16LE one and is taken as such)
+    if (Size >= 3 && 0xEF == pData[0] && 0xBB == pData[1] && 0xBF == pData[2])
+    {
+        *pBomSize = 3;
+        return KSTRING_ENCODING_UTF8;
+    }
+
+    *pBomSize = 2;
+    if (Size >= 2 && 0xFF == pData[0] && 0xFE == pData[1])
+    {
+        return KSTRING_ENCODING_UTF16LE;
+    }
+
+    if (Size >= 2 && 0xFE == pData[0] && 0xFF == pData[1])
+    {
+        return KSTRING_ENCODING_UTF16BE;
+    }
+
+    *pBomSize = 0;
+
+    // NUL bytes are rare in text but are the high byte of every ASCII character (spaces, digits, punctuation) in UTF-16
+    if (0 == Size % 2)
+    {
+        size_t Even;
+        size_t Odd;
+        size_t i = KS_SimdCountZeroBytes(pData, Size, &Even, &Odd);
+        for (; i < Size; i += 2)
+        {
+            Even += (0 == pData[i]);
+            Odd  += (0 == pData[i + 1]);
+        }
+
+        // Most zeros on one side and at least one unit in eight: little endian has the zero high byte second
+        size_t Units = Size / 2;
+        if (Odd > 4 * Even && Odd * 8 >= Units)
+        {
+            return KSTRING_ENCODING_UTF16LE;
+        }
+
+        if (Even > 4 * Odd && Even * 8 >= Units)
+        {
+            return KSTRING_ENCODING_UTF16BE;
+        }
+    }
+
+    if (true == KS_ValidateUtf8(pData, Size))
+    {
+        *pValidUtf8 = true;
+        return KSTRING_ENCODING_UTF8;
+    }
+
+    // Every byte sequence is valid Windows-1252
+    return KSTRING_ENCODING_ANSI;
+}
+
+// Create a string of the given storage class from raw text of unknown encoding, the BOM is skipped
+static KString KS_CreateDetectEncoding(const char* pStr, size_t Size, KStringStorageClass StorageClass)
+{
+    if (NULL == pStr)
+    {
+        return KStringInvalid();
+    }
+
+    size_t          BomSize;
+    bool            ValidUtf8;
+    KStringEncoding Encoding = KS_DetectEncoding((const uint8_t*)pStr, Size, &BomSize, &ValidUtf8);
+
+    KString Result;
+    switch (StorageClass)
+    {
+        case KSTRING_PERSISTENT:
+            Result = KStringCreatePersistentWithEncoding(pStr + BomSize, Size - BomSize, Encoding);
+            break;
+        case KSTRING_TRANSIENT:
+            Result = KStringCreateTransientWithEncoding(pStr + BomSize, Size - BomSize, Encoding);
+            break;
+        default:
+            Result = KStringCreateWithEncoding(pStr + BomSize, Size - BomSize, Encoding);
+            break;
+    }
+
+    // Detection already validated the text: record it like KStringCreateValidated does
+    if (true == ValidUtf8 && true == KStringIsValid(Result) && false == KStringIsShort(Result))
+    {
+        Result.LongStr.PtrAndClass |= KSTRING_UTF8_VALID_FLAG;
+    }
+
+    return Result;
+}
+
+KStringEncoding KStringDetectEncoding(const char* pStr, const size_t Size, size_t* pBomSize)
+{
+    size_t BomSize   = 0;
+    bool   ValidUtf8 = false;
+
+    KStringEncoding Encoding = (NULL == pStr) ? KSTRING_ENCODING_UTF8 : KS_DetectEncoding((const uint8_t*)pStr, Size, &BomSize, &ValidUtf8);
+    if (NULL != pBomSize)
+    {
+        *pBomSize = BomSize;
+    }
+
+    return Encoding;
+}
+
+KString KStringCreateDetectEncoding(const char* pStr, const size_t Size)
+{
+    return KS_CreateDetectEncoding(pStr, Size, KSTRING_TEMPORARY);
+}
+
+KString KStringCreatePersistentDetectEncoding(const char* pStr, const size_t Size)
+{
+    return KS_CreateDetectEncoding(pStr, Size, KSTRING_PERSISTENT);
+}
+
+KString KStringCreateTransientDetectEncoding(const char* pStr, const size_t Size)
+{
+    return KS_CreateDetectEncoding(pStr, Size, KSTRING_TRANSIENT);
+}
+
+//
+// Encoding Conversion Operations
+//
+
+// Replacement character for invalid input (U+FFFD)
+#define KSTRING_REPLACEMENT_CHARACTER 0xFFFD
+
+// Decode one UTF-8 sequence from Size > 0 bytes, returns bytes consumed
+// Invalid input decodes to U+FFFD and consumes its maximal subpart (Unicode recommended practice)
+inline static size_t KS_DecodeUtf8(const uint8_t* pData, size_t Size, uint32_t* pCodePoint)
+{
+    uint8_t Lead = pData[0];
+    if (Lead < 0x80)
+    {
+        *pCodePoint = Lead;
+        return 1;
+    }
+
+    *pCodePoint   = KSTRING_REPLACEMENT_CHARACTER;
+    size_t Length = KS_Utf8SequenceLength[Lead];
+    if (0 == Length || Size < 2)
+    {
+        return 1;
+    }
+
+    // Second byte range depends on the lead byte (same rules as KS_ValidateUtf8)
+    uint8_t Low  = (0xE0 == Lead) ? 0xA0 : (0xF0 == Lead) ? 0x90 : 0x80;
+    uint8_t High = (0xED == Lead) ? 0x9F : (0xF4 == Lead) ? 0x8F : 0xBF;
+    if (pData[1] < Low || pData[1] > High)
+    {
+        return 1;
+    }
+
+    uint32_t CodePoint = ((uint32_t)Lead & (0x7FU >> Length)) << 6 | (pData[1] & 0x3FU);
+    for (size_t k = 2; k < Length; ++k)
+    {
+        if (k >= Size || 0x80 != (pData[k] & 0xC0))
+        {
+            return k;
+        }
+        CodePoint = (CodePoint << 6) | (pData[k] & 0x3FU);
+    }
+
+    *pCodePoint = CodePoint;
+    return Length;
+}
+
+// Encode code point as UTF-8, returns bytes written (1-4)
+inline static size_t KS_EncodeUtf8(uint32_t CodePoint, uint8_t* pOutput)
+{
+    if (CodePoint < 0x80)
+    {
+        pOutput[0] = (uint8_t)CodePoint;
+        return 1;
+    }
+
+    if (CodePoint < 0x800)
+    {
+        pOutput[0] = (uint8_t)(0xC0 | (CodePoint >> 6));
+        pOutput[1] = (uint8_t)(0x80 | (CodePoint & 0x3F));
+        return 2;
+    }
+
+    if (CodePoint < 0x1'0000)
+    {
+        pOutput[0] = (uint8_t)(0xE0 | (CodePoint >> 12));
+        pOutput[1] = (uint8_t)(0x80 | ((CodePoint >> 6) & 0x3F));
+        pOutput[2] = (uint8_t)(0x80 | (CodePoint & 0x3F));
+        return 3;
+    }
+
+    pOutput[0] = (uint8_t)(0xF0 | (CodePoint >> 18));
+    pOutput[1] = (uint8_t)(0x80 | ((CodePoint >> 12) & 0x3F));
+    pOutput[2] = (uint8_t)(0x80 | ((CodePoint >> 6) & 0x3F));
+    pOutput[3] = (uint8_t)(0x80 | (CodePoint & 0x3F));
+    return 4;
+}
+
+// Get UTF-8 length of a code point
+inline static size_t KS_Utf8Length(uint32_t CodePoint)
+{
+    return (CodePoint < 0x80) ? 1 : (CodePoint < 0x800) ? 2 : (CodePoint < 0x1'0000) ? 3 : 4;
+}
+
+// Read/write UTF-16 code unit byte-wise (payloads are not necessarily 2-byte aligned)
+inline static uint32_t KS_ReadUtf16(const uint8_t* pData, bool BigEndian)
+{
+    return (true == BigEndian) ? ((uint32_t)pData[0] << 8) | pData[1] : (uint32_t)pData[0] | ((uint32_t)pData[1] << 8);
+}
+
+inline static void KS_WriteUtf16(uint8_t* pData, uint32_t Unit, bool BigEndian)
+{
+    pData[BigEndian ? 1 : 0] = (uint8_t)Unit;
+    pData[BigEndian ? 0 : 1] = (uint8_t)(Unit >> 8);
+}
+
+// Decode one code point from Count > 0 UTF-16 units, returns units consumed (lone surrogates decode to U+FFFD)
+inline static size_t KS_DecodeUtf16(const uint8_t* pData, size_t Count, bool BigEndian, uint32_t* pCodePoint)
+{
+    uint32_t Unit = KS_ReadUtf16(pData, BigEndian);
+    if (Unit - 0xD800 >= 0x800)
+    {
+        *pCodePoint = Unit;
+        return 1;
+    }
+
+    if (Unit <= 0xDBFF && Count >= 2)
+    {
+        uint32_t Low = KS_ReadUtf16(pData + 2, BigEndian);
+        if (Low - 0xDC00 < 0x400)
+        {
+            *pCodePoint = 0x1'0000 + ((Unit - 0xD800) << 10) + (Low - 0xDC00);
+            return 2;
+        }
+    }
+
+    *pCodePoint = KSTRING_REPLACEMENT_CHARACTER;
+    return 1;
+}
+
+// Encode code point as UTF-16, returns bytes written (2 or 4)
+inline static size_t KS_EncodeUtf16(uint32_t CodePoint, uint8_t* pOutput, bool BigEndian)
+{
+    if (CodePoint < 0x1'0000)
+    {
+        KS_WriteUtf16(pOutput, CodePoint, BigEndian);
+        return 2;
+    }
+
+    CodePoint -= 0x1'0000;
+    KS_WriteUtf16(pOutput, 0xD800 + (CodePoint >> 10), BigEndian);
+    KS_WriteUtf16(pOutput + 2, 0xDC00 + (CodePoint & 0x3FF), BigEndian);
+    return 4;
+}
+
+// Windows-1252 code points for 0x80-0x9F (all other bytes equal their Latin-1 code point)
+// Undefined bytes 0x81, 0x8D, 0x8F, 0x90 and 0x9D map to the C1 control of the same value, as on Windows
+static const uint16_t KS_Windows1252Table[32] = {
+    0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+    0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178,
+};
+
+// Map ANSI byte to code point
+inline static uint32_t KS_AnsiToCodePoint(uint8_t Byte)
+{
+    return (Byte - 0x80U < 0x20U) ? KS_Windows1252Table[Byte - 0x80] : Byte;
+}
+
+// Map code point to ANSI byte ('?' if unmappable)
+inline static uint8_t KS_CodePointToAnsi(uint32_t CodePoint)
+{
+    if (CodePoint < 0x80 || (CodePoint >= 0xA0 && CodePoint <= 0xFF))
+    {
+        return (uint8_t)CodePoint;
+    }
+
+    // Rare: reverse lookup in the 0x80-0x9F table
+    for (uint32_t i = 0; i < 32; ++i)
+    {
+        if (KS_Windows1252Table[i] == CodePoint)
+        {
+            return (uint8_t)(0x80 + i);
+        }
+    }
+
+    return (uint8_t)'?';
+}
+
+// Exact number of UTF-16 code units for UTF-8 input (validated input only needs the SIMD byte count)
+static size_t KS_Utf8ToUtf16Count(const uint8_t* pInput, size_t Size, bool Validated)
+{
+    if (true == Validated)
+    {
+        return KS_SimdUtf8ToUtf16Count(pInput, Size);
+    }
+
+    size_t Count = 0;
+    size_t i     = 0;
+    while (i < Size)
+    {
+        size_t Ascii  = KS_SimdAsciiPrefix(pInput + i, Size - i);
+        Count        += Ascii;
+        i            += Ascii;
+
+        while (i < Size && pInput[i] >= 0x80)
+        {
+            uint32_t CodePoint;
+            i     += KS_DecodeUtf8(pInput + i, Size - i, &CodePoint);
+            Count += (CodePoint >= 0x1'0000) ? 2 : 1;
+        }
+    }
+
+    return Count;
+}
+
+// Transcode UTF-8 to UTF-16 into a buffer of Capacity bytes, returns bytes written (SIZE_MAX if the output does not fit)
+// The size comes from a pre-pass that may trust the validated flag, so the capacity is enforced rather than assumed
+static size_t KS_TranscodeUtf8ToUtf16(const uint8_t* pInput, size_t Size, uint8_t* pOutput, size_t Capacity, bool BigEndian)
+{
+    uint8_t* pStart = pOutput;
+    size_t   i      = 0;
+    while (i < Size)
+    {
+        size_t Room     = (Capacity - (size_t)(pOutput - pStart)) / sizeof(uint16_t);
+        size_t Widened  = KS_SimdWidenAsciiToUtf16(pInput + i, (Size - i < Room) ? Size - i : Room, pOutput, BigEndian);
+        i              += Widened;
+        pOutput        += 2 * Widened;
+
+        // Scalar for one block, then try the ASCII kernel again
+        size_t End = (Size - i > 16) ? i + 16 : Size;
+        while (i < End)
+        {
+            uint32_t CodePoint;
+            i += KS_DecodeUtf8(pInput + i, Size - i, &CodePoint);
+            if (Capacity - (size_t)(pOutput - pStart) < ((CodePoint >= 0x1'0000) ? 4U : 2U))
+            {
+                return SIZE_MAX;
+            }
+            pOutput += KS_EncodeUtf16(CodePoint, pOutput, BigEndian);
+        }
+    }
+
+    return (size_t)(pOutput - pStart);
+}
+
+// Exact number of UTF-8 bytes for Count UTF-16 units
+static size_t KS_Utf16ToUtf8Length(const uint8_t* pInput, size_t Count, bool BigEndian)
+{
+    size_t Length = 0;
+    size_t i      = 0;
+    while (i < Count)
+    {
+        size_t BlockLength;
+        i      += KS_SimdUtf16ToUtf8Length(pInput + 2 * i, Count - i, BigEndian, &BlockLength);
+        Length += BlockLength;
+
+        size_t End = (Count - i > 8) ? i + 8 : Count;
+        while (i < End)
+        {
+            uint32_t CodePoint;
+            i      += KS_DecodeUtf16(pInput + 2 * i, Count - i, BigEndian, &CodePoint);
+            Length += KS_Utf8Length(CodePoint);
+        }
+    }
+
+    return Length;
+}
+
+// Transcode Count UTF-16 units to UTF-8 into an exactly sized output buffer
+static size_t KS_TranscodeUtf16ToUtf8(const uint8_t* pInput, size_t Count, uint8_t* pOutput, bool BigEndian)
+{
+    uint8_t* pStart = pOutput;
+    size_t   i      = 0;
+    while (i < Count)
+    {
+        size_t Narrowed  = KS_SimdNarrowUtf16ToAscii(pInput + 2 * i, Count - i, pOutput, BigEndian);
+        i               += Narrowed;
+        pOutput         += Narrowed;
+
+        size_t End = (Count - i > 8) ? i + 8 : Count;
+        while (i < End)
+        {
+            uint32_t CodePoint;
+            i       += KS_DecodeUtf16(pInput + 2 * i, Count - i, BigEndian, &CodePoint);
+            pOutput += KS_EncodeUtf8(CodePoint, pOutput);
+        }
+    }
+
+    return (size_t)(pOutput - pStart);
+}
+
+// Transcode ANSI to UTF-16 (one unit per byte, output is exactly 2 * Size bytes)
+static size_t KS_TranscodeAnsiToUtf16(const uint8_t* pInput, size_t Size, uint8_t* pOutput, bool BigEndian)
+{
+    uint8_t* pStart = pOutput;
+    size_t   i      = 0;
+    while (i < Size)
+    {
+        size_t Widened  = KS_SimdWidenAsciiToUtf16(pInput + i, Size - i, pOutput, BigEndian);
+        i              += Widened;
+        pOutput        += 2 * Widened;
+
+        size_t End = (Size - i > 16) ? i + 16 : Size;
+        for (; i < End; ++i, pOutput += 2)
+        {
+            KS_WriteUtf16(pOutput, KS_AnsiToCodePoint(pInput[i]), BigEndian);
+        }
+    }
+
+    return (size_t)(pOutput - pStart);
+}
+
+// Number of code points in Count UTF-16 units (every unit except the low half of a valid surrogate pair)
+static size_t KS_Utf16CodePointCount(const uint8_t* pInput, size_t Count, bool BigEndian)
+{
+    size_t CodePoints = 0;
+    size_t i          = 0;
+    while (i < Count)
+    {
+        size_t Units  = KS_SimdUtf16NonSurrogatePrefix(pInput + 2 * i, Count - i, BigEndian);
+        CodePoints   += Units;
+        i            += Units;
+
+        if (i < Count)
+        {
+            uint32_t CodePoint;
+            i += KS_DecodeUtf16(pInput + 2 * i, Count - i, BigEndian, &CodePoint);
+            ++CodePoints;
+        }
+    }
+
+    return CodePoints;
+}
+
+// Transcode Count UTF-16 units to ANSI (one byte per code point, '?' if unmappable)
+static size_t KS_TranscodeUtf16ToAnsi(const uint8_t* pInput, size_t Count, uint8_t* pOutput, bool BigEndian)
+{
+    uint8_t* pStart = pOutput;
+    size_t   i      = 0;
+    while (i < Count)
+    {
+        size_t Narrowed  = KS_SimdNarrowUtf16ToAscii(pInput + 2 * i, Count - i, pOutput, BigEndian);
+        i               += Narrowed;
+        pOutput         += Narrowed;
+
+        size_t End = (Count - i > 8) ? i + 8 : Count;
+        while (i < End)
+        {
+            uint32_t CodePoint;
+            i            += KS_DecodeUtf16(pInput + 2 * i, Count - i, BigEndian, &CodePoint);
+            *pOutput++    = KS_CodePointToAnsi(CodePoint);
+        }
+    }
+
+    return (size_t)(pOutput - pStart);
+}
+
+// Exact number of ANSI bytes for UTF-8 input (one per code point, invalid subparts become '?')
+static size_t KS_Utf8ToAnsiSize(const uint8_t* pInput, size_t Size, bool Validated)
+{
+    if (true == Validated)
+    {
+        return KS_SimdUtf8CodePointCount(pInput, Size);
+    }
+
+    size_t Count = 0;
+    size_t i     = 0;
+    while (i < Size)
+    {
+        size_t Ascii  = KS_SimdAsciiPrefix(pInput + i, Size - i);
+        Count        += Ascii;
+        i            += Ascii;
+
+        while (i < Size && pInput[i] >= 0x80)
+        {
+            uint32_t CodePoint;
+            i += KS_DecodeUtf8(pInput + i, Size - i, &CodePoint);
+            ++Count;
+        }
+    }
+
+    return Count;
+}
+
+// Transcode UTF-8 to ANSI into a buffer of Capacity bytes (ASCII runs are copied as a whole)
+// Returns bytes written, SIZE_MAX if the output does not fit (the size pre-pass may trust the validated flag)
+static size_t KS_TranscodeUtf8ToAnsi(const uint8_t* pInput, size_t Size, uint8_t* pOutput, size_t Capacity)
+{
+    uint8_t* pStart = pOutput;
+    size_t   i      = 0;
+    while (i < Size)
+    {
+        size_t Ascii = KS_SimdAsciiPrefix(pInput + i, Size - i);
+        if (Capacity - (size_t)(pOutput - pStart) < Ascii)
+        {
+            return SIZE_MAX;
+        }
+        memcpy(pOutput, pInput + i, Ascii);
+        i       += Ascii;
+        pOutput += Ascii;
+
+        while (i < Size && pInput[i] >= 0x80)
+        {
+            if (Capacity == (size_t)(pOutput - pStart))
+            {
+                return SIZE_MAX;
+            }
+
+            uint32_t CodePoint;
+            i          += KS_DecodeUtf8(pInput + i, Size - i, &CodePoint);
+            *pOutput++  = KS_CodePointToAnsi(CodePoint);
+        }
+    }
+
+    return (size_t)(pOutput - pStart);
+}
+
+// Exact number of UTF-8 bytes for ANSI input
+static size_t KS_AnsiToUtf8Size(const uint8_t* pInput, size_t Size)
+{
+    size_t Length = Size;
+    size_t i      = 0;
+    while (i < Size)
+    {
+        i += KS_SimdAsciiPrefix(pInput + i, Size - i);
+
+        // High bytes need one (Latin-1) or two (most of 0x80-0x9F) extra bytes
+        while (i < Size && pInput[i] >= 0x80)
+        {
+            Length += KS_Utf8Length(KS_AnsiToCodePoint(pInput[i])) - 1;
+            ++i;
+        }
+    }
+
+    return Length;
+}
+
+// Transcode ANSI to UTF-8 into an exactly sized output buffer (ASCII runs are copied as a whole)
+static size_t KS_TranscodeAnsiToUtf8(const uint8_t* pInput, size_t Size, uint8_t* pOutput)
+{
+    uint8_t* pStart = pOutput;
+    size_t   i      = 0;
+    while (i < Size)
+    {
+        size_t Ascii = KS_SimdAsciiPrefix(pInput + i, Size - i);
+        memcpy(pOutput, pInput + i, Ascii);
+        i       += Ascii;
+        pOutput += Ascii;
+
+        while (i < Size && pInput[i] >= 0x80)
+        {
+            pOutput += KS_EncodeUtf8(KS_AnsiToCodePoint(pInput[i]), pOutput);
+            ++i;
+        }
+    }
+
+    return (size_t)(pOutput - pStart);
+}
+
+// Check if encoding is UTF-16 (either byte order)
+inline static bool KS_IsUtf16(KStringEncoding Encoding)
+{
+    return KSTRING_ENCODING_UTF16LE == Encoding || KSTRING_ENCODING_UTF16BE == Encoding;
+}
+
+// Decode one code point in any encoding from Size > 0 bytes, returns bytes consumed
+// Invalid input decodes to U+FFFD, a trailing odd UTF-16 byte is consumed as U+FFFD
+inline static size_t KS_DecodeCodePoint(const uint8_t* pData, size_t Size, KStringEncoding Encoding, uint32_t* pCodePoint)
+{
+    switch (Encoding)
+    {
+        case KSTRING_ENCODING_UTF8:
+            return KS_DecodeUtf8(pData, Size, pCodePoint);
+        case KSTRING_ENCODING_ANSI:
+            *pCodePoint = KS_AnsiToCodePoint(pData[0]);
+            return 1;
+        default:
+            if (Size < 2)
+            {
+                *pCodePoint = KSTRING_REPLACEMENT_CHARACTER;
+                return Size;
+            }
+            return 2 * KS_DecodeUtf16(pData, Size / 2, KSTRING_ENCODING_UTF16BE == Encoding, pCodePoint);
+    }
+}
+
+// Get encoded length of a code point in any encoding
+inline static size_t KS_EncodedLength(uint32_t CodePoint, KStringEncoding Encoding)
+{
+    switch (Encoding)
+    {
+        case KSTRING_ENCODING_UTF8:
+            return KS_Utf8Length(CodePoint);
+        case KSTRING_ENCODING_ANSI:
+            return 1;
+        default:
+            return (CodePoint < 0x1'0000) ? 2 : 4;
+    }
+}
+
+// Encode code point in any encoding, returns bytes written
+inline static size_t KS_EncodeCodePoint(uint32_t CodePoint, KStringEncoding Encoding, uint8_t* pOutput)
+{
+    switch (Encoding)
+    {
+        case KSTRING_ENCODING_UTF8:
+            return KS_EncodeUtf8(CodePoint, pOutput);
+        case KSTRING_ENCODING_ANSI:
+            *pOutput = KS_CodePointToAnsi(CodePoint);
+            return 1;
+        default:
+            return KS_EncodeUtf16(CodePoint, pOutput, KSTRING_ENCODING_UTF16BE == Encoding);
+    }
+}
+
+// Size of the U+FFFD that stands for a trailing odd UTF-16 byte in the target encoding (0 if there is none)
+// Every conversion, size query, code point count and the streaming transcoder read that byte as U+FFFD
+inline static size_t KS_OddByteReplacementSize(size_t Size, KStringEncoding SourceEncoding, KStringEncoding TargetEncoding)
+{
+    return (true == KS_IsUtf16(SourceEncoding) && 0 != (Size & 1)) ? KS_EncodedLength(KSTRING_REPLACEMENT_CHARACTER, TargetEncoding) : 0;
+}
+
+// Check if Size > 0 bytes are the valid start of a sequence that continues beyond them
+static bool KS_IsIncompleteSequence(const uint8_t* pData, size_t Size, KStringEncoding Encoding)
+{
+    switch (Encoding)
+    {
+        case KSTRING_ENCODING_UTF8:
+        {
+            size_t Length = KS_Utf8SequenceLength[pData[0]];
+            if (Size >= Length)
+            {
+                return false;
+            }
+
+            // Decoding a valid prefix consumes all of it
+            uint32_t CodePoint;
+            return 1 == Size || KS_DecodeUtf8(pData, Size, &CodePoint) == Size;
+        }
+        case KSTRING_ENCODING_ANSI:
+            return false;
+        default:
+            // Odd byte or high surrogate waiting for its low half
+            return Size < 2 || (Size < 4 && KS_ReadUtf16(pData, KSTRING_ENCODING_UTF16BE == Encoding) - 0xD800 < 0x400);
+    }
+}
+
+// Get payload of a valid string with the expected encoding (NULL otherwise)
+static const uint8_t* KS_GetSourceData(const KString* pStr, KStringEncoding Encoding)
+{
+    if (false == KStringIsValid(*pStr) || KS_GetEncodingFromField(pStr->Size) != Encoding)
+    {
+        return NULL;
+    }
+
+    return (const uint8_t*)KS_GetData(pStr);
+}
+
+// UTF-8 -> UTF-16 (either byte order) in one pass, written straight into the result payload
+static KString KS_ConvertUtf8ToUtf16(const KString* pStr, bool BigEndian)
+{
+    const uint8_t* pUtf8Data = KS_GetSourceData(pStr, KSTRING_ENCODING_UTF8);
+    if (NULL == pUtf8Data)
+    {
+        return KStringInvalid();
+    }
+
+    // Pre-pass computes the exact size, so the output is written straight into the result payload
+    size_t Utf8Size   = KS_GetSize(pStr);
+    size_t Utf16Count = KS_Utf8ToUtf16Count(pUtf8Data, Utf8Size, KS_HasUtf8ValidFlag(pStr));
+    if (Utf16Count > SIZE_MAX / sizeof(uint16_t))
+    {
+        return KStringInvalid();
+    }
+
+    KString Result;
+    char*   pBuffer = KS_PrepareString(&Result, Utf16Count * sizeof(uint16_t), BigEndian ? KSTRING_ENCODING_UTF16BE : KSTRING_ENCODING_UTF16LE);
+    if (NULL == pBuffer)
+    {
+        return KStringInvalid();
+    }
+
+    // A stale or forged validated flag makes the pre-pass wrong: fail instead of writing past or short of the payload
+    size_t Utf16Size = Utf16Count * sizeof(uint16_t);
+    if (Utf16Size != KS_TranscodeUtf8ToUtf16(pUtf8Data, Utf8Size, (uint8_t*)pBuffer, Utf16Size, BigEndian))
+    {
+        KStringDestroy(Result);
+        return KStringInvalid();
+    }
+
+    KS_FinishString(&Result, pBuffer);
+    return Result;
+}
+
+// UTF-16 (either byte order) -> UTF-8 in one pass
+static KString KS_ConvertUtf16ToUtf8(const KString* pStr, bool BigEndian)
+{
+    const uint8_t* pUtf16Data = KS_GetSourceData(pStr, BigEndian ? KSTRING_ENCODING_UTF16BE : KSTRING_ENCODING_UTF16LE);
+    if (NULL == pUtf16Data)
+    {
+        return KStringInvalid();
+    }
+
+    size_t  Utf16Count = KS_GetSize(pStr) / sizeof(uint16_t);
+    size_t  Tail       = KS_OddByteReplacementSize(KS_GetSize(pStr), KS_GetEncodingFromField(pStr->Size), KSTRING_ENCODING_UTF8);
+    KString Result;
+    char*   pBuffer = KS_PrepareString(&Result, KS_Utf16ToUtf8Length(pUtf16Data, Utf16Count, BigEndian) + Tail, KSTRING_ENCODING_UTF8);
+    if (NULL == pBuffer)
+    {
+        return KStringInvalid();
+    }
+
+    size_t Written = KS_TranscodeUtf16ToUtf8(pUtf16Data, Utf16Count, (uint8_t*)pBuffer, BigEndian);
+    if (0 != Tail)
+    {
+        KS_EncodeUtf8(KSTRING_REPLACEMENT_CHARACTER, (uint8_t*)pBuffer + Written);
+    }
+    KS_FinishString(&Result, pBuffer);
+
+    // Lone surrogates and an odd trailing byte become U+FFFD, so the output is always valid UTF-8
+    if (false == KStringIsShort(Result))
+    {
+        Result.LongStr.PtrAndClass |= KSTRING_UTF8_VALID_FLAG;
+    }
+
+    return Result;
+}
+
+// ANSI -> UTF-16 (either byte order) in one pass
+static KString KS_ConvertAnsiToUtf16(const KString* pStr, bool BigEndian)
+{
+    const uint8_t* pAnsiData = KS_GetSourceData(pStr, KSTRING_ENCODING_ANSI);
+    if (NULL == pAnsiData)
+    {
+        return KStringInvalid();
+    }
+
+    size_t AnsiSize = KS_GetSize(pStr);
+    if (AnsiSize > SIZE_MAX / sizeof(uint16_t))
+    {
+        return KStringInvalid();
+    }
+
+    KString Result;
+    char*   pBuffer = KS_PrepareString(&Result, AnsiSize * sizeof(uint16_t), BigEndian ? KSTRING_ENCODING_UTF16BE : KSTRING_ENCODING_UTF16LE);
+    if (NULL == pBuffer)
+    {
+        return KStringInvalid();
+    }
+
+    KS_TranscodeAnsiToUtf16(pAnsiData, AnsiSize, (uint8_t*)pBuffer, BigEndian);
+    KS_FinishString(&Result, pBuffer);
+    return Result;
+}
+
+// UTF-16 (either byte order) -> ANSI in one pass
+static KString KS_ConvertUtf16ToAnsi(const KString* pStr, bool BigEndian)
+{
+    const uint8_t* pUtf16Data = KS_GetSourceData(pStr, BigEndian ? KSTRING_ENCODING_UTF16BE : KSTRING_ENCODING_UTF16LE);
+    if (NULL == pUtf16Data)
+    {
+        return KStringInvalid();
+    }
+
+    size_t  Utf16Count = KS_GetSize(pStr) / sizeof(uint16_t);
+    size_t  Tail       = KS_OddByteReplacementSize(KS_GetSize(pStr), KS_GetEncodingFromField(pStr->Size), KSTRING_ENCODING_ANSI);
+    KString Result;
+    char*   pBuffer = KS_PrepareString(&Result, KS_Utf16CodePointCount(pUtf16Data, Utf16Count, BigEndian) + Tail, KSTRING_ENCODING_ANSI);
+    if (NULL == pBuffer)
+    {
+        return KStringInvalid();
+    }
+
+    size_t Written = KS_TranscodeUtf16ToAnsi(pUtf16Data, Utf16Count, (uint8_t*)pBuffer, BigEndian);
+    if (0 != Tail)
+    {
+        pBuffer[Written] = (char)KS_CodePointToAnsi(KSTRING_REPLACEMENT_CHARACTER);
+    }
+    KS_FinishString(&Result, pBuffer);
+    return Result;
+}
+
+// Convert string to different encoding
+static KString KS_ConvertUtf16ToUtf16(const KString* pStr, KStringEncoding SourceEncoding, KStringEncoding TargetEncoding);
+
+KString KStringConvertToEncoding(const KString Str, const KStringEncoding TargetEncoding)
+{
+    if (false == KStringIsValid(Str))
+    {
+        return KStringInvalid();
+    }
+
+    KStringEncoding SourceEncoding = KS_GetEncodingFromField(Str.Size);
+
+    // If already the target encoding, return a copy (UTF-16 still replaces an odd trailing byte)
+    if (SourceEncoding == TargetEncoding)
+    {
+        size_t StrSize = KS_GetSize(&Str);
+        if (true == KS_IsUtf16(SourceEncoding) && 0 != (StrSize & 1))
+        {
+            return KS_ConvertUtf16ToUtf16(&Str, SourceEncoding, TargetEncoding);
+        }
+
+        const char* pData = KS_GetData(&Str);
+        return KStringCreateWithEncoding(pData, StrSize, TargetEncoding);
+    }
+
+    // Route to specific conversion functions
+    switch (SourceEncoding)
+    {
+        case KSTRING_ENCODING_UTF8:
+            switch (TargetEncoding)
+            {
+                case KSTRING_ENCODING_UTF16LE:
+                    return KStringConvertUtf8ToUtf16Le(Str);
+                case KSTRING_ENCODING_UTF16BE:
+                    return KStringConvertUtf8ToUtf16Be(Str);
+                case KSTRING_ENCODING_ANSI:
+                    return KStringConvertUtf8ToAnsi(Str);
+                default:
+                    return KStringInvalid();
+            }
+
+        case KSTRING_ENCODING_UTF16LE:
+            switch (TargetEncoding)
+            {
+                case KSTRING_ENCODING_UTF8:
+                    return KStringConvertUtf16LeToUtf8(Str);
+                case KSTRING_ENCODING_UTF16BE:
+                    return KStringConvertUtf16LeToUtf16Be(Str);
+                case KSTRING_ENCODING_ANSI:
+                    return KS_ConvertUtf16ToAnsi(&Str, false);
+                default:
+                    return KStringInvalid();
+            }
+
+        case KSTRING_ENCODING_UTF16BE:
+            switch (TargetEncoding)
+            {
+                case KSTRING_ENCODING_UTF8:
+                    return KStringConvertUtf16BeToUtf8(Str);
+                case KSTRING_ENCODING_UTF16LE:
+                    return KStringConvertUtf16BeToUtf16Le(Str);
+                case KSTRING_ENCODING_ANSI:
+                    return KS_ConvertUtf16ToAnsi(&Str, true);
+                default:
+                    return KStringInvalid();
+            }
+
+        case KSTRING_ENCODING_ANSI:
+            switch (TargetEncoding)
+            {
+                case KSTRING_ENCODING_UTF8:
+                    return KStringConvertAnsiToUtf8(Str);
+                case KSTRING_ENCODING_UTF16LE:
+                    return KS_ConvertAnsiToUtf16(&Str, false);
+                case KSTRING_ENCODING_UTF16BE:
+                    return KS_ConvertAnsiToUtf16(&Str, true);
+                default:
+                    return KStringInvalid();
+            }
+
+        default:
+            return KStringInvalid();
+    }
+}
+
+// UTF-8 <-> UTF-16LE conversion
+KString KStringConvertUtf8ToUtf16Le(const KString Str)
+{
+    return KS_ConvertUtf8ToUtf16(&Str, false);
+}
+
+KString KStringConvertUtf16LeToUtf8(const KString Str)
+{
+    return KS_ConvertUtf16ToUtf8(&Str, false);
+}
+
+// UTF-8 <-> UTF-16BE conversion (direct, no intermediate UTF-16LE string)
+KString KStringConvertUtf8ToUtf16Be(const KString Str)
+{
+    return KS_ConvertUtf8ToUtf16(&Str, true);
+}
+
+KString KStringConvertUtf16BeToUtf8(const KString Str)
+{
+    return KS_ConvertUtf16ToUtf8(&Str, true);
+}
+
+// Swap byte order of UTF-16 data (callers pass whole units, an odd trailing byte would be copied as-is)
+static void KS_SwapUtf16(const uint8_t* pInput, size_t Size, uint8_t* pOutput)
+{
+    size_t i = KS_SimdSwapBytes16Blocks(pInput, Size, pOutput);
+    for (; i + 2 <= Size; i += 2)
+    {
+        uint8_t Low    = pInput[i];
+        pOutput[i]     = pInput[i + 1];
+        pOutput[i + 1] = Low;
+    }
+
+    if (i < Size)
+    {
+        pOutput[i] = pInput[i];
+    }
+}
+
+// UTF-16 to UTF-16 conversion, swapped (or copied for the same byte order) straight into the result payload
+// A trailing odd byte becomes U+FFFD in the target byte order
+static KString KS_ConvertUtf16ToUtf16(const KString* pStr, KStringEncoding SourceEncoding, KStringEncoding TargetEncoding)
+{
+    const uint8_t* pSourceData = KS_GetSourceData(pStr, SourceEncoding);
+    if (NULL == pSourceData)
+    {
+        return KStringInvalid();
+    }
+
+    size_t  DataSize = KS_GetSize(pStr) & ~(size_t)1;
+    size_t  Tail     = KS_OddByteReplacementSize(KS_GetSize(pStr), SourceEncoding, TargetEncoding);
+    KString Result;
+    char*   pBuffer = KS_PrepareString(&Result, DataSize + Tail, TargetEncoding);
+    if (NULL == pBuffer)
+    {
+        return KStringInvalid();
+    }
+
+    if (SourceEncoding == TargetEncoding)
+    {
+        memcpy(pBuffer, pSourceData, DataSize);
+    }
+    else
+    {
+        KS_SwapUtf16(pSourceData, DataSize, (uint8_t*)pBuffer);
+    }
+
+    if (0 != Tail)
+    {
+        KS_EncodeCodePoint(KSTRING_REPLACEMENT_CHARACTER, TargetEncoding, (uint8_t*)pBuffer + DataSize);
+    }
+    KS_FinishString(&Result, pBuffer);
+    return Result;
+}
+
+// UTF-16LE <-> UTF-16BE conversion (byte swapping)
+KString KStringConvertUtf16LeToUtf16Be(const KString Str)
+{
+    return KS_ConvertUtf16ToUtf16(&Str, KSTRING_ENCODING_UTF16LE, KSTRING_ENCODING_UTF16BE);
+}
+
+KString KStringConvertUtf16BeToUtf16Le(const KString Str)
+{
+    return KS_ConvertUtf16ToUtf16(&Str, KSTRING_ENCODING_UTF16BE, KSTRING_ENCODING_UTF16LE);
+}
+
+bool KStringSwapUtf16InPlace(KString* pStr)
+{
+    if (NULL == pStr || false == KStringIsValid(*pStr))
+    {
+        return false;
+    }
+
+    KStringEncoding Encoding = KS_GetEncodingFromField(pStr->Size);
+    if (KSTRING_ENCODING_UTF16LE != Encoding && KSTRING_ENCODING_UTF16BE != Encoding)
+    {
+        return false;
+    }
+
+    // Only payloads owned by the handle may be modified: inline content or TEMPORARY heap payloads (not ropes)
+    uint8_t* pData = (uint8_t*)pStr->Content;
+    if (false == KStringIsShort(*pStr))
+    {
+        uint64_t PtrAndClass = pStr->LongStr.PtrAndClass;
+        if (KSTRING_TEMPORARY != KS_GetStorageClass(PtrAndClass) || true == KS_IsRope(PtrAndClass))
+        {
+            return false;
+        }
+
+        pData = (uint8_t*)KS_GetPointer(PtrAndClass);
+    }
+
+    // The U+FFFD for an odd trailing byte would not fit in place
+    size_t Size = KS_GetSize(pStr);
+    if (0 != (Size & 1))
+    {
+        return false;
+    }
+
+    KS_SwapUtf16(pData, Size, pData);
+
+    // Flip encoding, keep size (or large-string sentinel)
+    KStringEncoding Target = (KSTRING_ENCODING_UTF16LE == Encoding) ? KSTRING_ENCODING_UTF16BE : KSTRING_ENCODING_UTF16LE;
+    pStr->Size             = (pStr->Size & KSTRING_SIZE_MASK) | ((uint32_t)Target << KSTRING_ENCODING_SHIFT);
+
+    if (false == KStringIsShort(*pStr))
+    {
+        memcpy(pStr->LongStr.Prefix, pData, 4);
+    }
+
+    return true;
+}
+
+// UTF-8 <-> ANSI conversion (Windows-1252)
+KString KStringConvertUtf8ToAnsi(const KString Str)
+{
+    const uint8_t* pUtf8Data = KS_GetSourceData(&Str, KSTRING_ENCODING_UTF8);
+    if (NULL == pUtf8Data)
+    {
+        return KStringInvalid();
+    }
+
+    size_t  Utf8Size = KS_GetSize(&Str);
+    size_t  AnsiSize = KS_Utf8ToAnsiSize(pUtf8Data, Utf8Size, KS_HasUtf8ValidFlag(&Str));
+    KString Result;
+    char*   pBuffer = KS_PrepareString(&Result, AnsiSize, KSTRING_ENCODING_ANSI);
+    if (NULL == pBuffer)
+    {
+        return KStringInvalid();
+    }
+
+    // Same as UTF-16: the flag-based size must match what is actually written
+    if (AnsiSize != KS_TranscodeUtf8ToAnsi(pUtf8Data, Utf8Size, (uint8_t*)pBuffer, AnsiSize))
+    {
+        KStringDestroy(Result);
+        return KStringInvalid();
+    }
+
+    KS_FinishString(&Result, pBuffer);
+    return Result;
+}
+
+KString KStringConvertAnsiToUtf8(const KString Str)
+{
+    const uint8_t* pAnsiData = KS_GetSourceData(&Str, KSTRING_ENCODING_ANSI);
+    if (NULL == pAnsiData)
+    {
+        return KStringInvalid();
+    }
+
+    size_t  AnsiSize = KS_GetSize(&Str);
+    KString Result;
+    char*   pBuffer = KS_PrepareString(&Result, KS_AnsiToUtf8Size(pAnsiData, AnsiSize), KSTRING_ENCODING_UTF8);
+    if (NULL == pBuffer)
+    {
+        return KStringInvalid();
+    }
+
+    KS_TranscodeAnsiToUtf8(pAnsiData, AnsiSize, (uint8_t*)pBuffer);
+    KS_FinishString(&Result, pBuffer);
+
+    // Every Windows-1252 byte maps to a code point: the output is valid UTF-8
+    if (false == KStringIsShort(Result))
+    {
+        Result.LongStr.PtrAndClass |= KSTRING_UTF8_VALID_FLAG;
+    }
+
+    return Result;
+}
+
+// Upper bound of the converted size (SIZE_MAX if it does not fit in size_t)
+static size_t KS_ConvertedSizeBound(size_t Size, KStringEncoding SourceEncoding, KStringEncoding TargetEncoding)
+{
+    // An odd trailing UTF-16 byte counts as a whole unit (it becomes U+FFFD)
+    if (true == KS_IsUtf16(SourceEncoding) && 0 != (Size & 1))
+    {
+        if (SIZE_MAX == Size)
+        {
+            return SIZE_MAX;
+        }
+        Size++;
+    }
+
+    if (SourceEncoding == TargetEncoding || (true == KS_IsUtf16(SourceEncoding) && true == KS_IsUtf16(TargetEncoding)))
+    {
+        return Size;
+    }
+
+    // Bytes per source byte (UTF-8/ANSI) or unit (UTF-16): a UTF-16 unit needs up to 3 UTF-8 bytes, an ANSI byte up to 3
+    size_t Units  = (true == KS_IsUtf16(SourceEncoding)) ? Size / sizeof(uint16_t) : Size;
+    size_t Factor = 1;
+    if (true == KS_IsUtf16(TargetEncoding))
+    {
+        Factor = sizeof(uint16_t);
+    }
+    else if (KSTRING_ENCODING_UTF8 == TargetEncoding)
+    {
+        Factor = (KSTRING_ENCODING_UTF8 == SourceEncoding) ? 1 : 3;
+    }
+
+    return (Units > SIZE_MAX / Factor) ? SIZE_MAX : Units * Factor;
+}
+
+// Exact converted size of Size bytes (the same conversion KStringConvertToEncoding performs)
+static size_t KS_ConvertedSize(const uint8_t* pData, size_t Size, KStringEncoding SourceEncoding, KStringEncoding TargetEncoding, bool Validated)
+{
+    bool   BigEndian = KSTRING_ENCODING_UTF16BE == SourceEncoding || KSTRING_ENCODING_UTF16BE == TargetEncoding;
+    size_t Tail      = KS_OddByteReplacementSize(Size, SourceEncoding, TargetEncoding);
+    if (0 != Tail)
+    {
+        size_t Converted = KS_ConvertedSize(pData, Size - 1, SourceEncoding, TargetEncoding, Validated);
+        return (Converted > SIZE_MAX - Tail) ? SIZE_MAX : Converted + Tail;
+    }
+
+    if (SourceEncoding == TargetEncoding || (true == KS_IsUtf16(SourceEncoding) && true == KS_IsUtf16(TargetEncoding)))
+    {
+        return Size;
+    }
+
+    switch (SourceEncoding)
+    {
+        case KSTRING_ENCODING_UTF8:
+            if (KSTRING_ENCODING_ANSI == TargetEncoding)
+            {
+                return KS_Utf8ToAnsiSize(pData, Size, Validated);
+            }
+            Size = KS_Utf8ToUtf16Count(pData, Size, Validated);
+            return (Size > SIZE_MAX / sizeof(uint16_t)) ? SIZE_MAX : Size * sizeof(uint16_t);
+        case KSTRING_ENCODING_ANSI:
+            if (KSTRING_ENCODING_UTF8 == TargetEncoding)
+            {
+                return KS_AnsiToUtf8Size(pData, Size);
+            }
+            return (Size > SIZE_MAX / sizeof(uint16_t)) ? SIZE_MAX : Size * sizeof(uint16_t);
+        default:
+            if (KSTRING_ENCODING_UTF8 == TargetEncoding)
+            {
+                return KS_Utf16ToUtf8Length(pData, Size / sizeof(uint16_t), BigEndian);
+            }
+            return KS_Utf16CodePointCount(pData, Size / sizeof(uint16_t), BigEndian);
+    }
+}
+
+// Transcode Size bytes into a buffer of Capacity bytes, returns bytes written (SIZE_MAX if the output does not fit)
+// UTF-8 sources are sized with the validated flag, so their kernels enforce Capacity themselves; every other
+// conversion writes exactly KS_ConvertedSize bytes and is checked up front where the size follows from Size alone
+static size_t KS_TranscodeInto(const uint8_t* pData, size_t Size, KStringEncoding SourceEncoding, KStringEncoding TargetEncoding, uint8_t* pOutput,
+                               size_t Capacity)
+{
+    bool   BigEndian = KSTRING_ENCODING_UTF16BE == SourceEncoding || KSTRING_ENCODING_UTF16BE == TargetEncoding;
+    size_t Tail      = KS_OddByteReplacementSize(Size, SourceEncoding, TargetEncoding);
+    if (0 != Tail)
+    {
+        size_t Written = KS_TranscodeInto(pData, Size - 1, SourceEncoding, TargetEncoding, pOutput, Capacity);
+        if (SIZE_MAX == Written || Capacity - Written < Tail)
+        {
+            return SIZE_MAX;
+        }
+        return Written + KS_EncodeCodePoint(KSTRING_REPLACEMENT_CHARACTER, TargetEncoding, pOutput + Written);
+    }
+
+    if (SourceEncoding == TargetEncoding || (true == KS_IsUtf16(SourceEncoding) && true == KS_IsUtf16(TargetEncoding)))
+    {
+        if (Size > Capacity)
+        {
+            return SIZE_MAX;
+        }
+
+        if (SourceEncoding == TargetEncoding)
+        {
+            memcpy(pOutput, pData, Size);
+        }
+        else
+        {
+            KS_SwapUtf16(pData, Size, pOutput);
+        }
+        return Size;
+    }
+
+    switch (SourceEncoding)
+    {
+        case KSTRING_ENCODING_UTF8:
+            if (KSTRING_ENCODING_ANSI == TargetEncoding)
+            {
+                return KS_TranscodeUtf8ToAnsi(pData, Size, pOutput, Capacity);
+            }
+            return KS_TranscodeUtf8ToUtf16(pData, Size, pOutput, Capacity, BigEndian);
+        case KSTRING_ENCODING_ANSI:
+            if (KSTRING_ENCODING_UTF8 == TargetEncoding)
+            {
+                return KS_TranscodeAnsiToUtf8(pData, Size, pOutput);
+            }
+            if (Size > Capacity / sizeof(uint16_t))
+            {
+                return SIZE_MAX;
+            }
+            return KS_TranscodeAnsiToUtf16(pData, Size, pOutput, BigEndian);
+        default:
+            if (KSTRING_ENCODING_UTF8 == TargetEncoding)
+            {
+                return KS_TranscodeUtf16ToUtf8(pData, Size / sizeof(uint16_t), pOutput, BigEndian);
+            }
+            return KS_TranscodeUtf16ToAnsi(pData, Size / sizeof(uint16_t), pOutput, BigEndian);
+    }
+}
+
+size_t KStringConvertedSize(const KString Str, const KStringEncoding TargetEncoding)
+{
+    if (false == KStringIsValid(Str))
+    {
+        return 0;
+    }
+
+    KStringEncoding SourceEncoding = KS_GetEncodingFromField(Str.Size);
+    const uint8_t*  pData          = KS_GetSourceData(&Str, SourceEncoding);
+    if (NULL == pData)
+    {
+        return 0;
+    }
+
+    return KS_ConvertedSize(pData, KS_GetSize(&Str), SourceEncoding, TargetEncoding, KS_HasUtf8ValidFlag(&Str));
+}
+
+bool KStringConvertInto(const KString Str, const KStringEncoding TargetEncoding, void* pBuffer, const size_t Capacity, size_t* pWritten)
+{
+    if (false == KStringIsValid(Str) || NULL == pWritten || (NULL == pBuffer && 0 != Capacity) || TargetEncoding > KSTRING_ENCODING_ANSI)
+    {
+        return false;
+    }
+
+    KStringEncoding SourceEncoding = KS_GetEncodingFromField(Str.Size);
+    const uint8_t*  pData          = KS_GetSourceData(&Str, SourceEncoding);
+    size_t          Size           = KS_GetSize(&Str);
+    if (NULL == pData)
+    {
+        return false;
+    }
+
+    // A buffer that fits the worst case needs no sizing pass
+    bool Validated = KS_HasUtf8ValidFlag(&Str);
+    if (Capacity < KS_ConvertedSizeBound(Size, SourceEncoding, TargetEncoding))
+    {
+        size_t Required = KS_ConvertedSize(pData, Size, SourceEncoding, TargetEncoding, Validated);
+        if (Required > Capacity)
+        {
+            *pWritten = Required;
+            return false;
+        }
+    }
+
+    // Capacity is a hard limit: a stale or forged validated flag under-sizes the output, report the real size instead
+    size_t Written = KS_TranscodeInto(pData, Size, SourceEncoding, TargetEncoding, (uint8_t*)pBuffer, Capacity);
+    if (SIZE_MAX == Written)
+    {
+        *pWritten = KS_ConvertedSize(pData, Size, SourceEncoding, TargetEncoding, false);
+        return false;
+    }
+
+    *pWritten = Written;
+    return true;
+}
+
+// Check if an inline UTF-8/ANSI string is pure ASCII (zero padding keeps the test branch-free)
+inline static bool KS_IsShortAscii(const KString* pStr)
+{
+    uint64_t Low;
+    uint32_t High;
+    memcpy(&Low, pStr->Content, sizeof(Low));
+    memcpy(&High, pStr->Content + sizeof(Low), sizeof(High));
+    return 0 == ((Low | High) & 0x8080'8080'8080'8080ULL);
+}
+
+// Check if a string is an inline UTF-8/ANSI string of pure ASCII (UTF-8 and ANSI share ASCII)
+inline static bool KS_IsShortAsciiSource(const KString* pStr, KStringEncoding SourceEncoding)
+{
+    return true == KStringIsShort(*pStr) && false == KS_IsUtf16(SourceEncoding) && true == KS_IsShortAscii(pStr);
+}
+
+bool KStringConvertBatch(const KString* pInput, const size_t Count, const KStringEncoding TargetEncoding, KStringArena* pArena, KString* pOutput)
+{
+    if (NULL == pArena || (0 != Count && (NULL == pInput || NULL == pOutput)) || TargetEncoding > KSTRING_ENCODING_ANSI)
+    {
+        return false;
+    }
+
+    // Pass 1: exact result sizes, parked in the output handles until pass 2 overwrites them
+    size_t HeapSize = 0;
+    for (size_t i = 0; i < Count; ++i)
+    {
+        size_t Size = SIZE_MAX;
+        if (true == KStringIsValid(pInput[i]) && NULL != KS_GetData(&pInput[i]))
+        {
+            // Inline ASCII needs no scan: one byte or one UTF-16 unit per character
+            KStringEncoding SourceEncoding = KS_GetEncodingFromField(pInput[i].Size);
+            if (true == KS_IsShortAsciiSource(&pInput[i], SourceEncoding))
+            {
+                Size = KS_GetSize(&pInput[i]) * ((true == KS_IsUtf16(TargetEncoding)) ? sizeof(uint16_t) : 1);
+            }
+            else
+            {
+                Size = KStringConvertedSize(pInput[i], TargetEncoding);
+            }
+        }
+
+        if (Size > KSTRING_MAX_REGULAR_SIZE)
+        {
+            Size = SIZE_MAX;
+        }
+        else if (false == KS_IsShortString(Size))
+        {
+            if (Size + 1 > SIZE_MAX - HeapSize)
+            {
+                return false;
+            }
+            HeapSize += Size + 1; // +1 for null terminator
+        }
+
+        memcpy(pOutput[i].Content, &Size, sizeof(Size));
+    }
+
+    // One heap for all long results
+    char* pHeap = NULL;
+    if (0 != HeapSize)
+    {
+        pHeap = KStringArenaAlloc(pArena, HeapSize);
+        if (NULL == pHeap)
+        {
+            return false;
+        }
+    }
+
+    // Pass 2: transcode straight into inline content or the heap
+    for (size_t i = 0; i < Count; ++i)
+    {
+        size_t Size;
+        memcpy(&Size, pOutput[i].Content, sizeof(Size));
+        if (SIZE_MAX == Size)
+        {
+            pOutput[i] = KStringInvalid();
+            continue;
+        }
+
+        KStringEncoding SourceEncoding = KS_GetEncodingFromField(pInput[i].Size);
+        bool            ShortAscii     = KS_IsShortAsciiSource(&pInput[i], SourceEncoding);
+        if (true == ShortAscii && false == KS_IsUtf16(TargetEncoding))
+        {
+            // Same bytes, only the encoding changes
+            pOutput[i]      = pInput[i];
+            pOutput[i].Size = KS_CreateSizeField(Size, TargetEncoding);
+            continue;
+        }
+
+        const uint8_t* pData      = KS_GetSourceData(&pInput[i], SourceEncoding);
+        size_t         SourceSize = KS_GetSize(&pInput[i]);
+
+        KString  Result;
+        uint8_t* pTarget = (uint8_t*)pHeap;
+        if (true == KS_IsShortString(Size))
+        {
+            Result.Size = KS_CreateSizeField(Size, TargetEncoding);
+            memset(Result.Content, 0, KSTRING_MAX_SHORT_LENGTH);
+            pTarget = (uint8_t*)Result.Content;
+        }
+
+        bool Complete = true;
+        if (true == ShortAscii)
+        {
+            // At most 12 ASCII bytes widened to UTF-16
+            bool BigEndian = KSTRING_ENCODING_UTF16BE == TargetEncoding;
+            for (size_t j = 0; j < SourceSize; ++j)
+            {
+                KS_WriteUtf16(pTarget + 2 * j, pData[j], BigEndian);
+            }
+        }
+        else
+        {
+            // The slot is bounded by its pass 1 size: a stale or forged validated flag cannot spill into the next slot
+            Complete = Size == KS_TranscodeInto(pData, SourceSize, SourceEncoding, TargetEncoding, pTarget, Size);
+        }
+
+        if (false == Complete)
+        {
+            Result = KStringInvalid();
+            if (false == KS_IsShortString(Size))
+            {
+                pHeap += Size + 1;
+            }
+        }
+        else if (false == KS_IsShortString(Size))
+        {
+            pHeap[Size] = '\0';
+
+            // Arena memory is released with the arena: hand out TRANSIENT strings
+            Result  = KStringCreateTransientWithEncoding(pHeap, Size, TargetEncoding);
+            pHeap  += Size + 1;
+
+            // Transcoded UTF-8 is always valid, copied UTF-8 keeps its flag
+            if (KSTRING_ENCODING_UTF8 == TargetEncoding && (KSTRING_ENCODING_UTF8 != SourceEncoding || true == KS_HasUtf8ValidFlag(&pInput[i])))
+            {
+                Result.LongStr.PtrAndClass |= KSTRING_UTF8_VALID_FLAG;
+            }
+        }
+
+        pOutput[i] = Result;
+    }
+
+    return true;
+}
+
+KString KStringConcatWithEncoding(const KString StrA, const KString StrB, const KStringEncoding TargetEncoding)
+{
+    if (false == KStringIsValid(StrA) || false == KStringIsValid(StrB) || TargetEncoding > KSTRING_ENCODING_ANSI)
+    {
+        return KStringInvalid();
+    }
+
+    const KString* pParts[2]   = {&StrA, &StrB};
+    size_t         Sizes[2]    = {0, 0};
+    size_t         TotalLength = 0;
+    bool           Valid       = true;
+
+    // Sizing pass: operands already in the target encoding cost nothing
+    for (size_t i = 0; i < 2; ++i)
+    {
+        KStringEncoding SourceEncoding = KS_GetEncodingFromField(pParts[i]->Size);
+        size_t          Size           = KS_GetSize(pParts[i]);
+        if (NULL == KS_GetData(pParts[i]))
+        {
+            return KStringInvalid();
+        }
+
+        if (SourceEncoding != TargetEncoding || 0 != KS_OddByteReplacementSize(Size, SourceEncoding, TargetEncoding))
+        {
+            Size = KS_ConvertedSize(KS_GetSourceData(pParts[i], SourceEncoding), Size, SourceEncoding, TargetEncoding, KS_HasUtf8ValidFlag(pParts[i]));
+        }
+        else if (KSTRING_ENCODING_UTF8 == TargetEncoding && 0 != Size)
+        {
+            Valid = Valid && KS_IsKnownValidUtf8(pParts[i]);
+        }
+
+        if (Size > SIZE_MAX - TotalLength)
+        {
+            return KStringInvalid();
+        }
+
+        Sizes[i]     = Size;
+        TotalLength += Size;
+    }
+
+    KString Result;
+    char*   pBuffer = KS_PrepareString(&Result, TotalLength, TargetEncoding);
+    if (NULL == pBuffer)
+    {
+        return KStringInvalid();
+    }
+
+    // Copy or transcode each operand straight into its place in the result payload
+    size_t Written = 0;
+    for (size_t i = 0; i < 2; ++i)
+    {
+        KStringEncoding SourceEncoding = KS_GetEncodingFromField(pParts[i]->Size);
+        if (0 != KS_GetSize(pParts[i]))
+        {
+            // Each operand stays inside its own slot, even if a stale validated flag under-sized it
+            if (Sizes[i] != KS_TranscodeInto(KS_GetSourceData(pParts[i], SourceEncoding), KS_GetSize(pParts[i]), SourceEncoding, TargetEncoding,
+                                             (uint8_t*)pBuffer + Written, Sizes[i]))
+            {
+                KStringDestroy(Result);
+                return KStringInvalid();
+            }
+            Written += Sizes[i];
+        }
+    }
+
+    KS_FinishString(&Result, pBuffer);
+
+    // Transcoded UTF-8 is always valid, so only the copied operands decide
+    if (false == KStringIsShort(Result) && KSTRING_ENCODING_UTF8 == TargetEncoding && true == Valid)
+    {
+        Result.LongStr.PtrAndClass |= KSTRING_UTF8_VALID_FLAG;
+    }
+
+    return Result;
+}
+
+// Read position in the code points of a string of any encoding
+typedef struct KS_CodePointCursor
+{
+    const uint8_t*  pData;    // Payload
+    size_t          Size;     // Payload bytes (UTF-16: a trailing odd byte reads as U+FFFD like the converters do)
+    size_t          Position; // Next byte to decode
+    KStringEncoding Encoding; // Payload encoding
+} KS_CodePointCursor;
+
+// Start a cursor at the beginning of a valid string
+static void KS_InitCodePointCursor(KS_CodePointCursor* pCursor, const KString* pStr)
+{
+    pCursor->Encoding = KS_GetEncodingFromField(pStr->Size);
+    pCursor->pData    = KS_GetSourceData(pStr, pCursor->Encoding);
+    pCursor->Size     = (NULL != pCursor->pData) ? KS_GetSize(pStr) : 0; // Unresolvable payloads read as empty
+    pCursor->Position = 0;
+}
+
+// Advance both cursors over their common run of identical ASCII characters (non-surrogate units for UTF-16 pairs)
+static void KS_SkipCommonRun(KS_CodePointCursor* pA, KS_CodePointCursor* pB)
+{
+    const uint8_t* pDataA     = pA->pData + pA->Position;
+    const uint8_t* pDataB     = pB->pData + pB->Position;
+    size_t         RemainingA = pA->Size - pA->Position;
+    size_t         RemainingB = pB->Size - pB->Position;
+    bool           Utf16A     = KS_IsUtf16(pA->Encoding);
+    bool           Utf16B     = KS_IsUtf16(pB->Encoding);
+    size_t         Count;
+
+    if (false == Utf16A && false == Utf16B)
+    {
+        Count         = KS_SimdAsciiEqualPrefix(pDataA, pDataB, (RemainingA < RemainingB) ? RemainingA : RemainingB);
+        pA->Position += Count;
+        pB->Position += Count;
+    }
+    else if (false == Utf16A)
+    {
+        RemainingB   /= sizeof(uint16_t);
+        Count         = KS_SimdAsciiEqualUtf16Prefix(pDataA, pDataB, (RemainingA < RemainingB) ? RemainingA : RemainingB, KSTRING_ENCODING_UTF16BE == pB->Encoding);
+        pA->Position += Count;
+        pB->Position += Count * sizeof(uint16_t);
+    }
+    else if (false == Utf16B)
+    {
+        RemainingA   /= sizeof(uint16_t);
+        Count         = KS_SimdAsciiEqualUtf16Prefix(pDataB, pDataA, (RemainingA < RemainingB) ? RemainingA : RemainingB, KSTRING_ENCODING_UTF16BE == pA->Encoding);
+        pA->Position += Count * sizeof(uint16_t);
+        pB->Position += Count;
+    }
+    else
+    {
+        Count = KS_SimdUtf16EqualPrefix(pDataA, KSTRING_ENCODING_UTF16BE == pA->Encoding, pDataB, KSTRING_ENCODING_UTF16BE == pB->Encoding,
+                                        ((RemainingA < RemainingB) ? RemainingA : RemainingB) / sizeof(uint16_t));
+        pA->Position += Count * sizeof(uint16_t);
+        pB->Position += Count * sizeof(uint16_t);
+    }
+}
+
+// Compare decoded code point sequences in lock-step (invalid sequences compare as U+FFFD)
+static int KS_CompareCodepoints(const KString* pA, const KString* pB)
+{
+    KS_CodePointCursor CursorA, CursorB;
+    KS_InitCodePointCursor(&CursorA, pA);
+    KS_InitCodePointCursor(&CursorB, pB);
+
+    // Valid UTF-8 on both sides: byte order is code point order
+    if (KSTRING_ENCODING_UTF8 == CursorA.Encoding && KSTRING_ENCODING_UTF8 == CursorB.Encoding && true == KS_IsKnownValidUtf8(pA) && true == KS_IsKnownValidUtf8(pB))
+    {
+        size_t Common = (CursorA.Size < CursorB.Size) ? CursorA.Size : CursorB.Size;
+        int    Result = (0 != Common) ? memcmp(CursorA.pData, CursorB.pData, Common) : 0;
+        if (0 != Result)
+        {
+            return (Result < 0) ? -1 : 1;
+        }
+        return (CursorA.Size == CursorB.Size) ? 0 : ((CursorA.Size < CursorB.Size) ? -1 : 1);
+    }
+
+    while (CursorA.Position < CursorA.Size && CursorB.Position < CursorB.Size)
+    {
+        KS_SkipCommonRun(&CursorA, &CursorB);
+        if (CursorA.Position == CursorA.Size || CursorB.Position == CursorB.Size)
+        {
+            break;
+        }
+
+        uint32_t CodePointA, CodePointB;
+        CursorA.Position += KS_DecodeCodePoint(CursorA.pData + CursorA.Position, CursorA.Size - CursorA.Position, CursorA.Encoding, &CodePointA);
+        CursorB.Position += KS_DecodeCodePoint(CursorB.pData + CursorB.Position, CursorB.Size - CursorB.Position, CursorB.Encoding, &CodePointB);
+        if (CodePointA != CodePointB)
+        {
+            return (CodePointA < CodePointB) ? -1 : 1;
+        }
+    }
+
+    // Equal up to the end of the shorter one
+    bool MoreA = CursorA.Position < CursorA.Size;
+    bool MoreB = CursorB.Position < CursorB.Size;
+    return (MoreA == MoreB) ? 0 : ((true == MoreA) ? 1 : -1);
+}
+
+int KStringCompareCodepoints(const KString StrA, const KString StrB)
+{
+    bool ValidA = KStringIsValid(StrA);
+    bool ValidB = KStringIsValid(StrB);
+    if (false == ValidA || false == ValidB)
+    {
+        // Invalid strings order before valid ones
+        return (ValidA == ValidB) ? 0 : ((true == ValidA) ? 1 : -1);
+    }
+
+    return KS_CompareCodepoints(&StrA, &StrB);
+}
+
+bool KStringEqualsCodepoints(const KString StrA, const KString StrB)
+{
+    if (false == KStringIsValid(StrA) || false == KStringIsValid(StrB))
+    {
+        return false;
+    }
+
+    // Same encoding and equal bytes always decode to the same code points
+    KStringEncoding EncodingA = KS_GetEncodingFromField(StrA.Size);
+    if (EncodingA == KS_GetEncodingFromField(StrB.Size) && true == KStringEquals(StrA, StrB))
+    {
+        return true;
+    }
+
+    // ANSI is a one-to-one mapping: different bytes are different code points
+    if (KSTRING_ENCODING_ANSI == EncodingA && KSTRING_ENCODING_ANSI == KS_GetEncodingFromField(StrB.Size))
+    {
+        return false;
+    }
+
+    return 0 == KS_CompareCodepoints(&StrA, &StrB);
+}
+
+// Map a code point through a three-stage delta table from KStringUnicodeData.h
+inline static uint32_t KS_UnicodeMap(uint32_t CodePoint, uint32_t Limit, const uint8_t* pStage1, const uint8_t* pStage2, const uint8_t* pStage3, const int32_t* pDeltas)
+{
+    if (CodePoint >= Limit)
+    {
+        return CodePoint;
+    }
+
+    size_t Block = pStage2[pStage1[CodePoint >> 9] * 32 + ((CodePoint >> 4) & 31)];
+    return CodePoint + (uint32_t)pDeltas[pStage3[Block * 16 + (CodePoint & 15)]];
+}
+
+// Simple case folding (one code point to one code point, e.g. U+1E9E to U+00DF but not U+00DF to "ss")
+inline static uint32_t KS_CaseFold(uint32_t CodePoint)
+{
+    if (CodePoint < 0x80)
+    {
+        return (CodePoint - 'A' < 26) ? CodePoint + 0x20 : CodePoint;
+    }
+
+    return KS_UnicodeMap(CodePoint, KSTRING_CASEFOLD_LIMIT, KS_CaseFoldStage1, KS_CaseFoldStage2, KS_CaseFoldStage3, KS_CaseFoldDeltas);
+}
+
+// Advance both cursors over their common run of ASCII characters that are equal ignoring case
+static void KS_SkipCommonRunIgnoreCase(KS_CodePointCursor* pA, KS_CodePointCursor* pB)
+{
+    size_t RemainingA = pA->Size - pA->Position;
+    size_t RemainingB = pB->Size - pB->Position;
+    bool   Utf16A     = KS_IsUtf16(pA->Encoding);
+    bool   Utf16B     = KS_IsUtf16(pB->Encoding);
+    size_t Count;
+
+    if (false == Utf16A && false == Utf16B)
+    {
+        Count         = KS_SimdAsciiEqualIgnoreCasePrefix(pA->pData + pA->Position, pB->pData + pB->Position, (RemainingA < RemainingB) ? RemainingA : RemainingB);
+        pA->Position += Count;
+        pB->Position += Count;
+    }
+    else if (true == Utf16A && true == Utf16B)
+    {
+        Count = KS_SimdUtf16EqualIgnoreCasePrefix(pA->pData + pA->Position, KSTRING_ENCODING_UTF16BE == pA->Encoding, pB->pData + pB->Position,
+                                                  KSTRING_ENCODING_UTF16BE == pB->Encoding, ((RemainingA < RemainingB) ? RemainingA : RemainingB) / sizeof(uint16_t));
+        pA->Position += Count * sizeof(uint16_t);
+        pB->Position += Count * sizeof(uint16_t);
+    }
+}
+
+// Number of code points from the cursor position to the end
+static size_t KS_RemainingCodepoints(const KS_CodePointCursor* pCursor)
+{
+    const uint8_t* pData = pCursor->pData + pCursor->Position;
+    size_t         Size  = pCursor->Size - pCursor->Position;
+
+    switch (pCursor->Encoding)
+    {
+        case KSTRING_ENCODING_ANSI:
+            return Size;
+        case KSTRING_ENCODING_UTF8:
+            return KS_Utf8ToAnsiSize(pData, Size, false);
+        default:
+            return KS_Utf16CodePointCount(pData, Size / sizeof(uint16_t), KSTRING_ENCODING_UTF16BE == pCursor->Encoding) + (Size & 1);
+    }
+}
+
+// Compare simple case folded code points in lock-step: shorter (in code points) first, then lexicographic,
+// which keeps the length-first order of the ASCII-only implementation (PrefixOnly: 0 if B is a prefix of A)
+static int KS_CompareFolded(const KString* pA, const KString* pB, bool PrefixOnly)
+{
+    KS_CodePointCursor CursorA, CursorB;
+    KS_InitCodePointCursor(&CursorA, pA);
+    KS_InitCodePointCursor(&CursorB, pB);
+
+    int First = 0;
+    while (CursorA.Position < CursorA.Size && CursorB.Position < CursorB.Size)
+    {
+        KS_SkipCommonRunIgnoreCase(&CursorA, &CursorB);
+        if (CursorA.Position == CursorA.Size || CursorB.Position == CursorB.Size)
+        {
+            break;
+        }
+
+        uint32_t CodePointA, CodePointB;
+        CursorA.Position += KS_DecodeCodePoint(CursorA.pData + CursorA.Position, CursorA.Size - CursorA.Position, CursorA.Encoding, &CodePointA);
+        CursorB.Position += KS_DecodeCodePoint(CursorB.pData + CursorB.Position, CursorB.Size - CursorB.Position, CursorB.Encoding, &CodePointB);
+
+        CodePointA = KS_CaseFold(CodePointA);
+        CodePointB = KS_CaseFold(CodePointB);
+        if (CodePointA != CodePointB)
+        {
+            First = (CodePointA < CodePointB) ? -1 : 1;
+            break;
+        }
+    }
+
+    if (true == PrefixOnly)
+    {
+        return (0 == First && CursorB.Position == CursorB.Size) ? 0 : 1;
+    }
+
+    // Both cursors have passed the same number of code points: the rest decides the length order
+    size_t RestA = (CursorA.Position < CursorA.Size) ? KS_RemainingCodepoints(&CursorA) : 0;
+    size_t RestB = (CursorB.Position < CursorB.Size) ? KS_RemainingCodepoints(&CursorB) : 0;
+    if (RestA != RestB)
+    {
+        return (RestA < RestB) ? -1 : 1;
+    }
+
+    return First;
+}
+
+//
+// Code Point Operations
+//
+
+// Code points between two checkpoints of a KStringCodepointIndex
+#define KSTRING_CODEPOINT_INDEX_STRIDE 64
+
+// Advance Position by up to Count code points, returns the new position (*pAdvanced: code points passed)
+static size_t KS_AdvanceCodepoints(const KS_CodePointCursor* pCursor, size_t Position, size_t Count, size_t* pAdvanced)
+{
+    const uint8_t* pData    = pCursor->pData;
+    size_t         Size     = pCursor->Size;
+    size_t         Advanced = 0;
+
+    if (KSTRING_ENCODING_ANSI == pCursor->Encoding)
+    {
+        Advanced = (Count < Size - Position) ? Count : Size - Position;
+        Position += Advanced;
+    }
+    else if (KSTRING_ENCODING_UTF8 == pCursor->Encoding)
+    {
+        while (Advanced < Count && Position < Size)
+        {
+            // ASCII runs are one code point per byte
+            size_t Limit  = (Count - Advanced < Size - Position) ? Count - Advanced : Size - Position;
+            size_t Ascii  = KS_SimdAsciiPrefix(pData + Position, Limit);
+            Position     += Ascii;
+            Advanced     += Ascii;
+
+            if (Ascii < Limit)
+            {
+                uint32_t CodePoint;
+                Position += KS_DecodeUtf8(pData + Position, Size - Position, &CodePoint);
+                ++Advanced;
+            }
+        }
+    }
+    else
+    {
+        bool BigEndian = KSTRING_ENCODING_UTF16BE == pCursor->Encoding;
+        while (Advanced < Count && Position < Size)
+        {
+            // Units outside the surrogate range are one code point each
+            size_t Units  = (Size - Position) / sizeof(uint16_t);
+            size_t Limit  = (Count - Advanced < Units) ? Count - Advanced : Units;
+            size_t Plain  = KS_SimdUtf16NonSurrogatePrefix(pData + Position, Limit, BigEndian);
+            Position     += Plain * sizeof(uint16_t);
+            Advanced     += Plain;
+
+            // A surrogate, or a trailing odd byte (no whole unit left)
+            if (Plain < Limit || 0 == Units)
+            {
+                uint32_t CodePoint;
+                Position += KS_DecodeCodePoint(pData + Position, Size - Position, pCursor->Encoding, &CodePoint);
+                ++Advanced;
+            }
+        }
+    }
+
+    *pAdvanced = Advanced;
+    return Position;
+}
 
-        if (FirstByte < 0x80)
+// Check if an index was built for exactly this string
+inline static bool KS_IndexMatches(const KStringCodepointIndex* pIndex, const KString* pStr)
+{
+    return NULL != pIndex->pOffsets && 0 == memcmp(&pIndex->Str, pStr, sizeof(KString));
+}
+
+size_t KStringCodepointCount(const KString Str)
+{
+    if (false == KStringIsValid(Str))
+    {
+        return 0;
+    }
+
+    KS_CodePointCursor Cursor;
+    KS_InitCodePointCursor(&Cursor, &Str);
+
+    switch (Cursor.Encoding)
+    {
+        case KSTRING_ENCODING_ANSI:
+            return Cursor.Size;
+        case KSTRING_ENCODING_UTF8:
+            // Validated input: count all bytes that are not continuation bytes
+            if (true == KS_IsKnownValidUtf8(&Str))
+            {
+                return KS_SimdUtf8CodePointCount(Cursor.pData, Cursor.Size);
+            }
+            // Otherwise every maximal invalid subpart counts as one U+FFFD (one ANSI byte per code point)
+            return KS_Utf8ToAnsiSize(Cursor.pData, Cursor.Size, false);
+        default:
+            return KS_Utf16CodePointCount(Cursor.pData, Cursor.Size / sizeof(uint16_t), KSTRING_ENCODING_UTF16BE == Cursor.Encoding) + (Cursor.Size & 1);
+    }
+}
+
+void KStringCodepointIndexInit(KStringCodepointIndex* pIndex)
+{
+    if (NULL == pIndex)
+    {
+        return;
+    }
+
+    pIndex->Str             = KStringInvalid();
+    pIndex->CodepointCount  = 0;
+    pIndex->CheckpointCount = 0;
+    pIndex->pOffsets        = NULL;
+}
+
+bool KStringCodepointIndexBuild(KStringCodepointIndex* pIndex, const KString Str)
+{
+    if (NULL == pIndex || false == KStringIsValid(Str))
+    {
+        return false;
+    }
+
+    if (true == KS_IndexMatches(pIndex, &Str))
+    {
+        return true;
+    }
+
+    KStringCodepointIndexDestroy(pIndex);
+
+    KS_CodePointCursor Cursor;
+    KS_InitCodePointCursor(&Cursor, &Str);
+
+    // One checkpoint per stride; code points are never more than bytes, so this bounds the table
+    size_t  Capacity = Cursor.Size / KSTRING_CODEPOINT_INDEX_STRIDE + 1;
+    size_t* pOffsets = malloc(Capacity * sizeof(size_t));
+    if (NULL == pOffsets)
+    {
+        return false;
+    }
+
+    size_t Checkpoints = 0;
+    size_t Codepoints  = 0;
+    size_t Position    = 0;
+    size_t Advanced    = KSTRING_CODEPOINT_INDEX_STRIDE;
+    while (KSTRING_CODEPOINT_INDEX_STRIDE == Advanced)
+    {
+        pOffsets[Checkpoints++]  = Position;
+        Position                 = KS_AdvanceCodepoints(&Cursor, Position, KSTRING_CODEPOINT_INDEX_STRIDE, &Advanced);
+        Codepoints              += Advanced;
+    }
+
+    pIndex->Str             = Str;
+    pIndex->CodepointCount  = Codepoints;
+    pIndex->CheckpointCount = Checkpoints;
+    pIndex->pOffsets        = pOffsets;
+    return true;
+}
+
+void KStringCodepointIndexDestroy(KStringCodepointIndex* pIndex)
+{
+    if (NULL == pIndex)
+    {
+        return;
+    }
+
+    free(pIndex->pOffsets);
+    KStringCodepointIndexInit(pIndex);
+}
+
+KString KStringSubstringCodepoints(const KString Str, const size_t Offset, const size_t Count, KStringCodepointIndex* pIndex)
+{
+    if (false == KStringIsValid(Str))
+    {
+        return KStringInvalid();
+    }
+
+    KS_CodePointCursor Cursor;
+    KS_InitCodePointCursor(&Cursor, &Str);
+
+    // Short strings and ANSI need no index
+    size_t Start = 0;
+    size_t Skip  = Offset;
+    if (NULL != pIndex && false == KStringIsShort(Str) && KSTRING_ENCODING_ANSI != Cursor.Encoding)
+    {
+        // Built lazily on first use, rebuilt if the caller passes a different string
+        if (false == KStringCodepointIndexBuild(pIndex, Str))
         {
-            // 1-byte character (ASCII)
-            CodePoint = FirstByte;
-            BytesRead = 1;
+            return KStringInvalid();
         }
-        else if ((FirstByte & 0xE0) == 0xC0)
+
+        if (Offset >= pIndex->CodepointCount)
         {
-            // 2-byte character
-            if (i + 1 < Utf8Size)
-            {
-                CodePoint = ((FirstByte & 0x1F) << 6) | (pUtf8[i + 1] & 0x3F);
-                BytesRead = 2;
-            }
-            else
+            return KStringInvalid();
+        }
+
+        // Jump to the checkpoint, then decode at most one stride
+        Start = pIndex->pOffsets[Offset / KSTRING_CODEPOINT_INDEX_STRIDE];
+        Skip  = Offset % KSTRING_CODEPOINT_INDEX_STRIDE;
+    }
+
+    size_t Advanced;
+    size_t Begin = KS_AdvanceCodepoints(&Cursor, Start, Skip, &Advanced);
+    if (Advanced < Skip || Begin >= Cursor.Size)
+    {
+        return KStringInvalid();
+    }
+
+    // Count is clamped to the end of the string like KStringSubstring does with bytes
+    size_t End = KS_AdvanceCodepoints(&Cursor, Begin, Count, &Advanced);
+    return KStringSubstring(Str, Begin, End - Begin);
+}
+
+//
+// Case Conversion Operations
+//
+
+// Simple case mapping of one code point (one code point to one code point, U+00DF stays U+00DF)
+inline static uint32_t KS_ChangeCaseCodePoint(uint32_t CodePoint, bool Upper)
+{
+    if (CodePoint < 0x80)
+    {
+        if (true == Upper)
+        {
+            return (CodePoint - 'a' < 26) ? CodePoint - 0x20 : CodePoint;
+        }
+        return (CodePoint - 'A' < 26) ? CodePoint + 0x20 : CodePoint;
+    }
+
+    if (true == Upper)
+    {
+        return KS_UnicodeMap(CodePoint, KSTRING_UPPERCASE_LIMIT, KS_UpperCaseStage1, KS_UpperCaseStage2, KS_UpperCaseStage3, KS_UpperCaseDeltas);
+    }
+    return KS_UnicodeMap(CodePoint, KSTRING_LOWERCASE_LIMIT, KS_LowerCaseStage1, KS_LowerCaseStage2, KS_LowerCaseStage3, KS_LowerCaseDeltas);
+}
+
+// Case mapping of an ANSI byte (kept if the mapped character has no Windows-1252 byte, e.g. U+00B5 to U+039C)
+inline static uint8_t KS_ChangeCaseAnsi(uint8_t Byte, bool Upper)
+{
+    uint32_t CodePoint = KS_AnsiToCodePoint(Byte);
+    uint32_t Mapped    = KS_ChangeCaseCodePoint(CodePoint, Upper);
+    uint8_t  Result    = KS_CodePointToAnsi(Mapped);
+    return (Mapped == CodePoint || '?' == Result) ? Byte : Result;
+}
+
+// Size of UTF-8 after case mapping (invalid sequences are kept as they are)
+// *pSameLengths: every code point keeps its encoded length, so the mapping can be done in place
+static size_t KS_ChangeCaseUtf8Size(const uint8_t* pInput, size_t Size, bool Upper, bool* pSameLengths)
+{
+    size_t Length      = 0;
+    size_t i           = 0;
+    bool   SameLengths = true;
+    while (i < Size)
+    {
+        size_t Ascii  = KS_SimdAsciiPrefix(pInput + i, Size - i);
+        Length       += Ascii;
+        i            += Ascii;
+
+        while (i < Size && pInput[i] >= 0x80)
+        {
+            uint32_t CodePoint;
+            size_t   Used   = KS_DecodeUtf8(pInput + i, Size - i, &CodePoint);
+            size_t   Mapped = (KSTRING_REPLACEMENT_CHARACTER == CodePoint) ? Used : KS_Utf8Length(KS_ChangeCaseCodePoint(CodePoint, Upper));
+            SameLengths     = SameLengths && Mapped == Used;
+            Length         += Mapped;
+            i              += Used;
+        }
+    }
+
+    *pSameLengths = SameLengths;
+    return Length;
+}
+
+// Case-map a payload into pOutput (pOutput may equal pInput if no code point changes its length)
+// ASCII mode only flips 'A'..'Z'/'a'..'z', invalid sequences and lone surrogates are kept in both modes
+static void KS_ChangeCase(const uint8_t* pInput, size_t Size, KStringEncoding Encoding, bool Upper, bool AsciiOnly, uint8_t* pOutput)
+{
+    if (true == KS_IsUtf16(Encoding))
+    {
+        bool   BigEndian = KSTRING_ENCODING_UTF16BE == Encoding;
+        size_t Count     = Size / sizeof(uint16_t);
+        size_t i         = 0;
+        while (i < Count)
+        {
+            i += KS_SimdChangeCaseAsciiUtf16(pInput + 2 * i, Count - i, pOutput + 2 * i, BigEndian, Upper, false == AsciiOnly);
+
+            // Scalar for one block, then try the kernel again (simple mappings never leave or enter the BMP)
+            size_t End = (Count - i > 8) ? i + 8 : Count;
+            while (i < End)
             {
-                break;
+                uint32_t CodePoint;
+                size_t   Units = KS_DecodeUtf16(pInput + 2 * i, Count - i, BigEndian, &CodePoint);
+                uint32_t Mapped;
+                if (true == AsciiOnly)
+                {
+                    Mapped = (CodePoint < 0x80) ? KS_ChangeCaseCodePoint(CodePoint, Upper) : CodePoint;
+                }
+                else
+                {
+                    Mapped = (KSTRING_REPLACEMENT_CHARACTER == CodePoint) ? CodePoint : KS_ChangeCaseCodePoint(CodePoint, Upper);
+                }
+
+                if (Mapped != CodePoint)
+                {
+                    KS_EncodeUtf16(Mapped, pOutput + 2 * i, BigEndian);
+                }
+                else if (pOutput != pInput)
+                {
+                    memcpy(pOutput + 2 * i, pInput + 2 * i, Units * sizeof(uint16_t));
+                }
+                i += Units;
             }
         }
-        else if ((FirstByte & 0xF0) == 0xE0)
+
+        // Odd trailing byte is kept
+        if (0 != (Size & 1) && pOutput != pInput)
+        {
+            pOutput[Size - 1] = pInput[Size - 1];
+        }
+        return;
+    }
+
+    size_t i = 0;
+    while (i < Size)
+    {
+        size_t Done  = KS_SimdChangeCaseAscii(pInput + i, Size - i, pOutput, Upper, false == AsciiOnly);
+        i           += Done;
+        pOutput     += Done;
+
+        size_t End = (Size - i > 16) ? i + 16 : Size;
+        while (i < End)
         {
-            // 3-byte character
-            if (i + 2 < Utf8Size)
+            uint8_t Byte = pInput[i];
+            if (Byte < 0x80 || true == AsciiOnly)
             {
-                CodePoint = ((FirstByte & 0x0F) << 12) | ((pUtf8[i + 1] & 0x3F) << 6) | (pUtf8[i + 2] & 0x3F);
-                BytesRead = 3;
+                *pOutput++ = (Byte < 0x80) ? (uint8_t)KS_ChangeCaseCodePoint(Byte, Upper) : Byte;
+                ++i;
             }
-            else
+            else if (KSTRING_ENCODING_ANSI == Encoding)
             {
-                break;
+                *pOutput++ = KS_ChangeCaseAnsi(Byte, Upper);
+                ++i;
             }
-        }
-        else if ((FirstByte & 0xF8) == 0xF0)
-        {
-            // 4-byte character (surrogate pair in UTF-16)
-            if (i + 3 < Utf8Size)
+            else
             {
-                CodePoint = ((FirstByte & 0x07) << 18) | ((pUtf8[i + 1] & 0x3F) << 12) | ((pUtf8[i + 2] & 0x3F) << 6) | (pUtf8[i + 3] & 0x3F);
-                BytesRead = 4;
-
-                // Convert to surrogate pair
-                if (CodePoint > 0xFFFF && Utf16Count < MaxUtf16Size - 2)
+                uint32_t CodePoint;
+                size_t   Used = KS_DecodeUtf8(pInput + i, Size - i, &CodePoint);
+                if (KSTRING_REPLACEMENT_CHARACTER == CodePoint)
                 {
-                    CodePoint            -= 0x1'0000;
-                    pUtf16[Utf16Count++]  = (uint16_t)(0xD800 + (CodePoint >> 10));
-                    pUtf16[Utf16Count++]  = (uint16_t)(0xDC00 + (CodePoint & 0x3FF));
+                    memmove(pOutput, pInput + i, Used);
+                    pOutput += Used;
                 }
-                else if (CodePoint <= 0xFFFF)
+                else
                 {
-                    pUtf16[Utf16Count++] = (uint16_t)CodePoint;
+                    pOutput += KS_EncodeUtf8(KS_ChangeCaseCodePoint(CodePoint, Upper), pOutput);
                 }
+                i += Used;
             }
-            else
+        }
+    }
+}
+
+// Flip the case of ASCII letters of an inline string in registers (bytes >= 0x80 and the zero padding are kept)
+inline static void KS_ChangeCaseShortAscii(KString* pStr, bool Upper)
+{
+    uint64_t Low;
+    uint32_t High;
+    memcpy(&Low, pStr->Content, sizeof(Low));
+    memcpy(&High, pStr->Content + sizeof(Low), sizeof(High));
+
+    Low  = KS_SwarChangeCaseAscii64(Low, Upper);
+    High = (uint32_t)KS_SwarChangeCaseAscii64(High, Upper);
+
+    memcpy(pStr->Content, &Low, sizeof(Low));
+    memcpy(pStr->Content + sizeof(Low), &High, sizeof(High));
+}
+
+// Case-map into a new string
+static KString KS_ChangeCaseString(const KString* pStr, bool Upper, bool AsciiOnly)
+{
+    if (false == KStringIsValid(*pStr))
+    {
+        return KStringInvalid();
+    }
+
+    KStringEncoding Encoding = KS_GetEncodingFromField(pStr->Size);
+
+    // Inline byte strings that only need ASCII changes never leave registers
+    if (true == KStringIsShort(*pStr) && false == KS_IsUtf16(Encoding) && (true == AsciiOnly || true == KS_IsShortAscii(pStr)))
+    {
+        KString Result = *pStr;
+        KS_ChangeCaseShortAscii(&Result, Upper);
+        return Result;
+    }
+
+    const uint8_t* pData      = KS_GetSourceData(pStr, Encoding);
+    size_t         Size       = KS_GetSize(pStr);
+    size_t         ResultSize = Size;
+    if (NULL == pData)
+    {
+        return KStringInvalid();
+    }
+    if (false == AsciiOnly && KSTRING_ENCODING_UTF8 == Encoding)
+    {
+        bool SameLengths;
+        ResultSize = KS_ChangeCaseUtf8Size(pData, Size, Upper, &SameLengths);
+    }
+
+    KString Result;
+    char*   pBuffer = KS_PrepareString(&Result, ResultSize, Encoding);
+    if (NULL == pBuffer)
+    {
+        return KStringInvalid();
+    }
+
+    KS_ChangeCase(pData, Size, Encoding, Upper, AsciiOnly, (uint8_t*)pBuffer);
+    KS_FinishString(&Result, pBuffer);
+
+    // Valid code points map to valid code points, invalid sequences are kept: validity carries over
+    if (false == KStringIsShort(Result) && KSTRING_ENCODING_UTF8 == Encoding && true == KS_IsKnownValidUtf8(pStr))
+    {
+        Result.LongStr.PtrAndClass |= KSTRING_UTF8_VALID_FLAG;
+    }
+
+    return Result;
+}
+
+// Case-map the payload of an inline or owned TEMPORARY string
+static bool KS_ChangeCaseInPlace(KString* pStr, bool Upper, bool AsciiOnly)
+{
+    if (NULL == pStr || false == KStringIsValid(*pStr))
+    {
+        return false;
+    }
+
+    // Only payloads owned by the handle may be modified: inline content or TEMPORARY heap payloads (not ropes)
+    uint8_t* pData = (uint8_t*)pStr->Content;
+    if (false == KStringIsShort(*pStr))
+    {
+        uint64_t PtrAndClass = pStr->LongStr.PtrAndClass;
+        if (KSTRING_TEMPORARY != KS_GetStorageClass(PtrAndClass) || true == KS_IsRope(PtrAndClass))
+        {
+            return false;
+        }
+
+        pData = (uint8_t*)KS_GetPointer(PtrAndClass);
+    }
+
+    KStringEncoding Encoding = KS_GetEncodingFromField(pStr->Size);
+    size_t          Size     = KS_GetSize(pStr);
+    if (false == AsciiOnly && KSTRING_ENCODING_UTF8 == Encoding)
+    {
+        // A few mappings change the UTF-8 length (e.g. U+0131 to 'I'): those need a new string
+        bool SameLengths;
+        KS_ChangeCaseUtf8Size(pData, Size, Upper, &SameLengths);
+        if (false == SameLengths)
+        {
+            return false;
+        }
+    }
+
+    // Sizes and validity are unchanged, so the size field and the UTF-8 flag stay as they are
+    KS_ChangeCase(pData, Size, Encoding, Upper, AsciiOnly, pData);
+
+    if (false == KStringIsShort(*pStr))
+    {
+        memcpy(pStr->LongStr.Prefix, pData, 4);
+    }
+
+    return true;
+}
+
+KString KStringToLower(const KString Str)
+{
+    return KS_ChangeCaseString(&Str, false, false);
+}
+
+KString KStringToUpper(const KString Str)
+{
+    return KS_ChangeCaseString(&Str, true, false);
+}
+
+KString KStringToLowerAscii(const KString Str)
+{
+    return KS_ChangeCaseString(&Str, false, true);
+}
+
+KString KStringToUpperAscii(const KString Str)
+{
+    return KS_ChangeCaseString(&Str, true, true);
+}
+
+bool KStringToLowerInPlace(KString* pStr, const bool AsciiOnly)
+{
+    return KS_ChangeCaseInPlace(pStr, false, AsciiOnly);
+}
+
+bool KStringToUpperInPlace(KString* pStr, const bool AsciiOnly)
+{
+    return KS_ChangeCaseInPlace(pStr, true, AsciiOnly);
+}
+
+//
+// Normalization Operations
+//
+
+// Hangul syllable decomposition and composition (Unicode chapter 3.12)
+#define KSTRING_HANGUL_S_BASE  0xAC00
+#define KSTRING_HANGUL_L_BASE  0x1100
+#define KSTRING_HANGUL_V_BASE  0x1161
+#define KSTRING_HANGUL_T_BASE  0x11A7
+#define KSTRING_HANGUL_L_COUNT 19
+#define KSTRING_HANGUL_V_COUNT 21
+#define KSTRING_HANGUL_T_COUNT 28
+#define KSTRING_HANGUL_N_COUNT (KSTRING_HANGUL_V_COUNT * KSTRING_HANGUL_T_COUNT)
+#define KSTRING_HANGUL_S_COUNT (KSTRING_HANGUL_L_COUNT * KSTRING_HANGUL_N_COUNT)
+
+// Element of a code point buffer holding one byte (UTF-8) or unit (UTF-16) of an invalid sequence
+// Raw elements have combining class 0, never compose and are written back unchanged
+#define KSTRING_NORMALIZE_RAW 0x8000'0000U
+
+// Quick check result (UAX #15)
+typedef enum
+{
+    KS_QUICK_CHECK_YES,
+    KS_QUICK_CHECK_NO,
+    KS_QUICK_CHECK_MAYBE
+} KS_QuickCheckResult;
+
+// Canonical combining class (low 8 bits) and quick check flags of a code point
+inline static uint32_t KS_GetNormalizationProperties(uint32_t CodePoint)
+{
+    if (CodePoint >= KSTRING_NORMALIZATION_LIMIT)
+    {
+        return 0;
+    }
+
+    size_t Block = KS_NormalizationStage2[KS_NormalizationStage1[CodePoint >> 9] * 32 + ((CodePoint >> 4) & 31)];
+    return KS_NormalizationProperties[KS_NormalizationStage3[Block * 16 + (CodePoint & 15)]];
+}
+
+// Decode one element (Size even for UTF-16), returns bytes consumed
+// Invalid sequences become raw elements, a real U+FFFD stays a code point
+static size_t KS_NormalizeDecode(const uint8_t* pData, size_t Size, KStringEncoding Encoding, uint32_t* pElement)
+{
+    size_t Used = KS_DecodeCodePoint(pData, Size, Encoding, pElement);
+    if (KSTRING_REPLACEMENT_CHARACTER != *pElement)
+    {
+        return Used;
+    }
+
+    if (KSTRING_ENCODING_UTF8 == Encoding)
+    {
+        if (3 == Used && 0xEF == pData[0] && 0xBF == pData[1] && 0xBD == pData[2])
+        {
+            return Used;
+        }
+
+        // One byte at a time, the following bytes are decoded again
+        *pElement = KSTRING_NORMALIZE_RAW | pData[0];
+        return 1;
+    }
+
+    if (true == KS_IsUtf16(Encoding))
+    {
+        uint32_t Unit = KS_ReadUtf16(pData, KSTRING_ENCODING_UTF16BE == Encoding);
+        if (KSTRING_REPLACEMENT_CHARACTER != Unit)
+        {
+            *pElement = KSTRING_NORMALIZE_RAW | Unit;
+        }
+    }
+
+    return Used;
+}
+
+// Encoded length of an element
+inline static size_t KS_NormalizeEncodedLength(uint32_t Element, KStringEncoding Encoding)
+{
+    if (0 != (Element & KSTRING_NORMALIZE_RAW))
+    {
+        return (true == KS_IsUtf16(Encoding)) ? sizeof(uint16_t) : 1;
+    }
+
+    return KS_EncodedLength(Element, Encoding);
+}
+
+// Encode an element, returns bytes written
+inline static size_t KS_NormalizeEncode(uint32_t Element, KStringEncoding Encoding, uint8_t* pOutput)
+{
+    if (0 == (Element & KSTRING_NORMALIZE_RAW))
+    {
+        return KS_EncodeCodePoint(Element, Encoding, pOutput);
+    }
+
+    if (true == KS_IsUtf16(Encoding))
+    {
+        KS_WriteUtf16(pOutput, Element & 0xFFFF, KSTRING_ENCODING_UTF16BE == Encoding);
+        return sizeof(uint16_t);
+    }
+
+    *pOutput = (uint8_t)Element;
+    return 1;
+}
+
+// Number of leading bytes that are whole code points below Limit (< 0x800, a multiple of 64)
+inline static size_t KS_NormalizeQuickPrefix(const uint8_t* pData, size_t Size, KStringEncoding Encoding, uint32_t Limit)
+{
+    switch (Encoding)
+    {
+        case KSTRING_ENCODING_UTF8:
+        {
+            // Code points below Limit consist of bytes below its lead byte (continuation bytes included)
+            size_t Prefix = KS_SimdBytesBelowPrefix(pData, Size, (uint8_t)(0xC0 | (Limit >> 6)));
+
+            // Stop at the start of a sequence split by the block boundary
+            while (Prefix > 0 && Prefix < Size && 0x80 == (pData[Prefix] & 0xC0))
             {
-                break;
+                --Prefix;
             }
+            return Prefix;
+        }
+        case KSTRING_ENCODING_ANSI:
+            return KS_SimdAsciiPrefix(pData, Size);
+        default:
+            return sizeof(uint16_t) * KS_SimdUtf16BelowPrefix(pData, Size / 2, KSTRING_ENCODING_UTF16BE == Encoding, (uint16_t)Limit);
+    }
+}
+
+// Quick check of a payload (Size even for UTF-16): combining classes in order and no code point with a NO (or MAYBE) flag
+static KS_QuickCheckResult KS_QuickCheck(const uint8_t* pData, size_t Size, KStringEncoding Encoding, bool Decomposed)
+{
+    uint32_t Limit = (true == Decomposed) ? KSTRING_NFD_QUICK_LIMIT : KSTRING_NFC_QUICK_LIMIT;
+    uint32_t No    = (true == Decomposed) ? KSTRING_NFD_QC_NO : KSTRING_NFC_QC_NO;
+
+    KS_QuickCheckResult Result    = KS_QUICK_CHECK_YES;
+    uint32_t            LastClass = 0;
+    size_t              i         = 0;
+    while (i < Size)
+    {
+        // Runs below the limit have combining class 0 and no flags
+        size_t Quick = KS_NormalizeQuickPrefix(pData + i, Size - i, Encoding, Limit);
+        if (Quick > 0)
+        {
+            i         += Quick;
+            LastClass  = 0;
+            continue;
         }
-        else
+
+        uint32_t CodePoint;
+        i += KS_NormalizeDecode(pData + i, Size - i, Encoding, &CodePoint);
+
+        uint32_t Properties = (CodePoint < Limit) ? 0 : KS_GetNormalizationProperties(CodePoint);
+        uint32_t Class      = Properties & 0xFF;
+        if ((0 != Class && LastClass > Class) || 0 != (Properties & No))
         {
-            // Invalid UTF-8 sequence, skip
-            BytesRead = 1;
+            return KS_QUICK_CHECK_NO;
         }
 
-        if (BytesRead < 4 && CodePoint <= 0xFFFF)
+        if (0 != (Properties & KSTRING_NFC_QC_MAYBE) && false == Decomposed)
         {
-            pUtf16[Utf16Count++] = (uint16_t)CodePoint;
+            Result = KS_QUICK_CHECK_MAYBE;
         }
 
-        i += BytesRead;
+        LastClass = Class;
     }
 
-    return Utf16Count;
+    return Result;
 }
 
-// Helper function: Convert UTF-16 (Little Endian) to UTF-8
-static size_t KS_ConvertUtf16LeToUtf8(const uint16_t* pUtf16, size_t Utf16Size, char* pUtf8, size_t MaxUtf8Size)
+// Full canonical decomposition of an element into pOutput, returns the number of code points
+static size_t KS_DecomposeElement(uint32_t Element, uint32_t pOutput[KSTRING_DECOMPOSITION_MAX_LENGTH])
 {
-    size_t Utf8Count = 0;
-    size_t i         = 0;
-
-    while (i < Utf16Size && Utf8Count < MaxUtf8Size - 4)
+    uint32_t SIndex = Element - KSTRING_HANGUL_S_BASE;
+    if (SIndex < KSTRING_HANGUL_S_COUNT)
     {
-        uint32_t CodePoint = pUtf16[i];
+        pOutput[0] = KSTRING_HANGUL_L_BASE + SIndex / KSTRING_HANGUL_N_COUNT;
+        pOutput[1] = KSTRING_HANGUL_V_BASE + (SIndex % KSTRING_HANGUL_N_COUNT) / KSTRING_HANGUL_T_COUNT;
+        pOutput[2] = KSTRING_HANGUL_T_BASE + SIndex % KSTRING_HANGUL_T_COUNT;
+        return (KSTRING_HANGUL_T_BASE == pOutput[2]) ? 2 : 3;
+    }
 
-        // Handle surrogate pairs
-        if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && i + 1 < Utf16Size)
+    if (0 != (KS_GetNormalizationProperties(Element) & KSTRING_NFD_QC_NO))
+    {
+        // Binary search in the sorted table
+        const size_t Entries = sizeof(KS_DecompositionCodePoints) / sizeof(KS_DecompositionCodePoints[0]);
+        size_t       Low     = 0;
+        size_t       High    = Entries;
+        while (Low < High)
         {
-            uint32_t LowSurrogate = pUtf16[i + 1];
-            if (LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF)
+            size_t Middle = (Low + High) / 2;
+            if (KS_DecompositionCodePoints[Middle] < Element)
             {
-                CodePoint  = 0x1'0000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
-                i         += 2;
+                Low = Middle + 1;
             }
             else
             {
-                i++;
-                continue; // Invalid surrogate pair
+                High = Middle;
             }
         }
-        else
-        {
-            i++;
-        }
 
-        // Convert code point to UTF-8
-        if (CodePoint < 0x80)
-        {
-            pUtf8[Utf8Count++] = (char)CodePoint;
-        }
-        else if (CodePoint < 0x800)
-        {
-            pUtf8[Utf8Count++] = (char)(0xC0 | (CodePoint >> 6));
-            pUtf8[Utf8Count++] = (char)(0x80 | (CodePoint & 0x3F));
-        }
-        else if (CodePoint < 0x1'0000)
-        {
-            pUtf8[Utf8Count++] = (char)(0xE0 | (CodePoint >> 12));
-            pUtf8[Utf8Count++] = (char)(0x80 | ((CodePoint >> 6) & 0x3F));
-            pUtf8[Utf8Count++] = (char)(0x80 | (CodePoint & 0x3F));
-        }
-        else if (CodePoint < 0x11'0000)
+        if (Low < Entries && KS_DecompositionCodePoints[Low] == Element)
         {
-            pUtf8[Utf8Count++] = (char)(0xF0 | (CodePoint >> 18));
-            pUtf8[Utf8Count++] = (char)(0x80 | ((CodePoint >> 12) & 0x3F));
-            pUtf8[Utf8Count++] = (char)(0x80 | ((CodePoint >> 6) & 0x3F));
-            pUtf8[Utf8Count++] = (char)(0x80 | (CodePoint & 0x3F));
+            size_t Count = (size_t)(KS_DecompositionOffsets[Low + 1] - KS_DecompositionOffsets[Low]);
+            memcpy(pOutput, KS_DecompositionData + KS_DecompositionOffsets[Low], Count * sizeof(uint32_t));
+            return Count;
         }
     }
 
-    return Utf8Count;
+    pOutput[0] = Element;
+    return 1;
 }
 
-// Helper function: Convert UTF-8 to ANSI (Windows-1252)
-static size_t KS_ConvertUtf8ToAnsi(const char* pUtf8, size_t Utf8Size, char* pAnsi, size_t MaxAnsiSize)
+// Primary composite of a pair (0 if the pair does not compose)
+static uint32_t KS_ComposePair(uint32_t First, uint32_t Second)
 {
-    size_t AnsiCount = 0;
-    size_t i         = 0;
+    uint32_t LIndex = First - KSTRING_HANGUL_L_BASE;
+    uint32_t VIndex = Second - KSTRING_HANGUL_V_BASE;
+    if (LIndex < KSTRING_HANGUL_L_COUNT && VIndex < KSTRING_HANGUL_V_COUNT)
+    {
+        return KSTRING_HANGUL_S_BASE + LIndex * KSTRING_HANGUL_N_COUNT + VIndex * KSTRING_HANGUL_T_COUNT;
+    }
 
-    // Simple lookup table for common UTF-8 -> Windows-1252 conversions
-    // This is a simplified version - a complete implementation would need full mapping tables
-    while (i < Utf8Size && AnsiCount < MaxAnsiSize - 1)
+    uint32_t SIndex = First - KSTRING_HANGUL_S_BASE;
+    uint32_t TIndex = Second - KSTRING_HANGUL_T_BASE;
+    if (SIndex < KSTRING_HANGUL_S_COUNT && 0 == SIndex % KSTRING_HANGUL_T_COUNT && TIndex - 1 < KSTRING_HANGUL_T_COUNT - 1)
     {
-        uint8_t FirstByte = (uint8_t)pUtf8[i];
+        return First + TIndex;
+    }
 
-        if (FirstByte < 0x80)
-        {
-            // ASCII characters map directly
-            pAnsi[AnsiCount++] = pUtf8[i];
-            i++;
-        }
-        else if ((FirstByte & 0xE0) == 0xC0 && i + 1 < Utf8Size)
+    const size_t Entries = sizeof(KS_CompositionPairs) / sizeof(KS_CompositionPairs[0]);
+    uint64_t     Key     = ((uint64_t)First << 21) | Second;
+    size_t       Low     = 0;
+    size_t       High    = Entries;
+    while (Low < High)
+    {
+        size_t Middle = (Low + High) / 2;
+        if (KS_CompositionPairs[Middle] < Key)
         {
-            // 2-byte UTF-8 character
-            uint32_t CodePoint = ((FirstByte & 0x1F) << 6) | (pUtf8[i + 1] & 0x3F);
-
-            // Map common characters to Windows-1252
-            if (CodePoint <= 0xFF)
-            {
-                pAnsi[AnsiCount++] = (char)CodePoint;
-            }
-            else
-            {
-                // Unmappable character, use replacement
-                pAnsi[AnsiCount++] = '?';
-            }
-            i += 2;
+            Low = Middle + 1;
         }
         else
         {
-            // Multi-byte character that doesn't map to ANSI, use replacement
-            pAnsi[AnsiCount++] = '?';
-            // Skip UTF-8 sequence
-            if ((FirstByte & 0xF0) == 0xE0)
-            {
-                i += 3;
-            }
-            else if ((FirstByte & 0xF8) == 0xF0)
-            {
-                i += 4;
-            }
-            else
-            {
-                i += 1;
-            }
+            High = Middle;
         }
     }
 
-    return AnsiCount;
+    return (Low < Entries && KS_CompositionPairs[Low] == Key) ? KS_CompositionResults[Low] : 0;
 }
 
-// Helper function: Convert ANSI (Windows-1252) to UTF-8
-static size_t KS_ConvertAnsiToUtf8(const char* pAnsi, size_t AnsiSize, char* pUtf8, size_t MaxUtf8Size)
+// Canonical composition of a decomposed buffer in place, returns the new element count
+static size_t KS_Compose(uint32_t* pBuffer, size_t Count)
 {
-    size_t Utf8Count = 0;
-
-    for (size_t i = 0; i < AnsiSize && Utf8Count < MaxUtf8Size - 3; i++)
+    size_t   Written   = 0;
+    size_t   Starter   = SIZE_MAX;
+    uint32_t LastClass = 0;
+    for (size_t i = 0; i < Count; ++i)
     {
-        uint8_t AnsiChar = (uint8_t)pAnsi[i];
+        uint32_t Element    = pBuffer[i];
+        uint32_t Properties = KS_GetNormalizationProperties(Element);
+        uint32_t Class      = Properties & 0xFF;
 
-        if (AnsiChar < 0x80)
-        {
-            // ASCII characters map directly
-            pUtf8[Utf8Count++] = pAnsi[i];
-        }
-        else
+        // Only characters that can combine backwards (NFC_QC=Maybe) are tried: next to the starter,
+        // or not blocked by a character in between of class 0 or of the same or a higher class
+        if (SIZE_MAX != Starter && 0 != (Properties & KSTRING_NFC_QC_MAYBE) && (Written == Starter + 1 || LastClass < Class))
         {
-            // Windows-1252 extended characters (0x80-0xFF)
-            // Convert to UTF-8 (most map to 2-byte sequences)
-            uint32_t CodePoint = AnsiChar; // Simplified - real implementation needs full mapping
-
-            if (CodePoint < 0x800)
-            {
-                pUtf8[Utf8Count++] = (char)(0xC0 | (CodePoint >> 6));
-                pUtf8[Utf8Count++] = (char)(0x80 | (CodePoint & 0x3F));
-            }
-            else
+            uint32_t Composite = KS_ComposePair(pBuffer[Starter], Element);
+            if (0 != Composite)
             {
-                pUtf8[Utf8Count++] = (char)(0xE0 | (CodePoint >> 12));
-                pUtf8[Utf8Count++] = (char)(0x80 | ((CodePoint >> 6) & 0x3F));
-                pUtf8[Utf8Count++] = (char)(0x80 | (CodePoint & 0x3F));
+                pBuffer[Starter] = Composite;
+                continue;
             }
         }
+
+        if (0 == Class)
+        {
+            Starter = Written;
+        }
+
+        LastClass          = Class;
+        pBuffer[Written++] = Element;
     }
 
-    return Utf8Count;
+    return Written;
 }
 
-// Convert string to different encoding
-KString KStringConvertToEncoding(const KString Str, const KStringEncoding TargetEncoding)
+// Normalize a payload (Size even for UTF-16) into a heap buffer of elements, returns NULL if out of memory
+static uint32_t* KS_NormalizeToBuffer(const uint8_t* pData, size_t Size, KStringEncoding Encoding, bool Decomposed, size_t* pCount)
 {
-    if (false == KStringIsValid(Str))
+    uint32_t Decomposition[KSTRING_DECOMPOSITION_MAX_LENGTH];
+
+    // Pass 1: exact length of the full decomposition
+    size_t Count = 0;
+    for (size_t i = 0; i < Size;)
     {
-        return KStringInvalid();
+        uint32_t Element;
+        i     += KS_NormalizeDecode(pData + i, Size - i, Encoding, &Element);
+        Count += (Element < KSTRING_NFD_QUICK_LIMIT) ? 1 : KS_DecomposeElement(Element, Decomposition);
     }
 
-    KStringEncoding SourceEncoding = KS_GetEncodingFromField(Str.Size);
-
-    // If already the target encoding, return a copy
-    if (SourceEncoding == TargetEncoding)
+    uint32_t* pBuffer = (Count < SIZE_MAX / sizeof(uint32_t)) ? (uint32_t*)malloc((Count + 1) * sizeof(uint32_t)) : NULL;
+    if (NULL == pBuffer)
     {
-        size_t      StrSize = KS_GetSizeFromField(Str.Size);
-        const char* pData   = (true == KStringIsShort(Str)) ? Str.Content : (const char*)KS_GetPointer(Str.LongStr.PtrAndClass);
-        return KStringCreateWithEncoding(pData, StrSize, TargetEncoding);
+        return NULL;
     }
 
-    // Route to specific conversion functions
-    switch (SourceEncoding)
+    // Pass 2: decompose, then sort each run of non-starters by combining class (stable)
+    size_t k = 0;
+    for (size_t i = 0; i < Size;)
     {
-        case KSTRING_ENCODING_UTF8:
-            switch (TargetEncoding)
-            {
-                case KSTRING_ENCODING_UTF16LE:
-                    return KStringConvertUtf8ToUtf16Le(Str);
-                case KSTRING_ENCODING_UTF16BE:
-                    return KStringConvertUtf8ToUtf16Be(Str);
-                case KSTRING_ENCODING_ANSI:
-                    return KStringConvertUtf8ToAnsi(Str);
-                default:
-                    return KStringInvalid();
-            }
-
-        case KSTRING_ENCODING_UTF16LE:
-            switch (TargetEncoding)
-            {
-                case KSTRING_ENCODING_UTF8:
-                    return KStringConvertUtf16LeToUtf8(Str);
-                case KSTRING_ENCODING_UTF16BE:
-                    return KStringConvertUtf16LeToUtf16Be(Str);
-                case KSTRING_ENCODING_ANSI:
-                {
-                    // Convert UTF-16LE -> UTF-8 -> ANSI
-                    KString Utf8Str = KStringConvertUtf16LeToUtf8(Str);
-                    if (false == KStringIsValid(Utf8Str))
-                    {
-                        return KStringInvalid();
-                    }
-                    KString AnsiStr = KStringConvertUtf8ToAnsi(Utf8Str);
-                    KStringDestroy(Utf8Str);
-                    return AnsiStr;
-                }
-                default:
-                    return KStringInvalid();
-            }
+        uint32_t Element;
+        i += KS_NormalizeDecode(pData + i, Size - i, Encoding, &Element);
+        if (Element < KSTRING_NFD_QUICK_LIMIT)
+        {
+            pBuffer[k++] = Element;
+            continue;
+        }
 
-        case KSTRING_ENCODING_UTF16BE:
-            switch (TargetEncoding)
+        size_t Length = KS_DecomposeElement(Element, Decomposition);
+        for (size_t j = 0; j < Length; ++j)
+        {
+            uint32_t CodePoint = Decomposition[j];
+            uint32_t Class     = KS_GetNormalizationProperties(CodePoint) & 0xFF;
+            size_t   Position  = k++;
+            while (0 != Class && Position > 0 && (KS_GetNormalizationProperties(pBuffer[Position - 1]) & 0xFF) > Class)
             {
-                case KSTRING_ENCODING_UTF8:
-                    return KStringConvertUtf16BeToUtf8(Str);
-                case KSTRING_ENCODING_UTF16LE:
-                    return KStringConvertUtf16BeToUtf16Le(Str);
-                case KSTRING_ENCODING_ANSI:
-                {
-                    // Convert UTF-16BE -> UTF-8 -> ANSI
-                    KString Utf8Str = KStringConvertUtf16BeToUtf8(Str);
-                    if (false == KStringIsValid(Utf8Str))
-                    {
-                        return KStringInvalid();
-                    }
-                    KString AnsiStr = KStringConvertUtf8ToAnsi(Utf8Str);
-                    KStringDestroy(Utf8Str);
-                    return AnsiStr;
-                }
-                default:
-                    return KStringInvalid();
+                pBuffer[Position] = pBuffer[Position - 1];
+                --Position;
             }
+            pBuffer[Position] = CodePoint;
+        }
+    }
 
-        case KSTRING_ENCODING_ANSI:
-            switch (TargetEncoding)
-            {
-                case KSTRING_ENCODING_UTF8:
-                    return KStringConvertAnsiToUtf8(Str);
-                case KSTRING_ENCODING_UTF16LE:
-                {
-                    // Convert ANSI -> UTF-8 -> UTF-16LE
-                    KString Utf8Str = KStringConvertAnsiToUtf8(Str);
-                    if (false == KStringIsValid(Utf8Str))
-                    {
-                        return KStringInvalid();
-                    }
-                    KString Utf16LeStr = KStringConvertUtf8ToUtf16Le(Utf8Str);
-                    KStringDestroy(Utf8Str);
-                    return Utf16LeStr;
-                }
-                case KSTRING_ENCODING_UTF16BE:
-                {
-                    // Convert ANSI -> UTF-8 -> UTF-16BE
-                    KString Utf8Str = KStringConvertAnsiToUtf8(Str);
-                    if (false == KStringIsValid(Utf8Str))
-                    {
-                        return KStringInvalid();
-                    }
-                    KString Utf16BeStr = KStringConvertUtf8ToUtf16Be(Utf8Str);
-                    KStringDestroy(Utf8Str);
-                    return Utf16BeStr;
-                }
-                default:
-                    return KStringInvalid();
-            }
+    *pCount = (true == Decomposed) ? Count : KS_Compose(pBuffer, Count);
+    return pBuffer;
+}
 
-        default:
-            return KStringInvalid();
+// Check if a normalized buffer equals the elements of a payload (Size even for UTF-16)
+static bool KS_NormalizedEquals(const uint32_t* pBuffer, size_t Count, const uint8_t* pData, size_t Size, KStringEncoding Encoding)
+{
+    size_t k = 0;
+    for (size_t i = 0; i < Size;)
+    {
+        uint32_t Element;
+        i += KS_NormalizeDecode(pData + i, Size - i, Encoding, &Element);
+        if (k >= Count || pBuffer[k++] != Element)
+        {
+            return false;
+        }
     }
+
+    return k == Count;
 }
 
-// UTF-8 <-> UTF-16LE conversion
-KString KStringConvertUtf8ToUtf16Le(const KString Str)
+// Normalize into a new string, or a borrowed view of the input if it is normalized already
+static KString KS_Normalize(const KString* pStr, bool Decomposed)
 {
-    if (false == KStringIsValid(Str) || KS_GetEncodingFromField(Str.Size) != KSTRING_ENCODING_UTF8)
+    if (false == KStringIsValid(*pStr))
     {
         return KStringInvalid();
     }
 
-    size_t      Utf8Size  = KS_GetSizeFromField(Str.Size);
-    const char* pUtf8Data = (true == KStringIsShort(Str)) ? Str.Content : (const char*)KS_GetPointer(Str.LongStr.PtrAndClass);
-
-    // Estimate UTF-16 size (worst case: each UTF-8 byte becomes a UTF-16 character)
-    size_t    MaxUtf16Count = Utf8Size;
-    uint16_t* pUtf16Buffer  = (uint16_t*)KS_Alloc((MaxUtf16Count + 1) * sizeof(uint16_t));
-    if (NULL == pUtf16Buffer)
+    KStringEncoding Encoding = KS_GetEncodingFromField(pStr->Size);
+    const uint8_t*  pData    = KS_GetSourceData(pStr, Encoding);
+    size_t          Size     = KS_GetSize(pStr);
+    if (NULL == pData)
     {
         return KStringInvalid();
     }
 
-    size_t Utf16Count = KS_ConvertUtf8ToUtf16Le(pUtf8Data, Utf8Size, pUtf16Buffer, MaxUtf16Count);
+    // A trailing odd UTF-16 byte is kept as it is
+    size_t Even = (true == KS_IsUtf16(Encoding)) ? Size & ~(size_t)1 : Size;
 
-    KString Result = KStringCreateWithEncoding((const char*)pUtf16Buffer, Utf16Count * sizeof(uint16_t), KSTRING_ENCODING_UTF16LE);
-    KS_Release((void**)&pUtf16Buffer);
+    uint32_t*           pBuffer = NULL;
+    size_t              Count   = 0;
+    KS_QuickCheckResult Check   = KS_QuickCheck(pData, Even, Encoding, Decomposed);
+    if (KS_QUICK_CHECK_YES != Check)
+    {
+        pBuffer = KS_NormalizeToBuffer(pData, Even, Encoding, Decomposed, &Count);
+        if (NULL == pBuffer)
+        {
+            return KStringInvalid();
+        }
 
-    return Result;
-}
+        // MAYBE results mostly turn out to be normalized
+        if (KS_QUICK_CHECK_MAYBE == Check && true == KS_NormalizedEquals(pBuffer, Count, pData, Even, Encoding))
+        {
+            free(pBuffer);
+            pBuffer = NULL;
+        }
+    }
 
-KString KStringConvertUtf16LeToUtf8(const KString Str)
-{
-    if (false == KStringIsValid(Str) || KS_GetEncodingFromField(Str.Size) != KSTRING_ENCODING_UTF16LE)
+    if (NULL == pBuffer)
     {
-        return KStringInvalid();
+        return (true == KStringIsShort(*pStr)) ? *pStr : KStringSubstringView(*pStr, 0, Size);
     }
 
-    size_t          Utf16Size  = KS_GetSizeFromField(Str.Size) / sizeof(uint16_t);
-    const uint16_t* pUtf16Data = (const uint16_t*)((true == KStringIsShort(Str)) ? Str.Content : KS_GetPointer(Str.LongStr.PtrAndClass));
+    size_t ResultSize = Size - Even;
+    for (size_t k = 0; k < Count; ++k)
+    {
+        // Windows-1252 has no combining characters: decomposed forms cannot be represented
+        if (KSTRING_ENCODING_ANSI == Encoding && '?' == KS_CodePointToAnsi(pBuffer[k]) && '?' != pBuffer[k])
+        {
+            free(pBuffer);
+            return KStringInvalid();
+        }
+
+        ResultSize += KS_NormalizeEncodedLength(pBuffer[k], Encoding);
+    }
 
-    // Estimate UTF-8 size (worst case: each UTF-16 character becomes 4 UTF-8 bytes)
-    size_t MaxUtf8Size = Utf16Size * 4;
-    char*  pUtf8Buffer = KS_Alloc(MaxUtf8Size + 1);
-    if (NULL == pUtf8Buffer)
+    KString Result;
+    char*   pOutput = KS_PrepareString(&Result, ResultSize, Encoding);
+    if (NULL == pOutput)
     {
+        free(pBuffer);
         return KStringInvalid();
     }
 
-    size_t Utf8Count = KS_ConvertUtf16LeToUtf8(pUtf16Data, Utf16Size, pUtf8Buffer, MaxUtf8Size);
-
-    KString Result = KStringCreateWithEncoding(pUtf8Buffer, Utf8Count, KSTRING_ENCODING_UTF8);
-    KS_Release((void**)&pUtf8Buffer);
-
-    return Result;
-}
-
-// UTF-8 <-> UTF-16BE conversion
-KString KStringConvertUtf8ToUtf16Be(const KString Str)
-{
-    // First convert to UTF-16LE, then swap bytes
-    KString Utf16LeStr = KStringConvertUtf8ToUtf16Le(Str);
-    if (false == KStringIsValid(Utf16LeStr))
+    uint8_t* pWrite = (uint8_t*)pOutput;
+    for (size_t k = 0; k < Count; ++k)
     {
-        return KStringInvalid();
+        pWrite += KS_NormalizeEncode(pBuffer[k], Encoding, pWrite);
+    }
+    if (Even < Size)
+    {
+        *pWrite = pData[Even];
     }
 
-    return KStringConvertUtf16LeToUtf16Be(Utf16LeStr);
-}
+    free(pBuffer);
+    KS_FinishString(&Result, pOutput);
 
-KString KStringConvertUtf16BeToUtf8(const KString Str)
-{
-    // First convert to UTF-16LE, then convert to UTF-8
-    KString Utf16LeStr = KStringConvertUtf16BeToUtf16Le(Str);
-    if (false == KStringIsValid(Utf16LeStr))
+    // Code points stay valid and invalid sequences are kept: validity carries over
+    if (false == KStringIsShort(Result) && KSTRING_ENCODING_UTF8 == Encoding && true == KS_IsKnownValidUtf8(pStr))
     {
-        return KStringInvalid();
+        Result.LongStr.PtrAndClass |= KSTRING_UTF8_VALID_FLAG;
     }
 
-    KString Result = KStringConvertUtf16LeToUtf8(Utf16LeStr);
-    KStringDestroy(Utf16LeStr);
-
     return Result;
 }
 
-// UTF-16LE <-> UTF-16BE conversion (byte swapping)
-KString KStringConvertUtf16LeToUtf16Be(const KString Str)
+bool KStringIsNormalized(const KString Str, const KStringNormalizationForm Form)
 {
-    if (false == KStringIsValid(Str) || KS_GetEncodingFromField(Str.Size) != KSTRING_ENCODING_UTF16LE)
+    if (false == KStringIsValid(Str))
     {
-        return KStringInvalid();
+        return false;
     }
 
-    size_t      DataSize    = KS_GetSizeFromField(Str.Size);
-    const char* pSourceData = (true == KStringIsShort(Str)) ? Str.Content : (const char*)KS_GetPointer(Str.LongStr.PtrAndClass);
+    KStringEncoding Encoding   = KS_GetEncodingFromField(Str.Size);
+    const uint8_t*  pData      = KS_GetSourceData(&Str, Encoding);
+    size_t          Size       = KS_GetSize(&Str);
+    size_t          Even       = (true == KS_IsUtf16(Encoding)) ? Size & ~(size_t)1 : Size;
+    bool            Decomposed = KSTRING_NORMALIZATION_NFD == Form;
+    if (NULL == pData)
+    {
+        return false;
+    }
 
-    char* pSwappedData = KS_Alloc(DataSize + 2); // +2 for potential null terminator
-    if (NULL == pSwappedData)
+    KS_QuickCheckResult Check = KS_QuickCheck(pData, Even, Encoding, Decomposed);
+    if (KS_QUICK_CHECK_MAYBE != Check)
     {
-        return KStringInvalid();
+        return KS_QUICK_CHECK_YES == Check;
     }
 
-    // Swap bytes for UTF-16 byte order conversion
-    for (size_t i = 0; i < DataSize - 1; i += 2)
+    // Characters that may combine with their predecessor: compare with the full normalization
+    size_t    Count;
+    uint32_t* pBuffer = KS_NormalizeToBuffer(pData, Even, Encoding, Decomposed, &Count);
+    if (NULL == pBuffer)
     {
-        pSwappedData[i]     = pSourceData[i + 1]; // High byte
-        pSwappedData[i + 1] = pSourceData[i];     // Low byte
+        return false;
     }
 
-    KString Result = KStringCreateWithEncoding(pSwappedData, DataSize, KSTRING_ENCODING_UTF16BE);
-    KS_Release((void**)&pSwappedData);
+    bool Normalized = KS_NormalizedEquals(pBuffer, Count, pData, Even, Encoding);
+    free(pBuffer);
+    return Normalized;
+}
 
-    return Result;
+KString KStringNormalizeNFC(const KString Str)
+{
+    return KS_Normalize(&Str, false);
 }
 
-KString KStringConvertUtf16BeToUtf16Le(const KString Str)
+KString KStringNormalizeNFD(const KString Str)
 {
-    if (false == KStringIsValid(Str) || KS_GetEncodingFromField(Str.Size) != KSTRING_ENCODING_UTF16BE)
-    {
-        return KStringInvalid();
-    }
+    return KS_Normalize(&Str, true);
+}
+
+//
+// Streaming Transcoder Operations
+//
 
-    size_t      DataSize    = KS_GetSizeFromField(Str.Size);
-    const char* pSourceData = (true == KStringIsShort(Str)) ? Str.Content : (const char*)KS_GetPointer(Str.LongStr.PtrAndClass);
+// Copy, widen or narrow a leading ASCII run (limited by the output capacity), returns bytes consumed
+static size_t KS_TranscoderAsciiRun(const KStringTranscoder* pTranscoder, const uint8_t* pInput, size_t InputSize, uint8_t* pOutput, size_t Capacity, size_t* pWritten)
+{
+    KStringEncoding Source = pTranscoder->SourceEncoding;
+    KStringEncoding Target = pTranscoder->TargetEncoding;
 
-    char* pSwappedData = KS_Alloc(DataSize + 2); // +2 for potential null terminator
-    if (NULL == pSwappedData)
+    if (false == KS_IsUtf16(Source))
     {
-        return KStringInvalid();
+        // UTF-8/ANSI source: ASCII bytes stay ASCII bytes or become single UTF-16 units
+        size_t Limit = (true == KS_IsUtf16(Target)) ? Capacity / 2 : Capacity;
+        size_t Ascii = KS_SimdAsciiPrefix(pInput, (InputSize < Limit) ? InputSize : Limit);
+
+        if (true == KS_IsUtf16(Target))
+        {
+            bool   BigEndian = KSTRING_ENCODING_UTF16BE == Target;
+            size_t i         = KS_SimdWidenAsciiToUtf16(pInput, Ascii, pOutput, BigEndian);
+            for (; i < Ascii; ++i)
+            {
+                KS_WriteUtf16(pOutput + 2 * i, pInput[i], BigEndian);
+            }
+            *pWritten = 2 * Ascii;
+        }
+        else
+        {
+            memcpy(pOutput, pInput, Ascii);
+            *pWritten = Ascii;
+        }
+
+        return Ascii;
     }
 
-    // Swap bytes for UTF-16 byte order conversion
-    for (size_t i = 0; i < DataSize - 1; i += 2)
+    if (false == KS_IsUtf16(Target))
     {
-        pSwappedData[i]     = pSourceData[i + 1]; // High byte
-        pSwappedData[i + 1] = pSourceData[i];     // Low byte
+        // UTF-16 source, byte target: narrow whole ASCII blocks
+        size_t Units = InputSize / 2;
+        size_t Count = KS_SimdNarrowUtf16ToAscii(pInput, (Units < Capacity) ? Units : Capacity, pOutput, KSTRING_ENCODING_UTF16BE == Source);
+        *pWritten    = Count;
+        return 2 * Count;
     }
 
-    KString Result = KStringCreateWithEncoding(pSwappedData, DataSize, KSTRING_ENCODING_UTF16LE);
-    KS_Release((void**)&pSwappedData);
+    *pWritten = 0;
+    return 0;
+}
 
-    return Result;
+// Report the progress of a call, false if it could neither consume input nor write output (the output buffer is too small)
+static bool KS_TranscoderProgress(size_t InputSize, size_t InputConsumed, size_t OutputWritten, size_t* pInputConsumed, size_t* pOutputWritten)
+{
+    *pInputConsumed = InputConsumed;
+    *pOutputWritten = OutputWritten;
+    return 0 == InputSize || 0 != InputConsumed || 0 != OutputWritten;
 }
 
-// UTF-8 <-> ANSI conversion
-KString KStringConvertUtf8ToAnsi(const KString Str)
+void KStringTranscoderInit(KStringTranscoder* pTranscoder, const KStringEncoding SourceEncoding, const KStringEncoding TargetEncoding)
 {
-    if (false == KStringIsValid(Str) || KS_GetEncodingFromField(Str.Size) != KSTRING_ENCODING_UTF8)
+    if (NULL == pTranscoder)
     {
-        return KStringInvalid();
+        return;
     }
 
-    size_t      Utf8Size  = KS_GetSizeFromField(Str.Size);
-    const char* pUtf8Data = (true == KStringIsShort(Str)) ? Str.Content : (const char*)KS_GetPointer(Str.LongStr.PtrAndClass);
+    pTranscoder->SourceEncoding = SourceEncoding;
+    pTranscoder->TargetEncoding = TargetEncoding;
+    pTranscoder->PendingSize    = 0;
+    memset(pTranscoder->Pending, 0, sizeof(pTranscoder->Pending));
+}
 
-    char* pAnsiBuffer = KS_Alloc(Utf8Size + 1); // ANSI is typically smaller than UTF-8
-    if (NULL == pAnsiBuffer)
+bool KStringTranscoderProcess(KStringTranscoder* pTranscoder, const void* pInput, const size_t InputSize, size_t* pInputConsumed, void* pOutput,
+                              const size_t OutputCapacity, size_t* pOutputWritten)
+{
+    if (NULL == pTranscoder || NULL == pInputConsumed || NULL == pOutputWritten || (NULL == pInput && 0 != InputSize) || (NULL == pOutput && 0 != OutputCapacity))
     {
-        return KStringInvalid();
+        return false;
     }
 
-    size_t AnsiCount = KS_ConvertUtf8ToAnsi(pUtf8Data, Utf8Size, pAnsiBuffer, Utf8Size);
+    const uint8_t*  pIn     = (const uint8_t*)pInput;
+    uint8_t*        pOut    = (uint8_t*)pOutput;
+    size_t          In      = 0;
+    size_t          Out     = 0;
+    KStringEncoding Source  = pTranscoder->SourceEncoding;
+    KStringEncoding Target  = pTranscoder->TargetEncoding;
+    uint32_t        CodePoint;
 
-    KString Result = KStringCreateWithEncoding(pAnsiBuffer, AnsiCount, KSTRING_ENCODING_ANSI);
-    KS_Release((void**)&pAnsiBuffer);
+    // Complete a sequence split by the previous chunk
+    while (0 != pTranscoder->PendingSize)
+    {
+        size_t Taken = 0;
+        while (In + Taken < InputSize && true == KS_IsIncompleteSequence(pTranscoder->Pending, pTranscoder->PendingSize, Source))
+        {
+            pTranscoder->Pending[pTranscoder->PendingSize++] = pIn[In + Taken++];
+        }
 
-    return Result;
-}
+        if (true == KS_IsIncompleteSequence(pTranscoder->Pending, pTranscoder->PendingSize, Source))
+        {
+            // Still incomplete: the rest of the chunk went into the carry-over
+            return KS_TranscoderProgress(InputSize, In + Taken, Out, pInputConsumed, pOutputWritten);
+        }
 
-KString KStringConvertAnsiToUtf8(const KString Str)
-{
-    if (false == KStringIsValid(Str) || KS_GetEncodingFromField(Str.Size) != KSTRING_ENCODING_ANSI)
+        size_t Used = KS_DecodeCodePoint(pTranscoder->Pending, pTranscoder->PendingSize, Source, &CodePoint);
+        if (KS_EncodedLength(CodePoint, Target) > OutputCapacity - Out)
+        {
+            // No room: give the taken bytes back and keep the carry-over
+            pTranscoder->PendingSize -= (uint8_t)Taken;
+            return KS_TranscoderProgress(InputSize, In, Out, pInputConsumed, pOutputWritten);
+        }
+
+        Out += KS_EncodeCodePoint(CodePoint, Target, pOut + Out);
+
+        // Bytes the decoder did not use (they ended an invalid sequence) are read again
+        size_t Leftover = pTranscoder->PendingSize - Used;
+        if (Leftover <= Taken)
+        {
+            In                       += Taken - Leftover;
+            pTranscoder->PendingSize  = 0;
+        }
+        else
+        {
+            // Some of them came from an earlier chunk and stay in the carry-over
+            size_t Kept = Leftover - Taken;
+            memmove(pTranscoder->Pending, pTranscoder->Pending + Used, Kept);
+            pTranscoder->PendingSize = (uint8_t)Kept;
+        }
+    }
+
+    while (In < InputSize)
     {
-        return KStringInvalid();
+        size_t Written;
+        size_t Consumed  = KS_TranscoderAsciiRun(pTranscoder, pIn + In, InputSize - In, pOut + Out, OutputCapacity - Out, &Written);
+        In              += Consumed;
+        Out             += Written;
+
+        // Scalar for a few code points (or until the output is full), then try the ASCII run again
+        for (size_t Step = 0; Step < 16 && In < InputSize; ++Step)
+        {
+            size_t Remaining = InputSize - In;
+            if (Remaining < 4 && true == KS_IsIncompleteSequence(pIn + In, Remaining, Source))
+            {
+                // Carry the incomplete tail over to the next chunk
+                memcpy(pTranscoder->Pending, pIn + In, Remaining);
+                pTranscoder->PendingSize = (uint8_t)Remaining;
+                In                       = InputSize;
+                break;
+            }
+
+            size_t Used = KS_DecodeCodePoint(pIn + In, Remaining, Source, &CodePoint);
+            if (KS_EncodedLength(CodePoint, Target) > OutputCapacity - Out)
+            {
+                return KS_TranscoderProgress(InputSize, In, Out, pInputConsumed, pOutputWritten);
+            }
+
+            Out += KS_EncodeCodePoint(CodePoint, Target, pOut + Out);
+            In  += Used;
+        }
+
+        if (0 == Consumed && Out == OutputCapacity)
+        {
+            break;
+        }
     }
 
-    size_t      AnsiSize  = KS_GetSizeFromField(Str.Size);
-    const char* pAnsiData = (true == KStringIsShort(Str)) ? Str.Content : (const char*)KS_GetPointer(Str.LongStr.PtrAndClass);
+    return KS_TranscoderProgress(InputSize, In, Out, pInputConsumed, pOutputWritten);
+}
 
-    char* pUtf8Buffer = KS_Alloc(AnsiSize * 3 + 1); // UTF-8 can be up to 3x larger
-    if (NULL == pUtf8Buffer)
+bool KStringTranscoderFinish(KStringTranscoder* pTranscoder, void* pOutput, const size_t OutputCapacity, size_t* pOutputWritten)
+{
+    if (NULL == pTranscoder || NULL == pOutputWritten)
     {
-        return KStringInvalid();
+        return false;
     }
 
-    size_t Utf8Count = KS_ConvertAnsiToUtf8(pAnsiData, AnsiSize, pUtf8Buffer, AnsiSize * 3);
+    *pOutputWritten = 0;
+    if (0 != pTranscoder->PendingSize)
+    {
+        // Input ended inside a sequence: emit one replacement character
+        if (NULL == pOutput || KS_EncodedLength(KSTRING_REPLACEMENT_CHARACTER, pTranscoder->TargetEncoding) > OutputCapacity)
+        {
+            return false;
+        }
 
-    KString Result = KStringCreateWithEncoding(pUtf8Buffer, Utf8Count, KSTRING_ENCODING_UTF8);
-    KS_Release((void**)&pUtf8Buffer);
+        *pOutputWritten          = KS_EncodeCodePoint(KSTRING_REPLACEMENT_CHARACTER, pTranscoder->TargetEncoding, (uint8_t*)pOutput);
+        pTranscoder->PendingSize = 0;
+    }
 
-    return Result;
+    return true;
 }
 
 //
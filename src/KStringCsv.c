@@ -0,0 +1,325 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+
+#include "KString.h"
+#include "KStringSimd.h"
+#include <stdlib.h>
+#include <string.h>
+
+//
+// KString CSV/TSV Parser
+// simdjson-style structural classification: per 64-byte block, quote/delimiter/newline
+// bitmasks are computed with SIMD compares and quoted regions are masked out via prefix XOR
+//
+
+// Initial capacity of a column array
+#define KSTRING_CSV_INITIAL_ROWS 64
+
+// Column array (one KString per row)
+typedef struct KS_CsvColumn
+{
+    KString* pFields;  // Field values
+    size_t   Capacity; // Allocated entries
+} KS_CsvColumn;
+
+struct KStringCsvTable
+{
+    KS_CsvColumn* pColumns;       // Column arrays
+    size_t        ColumnCount;    // Number of columns in use
+    size_t        ColumnCapacity; // Allocated columns
+    size_t        RowCount;       // Number of completed rows
+    KStringArena* pArena;         // Storage for unescaped fields
+    char          Quote;          // Quote character
+};
+
+//
+// Private Helper Functions
+//
+
+// Make sure Column exists (new columns are backfilled with empty strings for completed rows)
+static bool KS_CsvEnsureColumn(KStringCsvTable* pTable, size_t Column)
+{
+    while (Column >= pTable->ColumnCount)
+    {
+        if (pTable->ColumnCount == pTable->ColumnCapacity)
+        {
+            size_t        NewCapacity = (0 != pTable->ColumnCapacity) ? pTable->ColumnCapacity * 2 : 8;
+            KS_CsvColumn* pColumns    = realloc(pTable->pColumns, NewCapacity * sizeof(KS_CsvColumn));
+            if (NULL == pColumns)
+            {
+                return false;
+            }
+            pTable->pColumns       = pColumns;
+            pTable->ColumnCapacity = NewCapacity;
+        }
+
+        KS_CsvColumn* pColumn = &pTable->pColumns[pTable->ColumnCount];
+        pColumn->Capacity     = (pTable->RowCount + 1 > KSTRING_CSV_INITIAL_ROWS) ? pTable->RowCount + 1 : KSTRING_CSV_INITIAL_ROWS;
+        pColumn->pFields      = malloc(pColumn->Capacity * sizeof(KString));
+        if (NULL == pColumn->pFields)
+        {
+            return false;
+        }
+
+        for (size_t Row = 0; Row < pTable->RowCount; ++Row)
+        {
+            pColumn->pFields[Row] = KStringCreateTransient("", 0);
+        }
+
+        pTable->ColumnCount++;
+    }
+
+    return true;
+}
+
+// Store a field value for the current row
+static bool KS_CsvStoreField(KStringCsvTable* pTable, size_t Column, KString Field)
+{
+    if (false == KS_CsvEnsureColumn(pTable, Column))
+    {
+        return false;
+    }
+
+    KS_CsvColumn* pColumn = &pTable->pColumns[Column];
+    if (pTable->RowCount == pColumn->Capacity)
+    {
+        size_t   NewCapacity = pColumn->Capacity * 2;
+        KString* pFields     = realloc(pColumn->pFields, NewCapacity * sizeof(KString));
+        if (NULL == pFields)
+        {
+            return false;
+        }
+        pColumn->pFields  = pFields;
+        pColumn->Capacity = NewCapacity;
+    }
+
+    pColumn->pFields[pTable->RowCount] = Field;
+    return true;
+}
+
+// Turn raw field bytes into a KString: strip quotes, unescape doubled quotes into the arena
+static bool KS_CsvEmitField(KStringCsvTable* pTable, size_t Column, const char* pField, size_t Size, bool IsLineEnd)
+{
+    // CRLF line endings: carriage return is not part of the last field
+    if (true == IsLineEnd && Size > 0 && '\r' == pField[Size - 1])
+    {
+        Size--;
+    }
+
+    if (Size >= 2 && pTable->Quote == pField[0] && pTable->Quote == pField[Size - 1])
+    {
+        pField += 1;
+        Size   -= 2;
+
+        if (NULL != memchr(pField, pTable->Quote, Size))
+        {
+            // Escaped quotes: materialize unescaped copy (+1 for null terminator)
+            char* pBuffer = KStringArenaAlloc(pTable->pArena, Size + 1);
+            if (NULL == pBuffer)
+            {
+                return false;
+            }
+
+            size_t Written = 0;
+            for (size_t i = 0; i < Size; ++i)
+            {
+                pBuffer[Written++] = pField[i];
+                if (pTable->Quote == pField[i] && i + 1 < Size && pTable->Quote == pField[i + 1])
+                {
+                    i++; // Skip second quote of the pair
+                }
+            }
+            pBuffer[Written] = '\0';
+
+            return KS_CsvStoreField(pTable, Column, KStringCreateTransient(pBuffer, Written));
+        }
+    }
+
+    // Raw fields are views into the input
+    return KS_CsvStoreField(pTable, Column, KStringCreateTransientView(pField, Size));
+}
+
+// Complete the current row (missing trailing fields become empty strings)
+static bool KS_CsvEndRow(KStringCsvTable* pTable, size_t FieldCount)
+{
+    for (size_t Column = FieldCount; Column < pTable->ColumnCount; ++Column)
+    {
+        if (false == KS_CsvStoreField(pTable, Column, KStringCreateTransient("", 0)))
+        {
+            return false;
+        }
+    }
+
+    pTable->RowCount++;
+    return true;
+}
+
+//
+// CSV Operations
+//
+
+KStringCsvTable* KStringCsvParse(const char* pData, const size_t Size, const char Delimiter, const char Quote)
+{
+    if (NULL == pData || Delimiter == Quote || '\n' == Delimiter || '\n' == Quote)
+    {
+        return NULL;
+    }
+
+    KStringCsvTable* pTable = calloc(1, sizeof(KStringCsvTable));
+    if (NULL == pTable)
+    {
+        return NULL;
+    }
+
+    pTable->Quote  = Quote;
+    pTable->pArena = KStringArenaCreate(0);
+    if (NULL == pTable->pArena)
+    {
+        KStringCsvDestroy(pTable);
+        return NULL;
+    }
+
+    const uint8_t* pBytes      = (const uint8_t*)pData;
+    uint64_t       QuoteCarry  = 0; // All ones while a quoted region continues into the next block
+    size_t         FieldStart  = 0;
+    size_t         FieldNumber = 0;
+
+    for (size_t Offset = 0; Offset < Size; Offset += KSTRING_SIMD_BLOCK_SIZE)
+    {
+        const uint8_t* pBlock = pBytes + Offset;
+
+        // Last partial block: classify a zero-padded copy
+        uint8_t Padded[KSTRING_SIMD_BLOCK_SIZE];
+        if (Size - Offset < KSTRING_SIMD_BLOCK_SIZE)
+        {
+            memset(Padded, 0, sizeof(Padded));
+            memcpy(Padded, pBlock, Size - Offset);
+            pBlock = Padded;
+        }
+
+        uint64_t QuoteMask     = KS_SimdMatchMask64(pBlock, (uint8_t)Quote);
+        uint64_t DelimiterMask = KS_SimdMatchMask64(pBlock, (uint8_t)Delimiter);
+        uint64_t NewlineMask   = KS_SimdMatchMask64(pBlock, (uint8_t)'\n');
+
+        // Bytes between an opening and a closing quote (doubled quotes toggle twice)
+        uint64_t InsideQuotes = KS_PrefixXor64(QuoteMask) ^ QuoteCarry;
+        QuoteCarry            = (uint64_t)0 - (InsideQuotes >> 63);
+
+        uint64_t FieldEnds = (DelimiterMask | NewlineMask) & ~InsideQuotes;
+        while (0 != FieldEnds)
+        {
+            unsigned Bit       = KS_CountTrailingZeros64(FieldEnds);
+            size_t   Position  = Offset + Bit;
+            bool     IsLineEnd = 0 != ((NewlineMask >> Bit) & 1);
+
+            if (Position >= Size)
+            {
+                break; // Match inside zero padding (delimiter is NUL)
+            }
+
+            if (false == KS_CsvEmitField(pTable, FieldNumber, pData + FieldStart, Position - FieldStart, IsLineEnd))
+            {
+                KStringCsvDestroy(pTable);
+                return NULL;
+            }
+            FieldNumber++;
+
+            if (true == IsLineEnd)
+            {
+                if (false == KS_CsvEndRow(pTable, FieldNumber))
+                {
+                    KStringCsvDestroy(pTable);
+                    return NULL;
+                }
+                FieldNumber = 0;
+            }
+
+            FieldStart  = Position + 1;
+            FieldEnds  &= FieldEnds - 1;
+        }
+    }
+
+    // Last record without trailing newline
+    if (FieldStart < Size || FieldNumber > 0)
+    {
+        if (false == KS_CsvEmitField(pTable, FieldNumber, pData + FieldStart, Size - FieldStart, true) ||
+            false == KS_CsvEndRow(pTable, FieldNumber + 1))
+        {
+            KStringCsvDestroy(pTable);
+            return NULL;
+        }
+    }
+
+    return pTable;
+}
+
+void KStringCsvDestroy(KStringCsvTable* pTable)
+{
+    if (NULL == pTable)
+    {
+        return;
+    }
+
+    for (size_t Column = 0; Column < pTable->ColumnCount; ++Column)
+    {
+        free(pTable->pColumns[Column].pFields);
+    }
+
+    free(pTable->pColumns);
+    KStringArenaDestroy(pTable->pArena);
+    free(pTable);
+}
+
+size_t KStringCsvRowCount(const KStringCsvTable* pTable)
+{
+    return (NULL != pTable) ? pTable->RowCount : 0;
+}
+
+size_t KStringCsvColumnCount(const KStringCsvTable* pTable)
+{
+    return (NULL != pTable) ? pTable->ColumnCount : 0;
+}
+
+const KString* KStringCsvColumn(const KStringCsvTable* pTable, const size_t Column)
+{
+    if (NULL == pTable || Column >= pTable->ColumnCount)
+    {
+        return NULL;
+    }
+
+    return pTable->pColumns[Column].pFields;
+}
+
+KString KStringCsvGet(const KStringCsvTable* pTable, const size_t Row, const size_t Column)
+{
+    if (NULL == pTable || Row >= pTable->RowCount || Column >= pTable->ColumnCount)
+    {
+        return KStringInvalid();
+    }
+
+    return pTable->pColumns[Column].pFields[Row];
+}
@@ -0,0 +1,259 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+
+#include "KString.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #define KSTRING_HAS_MMAP 1
+#endif
+
+//
+// KString File Reader - zero-copy line/record iteration over a mapped file
+// Records are TRANSIENT views into the mapping (valid until the reader is closed)
+//
+
+struct KStringFileReader
+{
+    const char* pData;    // Start of the file contents
+    size_t      Size;     // File size in bytes
+    size_t      Position; // Offset of the next record
+    bool        IsMapped; // Contents are mmap'd (otherwise heap buffer)
+};
+
+//
+// Private Helper Functions
+//
+
+// Load file contents: mmap where available, read into a heap buffer otherwise
+static bool KS_LoadFile(const char* pPath, KStringFileReader* pReader)
+{
+#if defined(KSTRING_HAS_MMAP)
+    int Fd = open(pPath, O_RDONLY);
+    if (Fd < 0)
+    {
+        return false;
+    }
+
+    struct stat Info;
+    if (0 != fstat(Fd, &Info))
+    {
+        close(Fd);
+        return false;
+    }
+
+    pReader->Size = (size_t)Info.st_size;
+    if (0 == pReader->Size)
+    {
+        // Empty files cannot be mapped
+        close(Fd);
+        pReader->pData = "";
+        return true;
+    }
+
+    void* pMapping = mmap(NULL, pReader->Size, PROT_READ, MAP_PRIVATE, Fd, 0);
+    close(Fd); // Mapping keeps the file referenced
+    if (MAP_FAILED == pMapping)
+    {
+        return false;
+    }
+
+    #if defined(MADV_SEQUENTIAL)
+    // Aggressive read-ahead, drop pages behind the cursor early
+    madvise(pMapping, pReader->Size, MADV_SEQUENTIAL);
+    #endif
+
+    pReader->pData    = pMapping;
+    pReader->IsMapped = true;
+    return true;
+#else
+    FILE* pFile = fopen(pPath, "rb");
+    if (NULL == pFile)
+    {
+        return false;
+    }
+
+    if (0 != fseek(pFile, 0, SEEK_END))
+    {
+        fclose(pFile);
+        return false;
+    }
+
+    long FileSize = ftell(pFile);
+    if (FileSize < 0 || 0 != fseek(pFile, 0, SEEK_SET))
+    {
+        fclose(pFile);
+        return false;
+    }
+
+    char* pBuffer = malloc((size_t)FileSize + 1);
+    if (NULL == pBuffer || fread(pBuffer, 1, (size_t)FileSize, pFile) != (size_t)FileSize)
+    {
+        free(pBuffer);
+        fclose(pFile);
+        return false;
+    }
+
+    fclose(pFile);
+    pBuffer[FileSize] = '\0';
+    pReader->pData    = pBuffer;
+    pReader->Size     = (size_t)FileSize;
+    return true;
+#endif
+}
+
+//
+// File Reader Operations
+//
+
+KStringFileReader* KStringFileReaderOpen(const char* pPath)
+{
+    if (NULL == pPath)
+    {
+        return NULL;
+    }
+
+    KStringFileReader* pReader = calloc(1, sizeof(KStringFileReader));
+    if (NULL == pReader)
+    {
+        return NULL;
+    }
+
+    if (false == KS_LoadFile(pPath, pReader))
+    {
+        free(pReader);
+        return NULL;
+    }
+
+    return pReader;
+}
+
+void KStringFileReaderClose(KStringFileReader* pReader)
+{
+    if (NULL == pReader)
+    {
+        return;
+    }
+
+#if defined(KSTRING_HAS_MMAP)
+    if (true == pReader->IsMapped)
+    {
+        munmap((void*)pReader->pData, pReader->Size);
+    }
+#else
+    free((void*)pReader->pData);
+#endif
+
+    free(pReader);
+}
+
+bool KStringFileReaderNextRecord(KStringFileReader* pReader, const char Delimiter, KString* pRecord)
+{
+    if (NULL == pReader || NULL == pRecord || pReader->Position >= pReader->Size)
+    {
+        return false;
+    }
+
+    // memchr is the vectorized byte search of the C library (SSE2/AVX2/NEON)
+    const char* pStart     = pReader->pData + pReader->Position;
+    size_t      Remaining  = pReader->Size - pReader->Position;
+    const char* pDelimiter = memchr(pStart, Delimiter, Remaining);
+    size_t      RecordSize = (NULL != pDelimiter) ? (size_t)(pDelimiter - pStart) : Remaining;
+
+    // Records beyond the regular size limit cannot be viewed (large strings need a header in front)
+    KString Record = KStringCreateTransientView(pStart, RecordSize);
+    if (false == KStringIsValid(Record))
+    {
+        return false;
+    }
+
+    pReader->Position += (NULL != pDelimiter) ? RecordSize + 1 : RecordSize;
+
+    *pRecord = Record;
+    return true;
+}
+
+bool KStringFileReaderNextLine(KStringFileReader* pReader, KString* pLine)
+{
+    if (NULL == pReader || NULL == pLine || pReader->Position >= pReader->Size)
+    {
+        return false;
+    }
+
+    const char* pStart    = pReader->pData + pReader->Position;
+    size_t      Remaining = pReader->Size - pReader->Position;
+    const char* pNewline  = memchr(pStart, '\n', Remaining);
+    size_t      LineSize  = (NULL != pNewline) ? (size_t)(pNewline - pStart) : Remaining;
+    size_t      Advance   = (NULL != pNewline) ? LineSize + 1 : LineSize;
+
+    // Strip carriage return of CRLF line endings
+    if (LineSize > 0 && '\r' == pStart[LineSize - 1])
+    {
+        LineSize--;
+    }
+
+    // Lines beyond the regular size limit cannot be viewed (large strings need a header in front)
+    KString Line = KStringCreateTransientView(pStart, LineSize);
+    if (false == KStringIsValid(Line))
+    {
+        return false;
+    }
+
+    pReader->Position += Advance;
+
+    *pLine = Line;
+    return true;
+}
+
+bool KStringFileReaderIsEof(const KStringFileReader* pReader)
+{
+    return NULL == pReader || pReader->Position >= pReader->Size;
+}
+
+void KStringFileReaderRewind(KStringFileReader* pReader)
+{
+    if (NULL != pReader)
+    {
+        pReader->Position = 0;
+    }
+}
+
+size_t KStringFileReaderSize(const KStringFileReader* pReader)
+{
+    return (NULL != pReader) ? pReader->Size : 0;
+}
+
+size_t KStringFileReaderPosition(const KStringFileReader* pReader)
+{
+    return (NULL != pReader) ? pReader->Position : 0;
+}
@@ -0,0 +1,476 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE // memfd_create
+#endif
+
+#include "KString.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #define KSTRING_HAS_SHARED_MEMORY 1
+#endif
+
+//
+// KString Shared Table - cross-process zero-copy string dictionary
+// Layout: KStringSharedTableHeader | KString Entries[Count] | char Heap[HeapSize]
+// Long entries are RELOCATABLE strings, so every process resolves them against its own mapping
+//
+
+// Entry array alignment inside the region
+#define KSTRING_SHARED_TABLE_ALIGNMENT 16
+
+struct KStringSharedTable
+{
+    const KStringSharedTableHeader* pHeader; // Start of the mapping (region base)
+    size_t                          Size;    // Mapping size in bytes
+    int                             Fd;      // Backing shared memory descriptor
+};
+
+#if defined(KSTRING_HAS_SHARED_MEMORY)
+
+//
+// Private Helper Functions
+//
+
+// Validate header fields against the mapping size (never trust another process)
+static bool KS_ValidateHeader(const KStringSharedTableHeader* pHeader, size_t MappingSize)
+{
+    if (KSTRING_SHARED_TABLE_MAGIC != pHeader->Magic || KSTRING_SHARED_TABLE_VERSION != pHeader->Version)
+    {
+        return false;
+    }
+
+    // Every offset is checked against TotalSize before it is subtracted from it, so nothing can wrap around
+    if (pHeader->TotalSize > MappingSize || pHeader->EntriesOffset < sizeof(KStringSharedTableHeader) ||
+        pHeader->EntriesOffset > pHeader->TotalSize || 0 != (pHeader->EntriesOffset % KSTRING_SHARED_TABLE_ALIGNMENT))
+    {
+        return false;
+    }
+
+    // Count fits into the space after the entry offset, so the entry array end stays within TotalSize
+    if (pHeader->Count > (pHeader->TotalSize - pHeader->EntriesOffset) / sizeof(KString))
+    {
+        return false;
+    }
+
+    uint64_t EntriesEnd = pHeader->EntriesOffset + pHeader->Count * sizeof(KString);
+    return pHeader->HeapOffset >= EntriesEnd && pHeader->HeapOffset <= pHeader->TotalSize &&
+           pHeader->HeapSize <= pHeader->TotalSize - pHeader->HeapOffset;
+}
+
+// Validate every entry: short, or long RELOCATABLE into the table's own heap
+// Other storage classes would hand out foreign pointers (that KStringDestroy might free), foreign regions resolve elsewhere
+// Long entries must match the entry KStringSharedTableCreate would emit bit for bit, so no flag (validated UTF-8, view) is trusted
+// Needs the table's region registered, the canonical entry is built against it
+static bool KS_ValidateEntries(const KStringSharedTableHeader* pHeader)
+{
+    const KString* pEntries = (const KString*)((const char*)pHeader + pHeader->EntriesOffset);
+    for (uint64_t i = 0; i < pHeader->Count; ++i)
+    {
+        KString Entry = pEntries[i];
+        if (false == KStringIsValid(Entry))
+        {
+            return false;
+        }
+
+        if (true == KStringIsShort(Entry))
+        {
+            continue;
+        }
+
+        // Large entries would read their size from a header in front of the payload
+        uint8_t RegionId;
+        size_t  Offset;
+        if (true == KStringIsLarge(Entry) || false == KStringGetRelocation(Entry, &RegionId, &Offset) || RegionId != pHeader->RegionId)
+        {
+            return false;
+        }
+
+        size_t Size = KStringSize(Entry);
+        if (Offset < pHeader->HeapOffset || Offset - pHeader->HeapOffset > pHeader->HeapSize ||
+            Size > pHeader->HeapSize - (Offset - pHeader->HeapOffset))
+        {
+            return false;
+        }
+
+        KString Canonical = KStringCreateRelocatableWithEncoding(pHeader->RegionId, Offset, Size, KStringGetEncoding(Entry));
+        if (true == KStringIsShort(Canonical) || Canonical.LongStr.PtrAndClass != Entry.LongStr.PtrAndClass)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Map a shared memory descriptor read-only and register its region
+static KStringSharedTable* KS_AttachDescriptor(int Fd)
+{
+    struct stat Info;
+    if (0 != fstat(Fd, &Info) || (size_t)Info.st_size < sizeof(KStringSharedTableHeader))
+    {
+        return NULL;
+    }
+
+    size_t MappingSize = (size_t)Info.st_size;
+    void*  pMapping    = mmap(NULL, MappingSize, PROT_READ, MAP_SHARED, Fd, 0);
+    if (MAP_FAILED == pMapping)
+    {
+        return NULL;
+    }
+
+    const KStringSharedTableHeader* pHeader = (const KStringSharedTableHeader*)pMapping;
+    KStringSharedTable*             pTable  = malloc(sizeof(KStringSharedTable));
+    if (NULL == pTable || false == KS_ValidateHeader(pHeader, MappingSize) ||
+        false == KStringRegisterRegion(pHeader->RegionId, pMapping, (size_t)pHeader->TotalSize))
+    {
+        free(pTable);
+        munmap(pMapping, MappingSize);
+        return NULL;
+    }
+
+    if (false == KS_ValidateEntries(pHeader))
+    {
+        KStringUnregisterRegion(pHeader->RegionId);
+        free(pTable);
+        munmap(pMapping, MappingSize);
+        return NULL;
+    }
+
+    pTable->pHeader = pHeader;
+    pTable->Size    = MappingSize;
+    pTable->Fd      = Fd;
+    return pTable;
+}
+
+// Create an anonymous or named shared memory descriptor
+static int KS_CreateDescriptor(const char* pName)
+{
+    if (NULL != pName)
+    {
+        return shm_open(pName, O_CREAT | O_EXCL | O_RDWR, 0644);
+    }
+
+    #if defined(__linux__)
+    return memfd_create("kstring-shared-table", MFD_CLOEXEC);
+    #else
+    // No memfd: create a uniquely named object and unlink it right away
+    char Name[64];
+    for (int Attempt = 0; Attempt < 16; ++Attempt)
+    {
+        snprintf(Name, sizeof(Name), "/kstring-%ld-%d", (long)getpid(), rand());
+        int Fd = shm_open(Name, O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (Fd >= 0)
+        {
+            shm_unlink(Name);
+            return Fd;
+        }
+    }
+    return -1;
+    #endif
+}
+
+// Close a descriptor of a table that could not be built, named objects are removed so the name can be reused
+static void KS_DiscardDescriptor(int Fd, const char* pName)
+{
+    close(Fd);
+    if (NULL != pName)
+    {
+        shm_unlink(pName);
+    }
+}
+
+//
+// Shared Table Operations
+//
+
+KStringSharedTable* KStringSharedTableCreate(const char* pName, const uint8_t RegionId, const KString* pStrings, const size_t Count)
+{
+    if (NULL == pStrings && 0 != Count)
+    {
+        return NULL;
+    }
+
+    // Compute layout: long payloads go to the heap (+1 for null terminator)
+    // Large strings have no relocatable form (their size lives in a header in front of the payload)
+    size_t HeapSize = 0;
+    for (size_t i = 0; i < Count; ++i)
+    {
+        if (false == KStringIsValid(pStrings[i]) || true == KStringIsLarge(pStrings[i]))
+        {
+            return NULL;
+        }
+        if (false == KStringIsShort(pStrings[i]))
+        {
+            size_t Size = KStringSize(pStrings[i]);
+            if (Size >= SIZE_MAX - HeapSize)
+            {
+                return NULL;
+            }
+            HeapSize += Size + 1;
+        }
+    }
+
+    size_t EntriesOffset = sizeof(KStringSharedTableHeader);
+    if (Count > (SIZE_MAX - EntriesOffset - HeapSize) / sizeof(KString))
+    {
+        return NULL; // Overflow would occur
+    }
+
+    size_t HeapOffset = EntriesOffset + Count * sizeof(KString);
+    size_t TotalSize  = HeapOffset + HeapSize;
+
+    int Fd = KS_CreateDescriptor(pName);
+    if (Fd < 0)
+    {
+        return NULL;
+    }
+
+    if (0 != ftruncate(Fd, (off_t)TotalSize))
+    {
+        KS_DiscardDescriptor(Fd, pName);
+        return NULL;
+    }
+
+    char* pMapping = mmap(NULL, TotalSize, PROT_READ | PROT_WRITE, MAP_SHARED, Fd, 0);
+    if (MAP_FAILED == pMapping)
+    {
+        KS_DiscardDescriptor(Fd, pName);
+        return NULL;
+    }
+
+    KStringSharedTableHeader* pHeader = (KStringSharedTableHeader*)pMapping;
+    memset(pHeader, 0, sizeof(KStringSharedTableHeader));
+    pHeader->Magic         = KSTRING_SHARED_TABLE_MAGIC;
+    pHeader->Version       = KSTRING_SHARED_TABLE_VERSION;
+    pHeader->Count         = Count;
+    pHeader->EntriesOffset = EntriesOffset;
+    pHeader->HeapOffset    = HeapOffset;
+    pHeader->HeapSize      = HeapSize;
+    pHeader->TotalSize     = TotalSize;
+    pHeader->RegionId      = RegionId;
+
+    // The region id must be free: another table or region under it would be shadowed and unregistered by our Close
+    if (false == KStringRegisterRegion(RegionId, pMapping, TotalSize))
+    {
+        munmap(pMapping, TotalSize);
+        KS_DiscardDescriptor(Fd, pName);
+        return NULL;
+    }
+
+    // Copy payloads into the heap and emit relocatable entries
+    // KStringCopyTo walks ropes without flattening and stops short on payloads that cannot be resolved
+    KString* pEntries   = (KString*)(pMapping + EntriesOffset);
+    size_t   HeapCursor = HeapOffset;
+    bool     Complete   = true;
+    for (size_t i = 0; i < Count && true == Complete; ++i)
+    {
+        if (true == KStringIsShort(pStrings[i]))
+        {
+            pEntries[i] = pStrings[i];
+            continue;
+        }
+
+        size_t Size = KStringSize(pStrings[i]);
+        if (Size != KStringCopyTo(pStrings[i], 0, pMapping + HeapCursor, Size))
+        {
+            Complete = false;
+            break;
+        }
+        pMapping[HeapCursor + Size] = '\0';
+
+        pEntries[i]  = KStringCreateRelocatableWithEncoding(RegionId, HeapCursor, Size, KStringGetEncoding(pStrings[i]));
+        Complete     = KStringIsValid(pEntries[i]);
+        HeapCursor  += Size + 1;
+    }
+
+    // The table is immutable once built
+    KStringSharedTable* pTable = (true == Complete) ? malloc(sizeof(KStringSharedTable)) : NULL;
+    if (NULL == pTable || 0 != mprotect(pMapping, TotalSize, PROT_READ))
+    {
+        free(pTable);
+        KStringUnregisterRegion(RegionId);
+        munmap(pMapping, TotalSize);
+        KS_DiscardDescriptor(Fd, pName);
+        return NULL;
+    }
+
+    pTable->pHeader = pHeader;
+    pTable->Size    = TotalSize;
+    pTable->Fd      = Fd;
+    return pTable;
+}
+
+KStringSharedTable* KStringSharedTableAttach(const char* pName)
+{
+    if (NULL == pName)
+    {
+        return NULL;
+    }
+
+    int Fd = shm_open(pName, O_RDONLY, 0);
+    if (Fd < 0)
+    {
+        return NULL;
+    }
+
+    KStringSharedTable* pTable = KS_AttachDescriptor(Fd);
+    if (NULL == pTable)
+    {
+        close(Fd);
+    }
+
+    return pTable;
+}
+
+KStringSharedTable* KStringSharedTableAttachFd(const int Fd)
+{
+    if (Fd < 0)
+    {
+        return NULL;
+    }
+
+    // Keep our own descriptor so the caller may close theirs
+    int OwnFd = dup(Fd);
+    if (OwnFd < 0)
+    {
+        return NULL;
+    }
+
+    KStringSharedTable* pTable = KS_AttachDescriptor(OwnFd);
+    if (NULL == pTable)
+    {
+        close(OwnFd);
+    }
+
+    return pTable;
+}
+
+void KStringSharedTableClose(KStringSharedTable* pTable)
+{
+    if (NULL == pTable)
+    {
+        return;
+    }
+
+    // Only unregister the region if it still refers to this mapping
+    if (KStringGetRegionBase(pTable->pHeader->RegionId) == (const void*)pTable->pHeader)
+    {
+        KStringUnregisterRegion(pTable->pHeader->RegionId);
+    }
+
+    munmap((void*)pTable->pHeader, pTable->Size);
+    close(pTable->Fd);
+    free(pTable);
+}
+
+bool KStringSharedTableUnlink(const char* pName)
+{
+    return NULL != pName && 0 == shm_unlink(pName);
+}
+
+#else
+
+//
+// Shared Table Operations (no POSIX shared memory on this platform)
+//
+
+KStringSharedTable* KStringSharedTableCreate(const char* pName, const uint8_t RegionId, const KString* pStrings, const size_t Count)
+{
+    (void)pName;
+    (void)RegionId;
+    (void)pStrings;
+    (void)Count;
+    return NULL;
+}
+
+KStringSharedTable* KStringSharedTableAttach(const char* pName)
+{
+    (void)pName;
+    return NULL;
+}
+
+KStringSharedTable* KStringSharedTableAttachFd(const int Fd)
+{
+    (void)Fd;
+    return NULL;
+}
+
+void KStringSharedTableClose(KStringSharedTable* pTable)
+{
+    (void)pTable;
+}
+
+bool KStringSharedTableUnlink(const char* pName)
+{
+    (void)pName;
+    return false;
+}
+
+#endif // KSTRING_HAS_SHARED_MEMORY
+
+//
+// Access Operations
+//
+
+size_t KStringSharedTableCount(const KStringSharedTable* pTable)
+{
+    return (NULL != pTable) ? (size_t)pTable->pHeader->Count : 0;
+}
+
+KString KStringSharedTableGet(const KStringSharedTable* pTable, const size_t Index)
+{
+    if (NULL == pTable || Index >= pTable->pHeader->Count)
+    {
+        return KStringInvalid();
+    }
+
+    return KStringSharedTableEntries(pTable)[Index];
+}
+
+const KString* KStringSharedTableEntries(const KStringSharedTable* pTable)
+{
+    if (NULL == pTable)
+    {
+        return NULL;
+    }
+
+    return (const KString*)((const char*)pTable->pHeader + pTable->pHeader->EntriesOffset);
+}
+
+int KStringSharedTableGetFd(const KStringSharedTable* pTable)
+{
+    return (NULL != pTable) ? pTable->Fd : -1;
+}
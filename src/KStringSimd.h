@@ -0,0 +1,816 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef KSTRING_SIMD_H
+#define KSTRING_SIMD_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+//
+// KString SIMD Kernels (private)
+// SSE2 is part of the x86-64 baseline, so no runtime dispatch is needed
+// Other targets use portable scalar fallbacks with identical results
+//
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define KSTRING_HAS_SSE2 1
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+//
+// Bit Manipulation Helpers
+//
+
+// Index of lowest set bit (Bits must not be zero)
+inline static unsigned KS_CountTrailingZeros64(uint64_t Bits)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long Index;
+    _BitScanForward64(&Index, Bits);
+    return (unsigned)Index;
+#else
+    return (unsigned)__builtin_ctzll(Bits);
+#endif
+}
+
+// Prefix XOR: bit i is the XOR of bits 0..i (marks regions between pairs of set bits)
+// Shift cascade instead of carry-less multiplication to stay within the SSE2 baseline
+inline static uint64_t KS_PrefixXor64(uint64_t Bits)
+{
+    Bits ^= Bits << 1;
+    Bits ^= Bits << 2;
+    Bits ^= Bits << 4;
+    Bits ^= Bits << 8;
+    Bits ^= Bits << 16;
+    Bits ^= Bits << 32;
+    return Bits;
+}
+
+// Number of set bits
+inline static unsigned KS_PopCount32(uint32_t Bits)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return (unsigned)__popcnt(Bits);
+#else
+    return (unsigned)__builtin_popcount(Bits);
+#endif
+}
+
+//
+// Block Classification
+//
+
+// Size of a classification block in bytes (one bit per byte in a 64-bit mask)
+#define KSTRING_SIMD_BLOCK_SIZE 64
+
+// Bitmask of the bytes in a 64-byte block that equal Value
+inline static uint64_t KS_SimdMatchMask64(const uint8_t* pBlock, uint8_t Value)
+{
+#if defined(KSTRING_HAS_SSE2)
+    const __m128i Needle = _mm_set1_epi8((char)Value);
+    uint64_t      Mask0  = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(pBlock + 0)), Needle));
+    uint64_t      Mask1  = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(pBlock + 16)), Needle));
+    uint64_t      Mask2  = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(pBlock + 32)), Needle));
+    uint64_t      Mask3  = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(pBlock + 48)), Needle));
+    return Mask0 | (Mask1 << 16) | (Mask2 << 32) | (Mask3 << 48);
+#else
+    uint64_t Mask = 0;
+    for (size_t i = 0; i < KSTRING_SIMD_BLOCK_SIZE; ++i)
+    {
+        Mask |= (uint64_t)(pBlock[i] == Value) << i;
+    }
+    return Mask;
+#endif
+}
+
+//
+// ASCII Scanning
+//
+
+// Number of leading ASCII bytes (< 0x80) in pData
+inline static size_t KS_SimdAsciiPrefix(const uint8_t* pData, size_t Size)
+{
+    size_t i = 0;
+
+#if defined(KSTRING_HAS_SSE2)
+    // 64 bytes per iteration: the sign bits of all four vectors are OR'ed into one movemask
+    while (i + KSTRING_SIMD_BLOCK_SIZE <= Size)
+    {
+        __m128i Block = _mm_or_si128(_mm_or_si128(_mm_loadu_si128((const __m128i*)(pData + i + 0)), _mm_loadu_si128((const __m128i*)(pData + i + 16))),
+                                     _mm_or_si128(_mm_loadu_si128((const __m128i*)(pData + i + 32)), _mm_loadu_si128((const __m128i*)(pData + i + 48))));
+        if (0 != _mm_movemask_epi8(Block))
+        {
+            break;
+        }
+        i += KSTRING_SIMD_BLOCK_SIZE;
+    }
+
+    while (i + 16 <= Size)
+    {
+        unsigned Mask = (unsigned)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(pData + i)));
+        if (0 != Mask)
+        {
+            return i + KS_CountTrailingZeros64(Mask);
+        }
+        i += 16;
+    }
+#else
+    // 8 bytes per iteration (SWAR), exact position is found by the scalar loop below
+    while (i + 8 <= Size)
+    {
+        uint64_t Word;
+        memcpy(&Word, pData + i, sizeof(Word));
+        if (0 != (Word & 0x8080'8080'8080'8080ULL))
+        {
+            break;
+        }
+        i += 8;
+    }
+#endif
+
+    while (i < Size && pData[i] < 0x80)
+    {
+        ++i;
+    }
+
+    return i;
+}
+
+//
+// Transcoding Kernels
+// Kernels process whole blocks only and return the number of input elements consumed,
+// callers finish the remainder (and stop-blocks) with scalar code
+//
+
+// Number of code points in valid UTF-8 input (bytes that are not continuation bytes)
+inline static size_t KS_SimdUtf8CodePointCount(const uint8_t* pData, size_t Size)
+{
+    size_t Count = 0;
+    size_t i     = 0;
+
+#if defined(KSTRING_HAS_SSE2)
+    // Signed compare: continuation bytes 0x80-0xBF are below -64
+    const __m128i ContinuationBound = _mm_set1_epi8((char)0xC0);
+    for (; i + 16 <= Size; i += 16)
+    {
+        __m128i Block  = _mm_loadu_si128((const __m128i*)(pData + i));
+        Count         += 16 - KS_PopCount32((unsigned)_mm_movemask_epi8(_mm_cmplt_epi8(Block, ContinuationBound)));
+    }
+#endif
+
+    for (; i < Size; ++i)
+    {
+        Count += (size_t)(0x80 != (pData[i] & 0xC0));
+    }
+
+    return Count;
+}
+
+// Number of UTF-16 code units needed for valid UTF-8 input:
+// one per byte that is not a continuation byte, plus one per 4-byte lead (surrogate pair)
+inline static size_t KS_SimdUtf8ToUtf16Count(const uint8_t* pData, size_t Size)
+{
+    size_t Count = 0;
+    size_t i     = 0;
+
+#if defined(KSTRING_HAS_SSE2)
+    // Signed compares: continuation bytes 0x80-0xBF are below -64, 4-byte leads 0xF0-0xF4 are in -16..-12
+    const __m128i ContinuationBound = _mm_set1_epi8((char)0xC0);
+    const __m128i FourByteBound     = _mm_set1_epi8((char)0xEF);
+    const __m128i Zero              = _mm_setzero_si128();
+    for (; i + 16 <= Size; i += 16)
+    {
+        __m128i  Block        = _mm_loadu_si128((const __m128i*)(pData + i));
+        unsigned Continuation = (unsigned)_mm_movemask_epi8(_mm_cmplt_epi8(Block, ContinuationBound));
+        unsigned FourByte     = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpgt_epi8(Block, FourByteBound), _mm_cmplt_epi8(Block, Zero)));
+        Count                += 16 - KS_PopCount32(Continuation) + KS_PopCount32(FourByte);
+    }
+#endif
+
+    for (; i < Size; ++i)
+    {
+        Count += (size_t)(0x80 != (pData[i] & 0xC0)) + (size_t)(pData[i] >= 0xF0);
+    }
+
+    return Count;
+}
+
+#if defined(KSTRING_HAS_SSE2)
+// Swap the bytes of each 16-bit lane (UTF-16 byte order conversion)
+inline static __m128i KS_SimdSwapBytes16(__m128i Block)
+{
+    return _mm_or_si128(_mm_slli_epi16(Block, 8), _mm_srli_epi16(Block, 8));
+}
+#endif
+
+// Swap the bytes of each 16-bit unit in Size bytes (pInput may equal pOutput), returns bytes processed
+// SSE2 has no byte shuffle, so the swap is a shift pair per 16-bit lane
+inline static size_t KS_SimdSwapBytes16Blocks(const uint8_t* pInput, size_t Size, uint8_t* pOutput)
+{
+    size_t i = 0;
+
+#if defined(KSTRING_HAS_SSE2)
+    for (; i + 64 <= Size; i += 64)
+    {
+        __m128i Block0 = _mm_loadu_si128((const __m128i*)(pInput + i + 0));
+        __m128i Block1 = _mm_loadu_si128((const __m128i*)(pInput + i + 16));
+        __m128i Block2 = _mm_loadu_si128((const __m128i*)(pInput + i + 32));
+        __m128i Block3 = _mm_loadu_si128((const __m128i*)(pInput + i + 48));
+        _mm_storeu_si128((__m128i*)(pOutput + i + 0), KS_SimdSwapBytes16(Block0));
+        _mm_storeu_si128((__m128i*)(pOutput + i + 16), KS_SimdSwapBytes16(Block1));
+        _mm_storeu_si128((__m128i*)(pOutput + i + 32), KS_SimdSwapBytes16(Block2));
+        _mm_storeu_si128((__m128i*)(pOutput + i + 48), KS_SimdSwapBytes16(Block3));
+    }
+
+    for (; i + 16 <= Size; i += 16)
+    {
+        _mm_storeu_si128((__m128i*)(pOutput + i), KS_SimdSwapBytes16(_mm_loadu_si128((const __m128i*)(pInput + i))));
+    }
+#else
+    // SWAR: swapping adjacent bytes of a word is independent of the host byte order
+    for (; i + 8 <= Size; i += 8)
+    {
+        uint64_t Word;
+        memcpy(&Word, pInput + i, sizeof(Word));
+        Word = ((Word & 0x00FF'00FF'00FF'00FFULL) << 8) | ((Word >> 8) & 0x00FF'00FF'00FF'00FFULL);
+        memcpy(pOutput + i, &Word, sizeof(Word));
+    }
+#endif
+
+    return i;
+}
+
+// Widen leading 16-byte blocks of ASCII into UTF-16 (stops at the first block with a non-ASCII byte)
+inline static size_t KS_SimdWidenAsciiToUtf16(const uint8_t* pInput, size_t Size, uint8_t* pOutput, bool BigEndian)
+{
+    size_t i = 0;
+
+#if defined(KSTRING_HAS_SSE2)
+    const __m128i Zero = _mm_setzero_si128();
+    for (; i + 16 <= Size; i += 16)
+    {
+        __m128i Block = _mm_loadu_si128((const __m128i*)(pInput + i));
+        if (0 != _mm_movemask_epi8(Block))
+        {
+            break;
+        }
+
+        // Interleaving with zero bytes: zero after the character (LE) or before it (BE)
+        __m128i Low  = (true == BigEndian) ? _mm_unpacklo_epi8(Zero, Block) : _mm_unpacklo_epi8(Block, Zero);
+        __m128i High = (true == BigEndian) ? _mm_unpackhi_epi8(Zero, Block) : _mm_unpackhi_epi8(Block, Zero);
+        _mm_storeu_si128((__m128i*)(pOutput + 2 * i), Low);
+        _mm_storeu_si128((__m128i*)(pOutput + 2 * i + 16), High);
+    }
+#else
+    (void)pInput;
+    (void)Size;
+    (void)pOutput;
+    (void)BigEndian;
+#endif
+
+    return i;
+}
+
+// Narrow leading 8-unit blocks of ASCII UTF-16 into bytes (stops at the first block with a unit above 0x7F)
+inline static size_t KS_SimdNarrowUtf16ToAscii(const uint8_t* pInput, size_t Count, uint8_t* pOutput, bool BigEndian)
+{
+    size_t i = 0;
+
+#if defined(KSTRING_HAS_SSE2)
+    const __m128i AsciiMax = _mm_set1_epi16(0x7F);
+    const __m128i Zero     = _mm_setzero_si128();
+    for (; i + 8 <= Count; i += 8)
+    {
+        __m128i Block = _mm_loadu_si128((const __m128i*)(pInput + 2 * i));
+        if (true == BigEndian)
+        {
+            Block = KS_SimdSwapBytes16(Block);
+        }
+
+        // Saturating subtraction leaves zero exactly for units <= 0x7F
+        if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_subs_epu16(Block, AsciiMax), Zero)))
+        {
+            break;
+        }
+
+        _mm_storel_epi64((__m128i*)(pOutput + i), _mm_packus_epi16(Block, Block));
+    }
+#else
+    (void)pInput;
+    (void)Count;
+    (void)pOutput;
+    (void)BigEndian;
+#endif
+
+    return i;
+}
+
+// UTF-8 length of leading 8-unit blocks of UTF-16 without surrogates (stops at the first block with one)
+// Each unit needs 3 bytes, minus one if <= 0x7FF, minus one more if <= 0x7F
+inline static size_t KS_SimdUtf16ToUtf8Length(const uint8_t* pInput, size_t Count, bool BigEndian, size_t* pLength)
+{
+    size_t i      = 0;
+    size_t Length = 0;
+
+#if defined(KSTRING_HAS_SSE2)
+    const __m128i AsciiMax      = _mm_set1_epi16(0x7F);
+    const __m128i TwoByteMax    = _mm_set1_epi16(0x7FF);
+    const __m128i SurrogateMask = _mm_set1_epi16((short)0xF800);
+    const __m128i Surrogate     = _mm_set1_epi16((short)0xD800);
+    const __m128i Zero          = _mm_setzero_si128();
+    for (; i + 8 <= Count; i += 8)
+    {
+        __m128i Block = _mm_loadu_si128((const __m128i*)(pInput + 2 * i));
+        if (true == BigEndian)
+        {
+            Block = KS_SimdSwapBytes16(Block);
+        }
+
+        if (0 != _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(Block, SurrogateMask), Surrogate)))
+        {
+            break;
+        }
+
+        // Masks have two bits per 16-bit lane
+        unsigned OneByte  = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_subs_epu16(Block, AsciiMax), Zero));
+        unsigned TwoBytes = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_subs_epu16(Block, TwoByteMax), Zero));
+        Length           += 24 - (KS_PopCount32(OneByte) + KS_PopCount32(TwoBytes)) / 2;
+    }
+#else
+    (void)pInput;
+    (void)Count;
+    (void)BigEndian;
+#endif
+
+    *pLength = Length;
+    return i;
+}
+
+// Number of leading UTF-16 units that are not surrogates (each is one code point)
+inline static size_t KS_SimdUtf16NonSurrogatePrefix(const uint8_t* pInput, size_t Count, bool BigEndian)
+{
+    size_t i = 0;
+
+#if defined(KSTRING_HAS_SSE2)
+    // Units stay in memory order, so big-endian input uses byte-swapped constants
+    const __m128i SurrogateMask = _mm_set1_epi16((true == BigEndian) ? (short)0x00F8 : (short)0xF800);
+    const __m128i Surrogate     = _mm_set1_epi16((true == BigEndian) ? (short)0x00D8 : (short)0xD800);
+    for (; i + 8 <= Count; i += 8)
+    {
+        __m128i  Block = _mm_loadu_si128((const __m128i*)(pInput + 2 * i));
+        unsigned Mask  = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(Block, SurrogateMask), Surrogate));
+        if (0 != Mask)
+        {
+            return i + KS_CountTrailingZeros64(Mask) / 2;
+        }
+    }
+#else
+    (void)pInput;
+    (void)Count;
+    (void)BigEndian;
+#endif
+
+    return i;
+}
+
+//
+// Cross-Encoding Comparison
+//
+
+// Number of leading bytes that are equal and ASCII in both inputs
+inline static size_t KS_SimdAsciiEqualPrefix(const uint8_t* pA, const uint8_t* pB, size_t Size)
+{
+    size_t i = 0;
+
+#if defined(KSTRING_HAS_SSE2)
+    for (; i + 16 <= Size; i += 16)
+    {
+        __m128i  BlockA = _mm_loadu_si128((const __m128i*)(pA + i));
+        __m128i  BlockB = _mm_loadu_si128((const __m128i*)(pB + i));
+        unsigned Mask   = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(BlockA, BlockB)) & ~(unsigned)_mm_movemask_epi8(BlockA);
+        if (0xFFFF != Mask)
+        {
+            return i + KS_CountTrailingZeros64(~Mask & 0xFFFF);
+        }
+    }
+#else
+    // SWAR: whole equal ASCII words only, the caller continues with scalar decoding
+    for (; i + 8 <= Size; i += 8)
+    {
+        uint64_t WordA, WordB;
+        memcpy(&WordA, pA + i, sizeof(WordA));
+        memcpy(&WordB, pB + i, sizeof(WordB));
+        if (WordA != WordB || 0 != (WordA & 0x8080'8080'8080'8080ULL))
+        {
+            break;
+        }
+    }
+#endif
+
+    return i;
+}
+
+// Number of leading ASCII bytes equal to the corresponding UTF-16 units
+inline static size_t KS_SimdAsciiEqualUtf16Prefix(const uint8_t* pBytes, const uint8_t* pUnits, size_t Count, bool BigEndian)
+{
+    size_t i = 0;
+
+#if defined(KSTRING_HAS_SSE2)
+    const __m128i AsciiMax = _mm_set1_epi16(0x7F);
+    const __m128i Zero     = _mm_setzero_si128();
+    for (; i + 8 <= Count; i += 8)
+    {
+        __m128i Widened = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(pBytes + i)), Zero);
+        __m128i Units   = _mm_loadu_si128((const __m128i*)(pUnits + 2 * i));
+        if (true == BigEndian)
+        {
+            Units = KS_SimdSwapBytes16(Units);
+        }
+
+        // Equal units that are <= 0x7F (saturating subtraction leaves zero)
+        __m128i  Match = _mm_and_si128(_mm_cmpeq_epi16(Widened, Units), _mm_cmpeq_epi16(_mm_subs_epu16(Units, AsciiMax), Zero));
+        unsigned Mask  = (unsigned)_mm_movemask_epi8(Match);
+        if (0xFFFF != Mask)
+        {
+            return i + KS_CountTrailingZeros64(~Mask & 0xFFFF) / 2;
+        }
+    }
+#else
+    (void)pBytes;
+    (void)pUnits;
+    (void)Count;
+    (void)BigEndian;
+#endif
+
+    return i;
+}
+
+// Number of leading UTF-16 units that are equal and not surrogates in both inputs (byte orders may differ)
+inline static size_t KS_SimdUtf16EqualPrefix(const uint8_t* pA, bool BigEndianA, const uint8_t* pB, bool BigEndianB, size_t Count)
+{
+    size_t i = 0;
+
+#if defined(KSTRING_HAS_SSE2)
+    // Blocks stay in the byte order of A, so the surrogate test uses byte-swapped constants for big-endian
+    const __m128i SurrogateMask = _mm_set1_epi16((true == BigEndianA) ? (short)0x00F8 : (short)0xF800);
+    const __m128i Surrogate     = _mm_set1_epi16((true == BigEndianA) ? (short)0x00D8 : (short)0xD800);
+    for (; i + 8 <= Count; i += 8)
+    {
+        __m128i BlockA = _mm_loadu_si128((const __m128i*)(pA + 2 * i));
+        __m128i BlockB = _mm_loadu_si128((const __m128i*)(pB + 2 * i));
+        if (BigEndianA != BigEndianB)
+        {
+            BlockB = KS_SimdSwapBytes16(BlockB);
+        }
+
+        __m128i  IsSurrogate = _mm_cmpeq_epi16(_mm_and_si128(BlockA, SurrogateMask), Surrogate);
+        unsigned Mask        = (unsigned)_mm_movemask_epi8(_mm_andnot_si128(IsSurrogate, _mm_cmpeq_epi16(BlockA, BlockB)));
+        if (0xFFFF != Mask)
+        {
+            return i + KS_CountTrailingZeros64(~Mask & 0xFFFF) / 2;
+        }
+    }
+#else
+    (void)pA;
+    (void)BigEndianA;
+    (void)pB;
+    (void)BigEndianB;
+    (void)Count;
+#endif
+
+    return i;
+}
+
+//
+// Case-Insensitive Comparison
+//
+
+#if defined(KSTRING_HAS_SSE2)
+// Lowercase ASCII letters of a byte block (bytes >= 0x80 are negative and never in 'A'..'Z')
+inline static __m128i KS_SimdToLowerAscii8(__m128i Block)
+{
+    __m128i Upper = _mm_and_si128(_mm_cmpgt_epi8(Block, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(Block, _mm_set1_epi8('Z' + 1)));
+    return _mm_or_si128(Block, _mm_and_si128(Upper, _mm_set1_epi8(0x20)));
+}
+
+// Lowercase ASCII letters of a UTF-16 unit block in host order (units >= 0x8000 are negative)
+inline static __m128i KS_SimdToLowerAscii16(__m128i Block)
+{
+    __m128i Upper = _mm_and_si128(_mm_cmpgt_epi16(Block, _mm_set1_epi16('A' - 1)), _mm_cmplt_epi16(Block, _mm_set1_epi16('Z' + 1)));
+    return _mm_or_si128(Block, _mm_and_si128(Upper, _mm_set1_epi16(0x20)));
+}
+#endif
+
+// Number of leading bytes that are ASCII in both inputs and equal ignoring ASCII case
+inline static size_t KS_SimdAsciiEqualIgnoreCasePrefix(const uint8_t* pA, const uint8_t* pB, size_t Size)
+{
+    size_t i = 0;
+
+#if defined(KSTRING_HAS_SSE2)
+    for (; i + 16 <= Size; i += 16)
+    {
+        __m128i  BlockA = KS_SimdToLowerAscii8(_mm_loadu_si128((const __m128i*)(pA + i)));
+        __m128i  BlockB = KS_SimdToLowerAscii8(_mm_loadu_si128((const __m128i*)(pB + i)));
+        unsigned Mask   = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(BlockA, BlockB)) & ~(unsigned)_mm_movemask_epi8(BlockA);
+        if (0xFFFF != Mask)
+        {
+            return i + KS_CountTrailingZeros64(~Mask & 0xFFFF);
+        }
+    }
+#else
+    // SWAR: lowercase by adding 0x20 to bytes in 'A'..'Z' (all bytes are ASCII, so no carries cross bytes)
+    for (; i + 8 <= Size; i += 8)
+    {
+        uint64_t WordA, WordB;
+        memcpy(&WordA, pA + i, sizeof(WordA));
+        memcpy(&WordB, pB + i, sizeof(WordB));
+        if (0 != ((WordA | WordB) & 0x8080'8080'8080'8080ULL))
+        {
+            break;
+        }
+
+        uint64_t UpperA = ((WordA + 0x3F3F'3F3F'3F3F'3F3FULL) & ~(WordA + 0x2525'2525'2525'2525ULL)) & 0x8080'8080'8080'8080ULL;
+        uint64_t UpperB = ((WordB + 0x3F3F'3F3F'3F3F'3F3FULL) & ~(WordB + 0x2525'2525'2525'2525ULL)) & 0x8080'8080'8080'8080ULL;
+        if ((WordA | (UpperA >> 2)) != (WordB | (UpperB >> 2)))
+        {
+            break;
+        }
+    }
+#endif
+
+    return i;
+}
+
+// Number of leading UTF-16 units that are ASCII in both inputs and equal ignoring ASCII case (byte orders may differ)
+inline static size_t KS_SimdUtf16EqualIgnoreCasePrefix(const uint8_t* pA, bool BigEndianA, const uint8_t* pB, bool BigEndianB, size_t Count)
+{
+    size_t i = 0;
+
+#if defined(KSTRING_HAS_SSE2)
+    const __m128i AsciiMax = _mm_set1_epi16(0x7F);
+    const __m128i Zero     = _mm_setzero_si128();
+    for (; i + 8 <= Count; i += 8)
+    {
+        __m128i BlockA = _mm_loadu_si128((const __m128i*)(pA + 2 * i));
+        __m128i BlockB = _mm_loadu_si128((const __m128i*)(pB + 2 * i));
+        if (true == BigEndianA)
+        {
+            BlockA = KS_SimdSwapBytes16(BlockA);
+        }
+        if (true == BigEndianB)
+        {
+            BlockB = KS_SimdSwapBytes16(BlockB);
+        }
+
+        __m128i  Ascii = _mm_cmpeq_epi16(_mm_subs_epu16(BlockA, AsciiMax), Zero);
+        __m128i  Match = _mm_and_si128(Ascii, _mm_cmpeq_epi16(KS_SimdToLowerAscii16(BlockA), KS_SimdToLowerAscii16(BlockB)));
+        unsigned Mask  = (unsigned)_mm_movemask_epi8(Match);
+        if (0xFFFF != Mask)
+        {
+            return i + KS_CountTrailingZeros64(~Mask & 0xFFFF) / 2;
+        }
+    }
+#else
+    (void)pA;
+    (void)BigEndianA;
+    (void)pB;
+    (void)BigEndianB;
+    (void)Count;
+#endif
+
+    return i;
+}
+
+//
+// Case Conversion
+//
+
+// Flip the case of ASCII letters in a word of 8 bytes ('a'..'z' for Upper, 'A'..'Z' otherwise), other bytes are kept
+// High bits are masked off first, so the additions cannot carry into the next byte
+inline static uint64_t KS_SwarChangeCaseAscii64(uint64_t Word, bool Upper)
+{
+    const uint64_t High     = 0x8080'8080'8080'8080ULL;
+    const uint64_t ToFirst  = (true == Upper) ? 0x1F1F'1F1F'1F1F'1F1FULL : 0x3F3F'3F3F'3F3F'3F3FULL;
+    const uint64_t PastLast = (true == Upper) ? 0x0505'0505'0505'0505ULL : 0x2525'2525'2525'2525ULL;
+
+    uint64_t Low    = Word & ~High;
+    uint64_t Letter = (Low + ToFirst) & ~(Low + PastLast) & ~Word & High;
+    return Word ^ (Letter >> 2);
+}
+
+// Flip the case of ASCII letters ('a'..'z' for Upper, 'A'..'Z' otherwise) in leading 16-byte blocks
+// Other bytes are copied unchanged; StopAtNonAscii stops at the first block containing a byte >= 0x80
+inline static size_t KS_SimdChangeCaseAscii(const uint8_t* pInput, size_t Size, uint8_t* pOutput, bool Upper, bool StopAtNonAscii)
+{
+    size_t i = 0;
+
+#if defined(KSTRING_HAS_SSE2)
+    const __m128i First   = _mm_set1_epi8((true == Upper) ? 'a' - 1 : 'A' - 1);
+    const __m128i Last    = _mm_set1_epi8((true == Upper) ? 'z' + 1 : 'Z' + 1);
+    const __m128i CaseBit = _mm_set1_epi8(0x20);
+    for (; i + 16 <= Size; i += 16)
+    {
+        __m128i Block = _mm_loadu_si128((const __m128i*)(pInput + i));
+        if (true == StopAtNonAscii && 0 != _mm_movemask_epi8(Block))
+        {
+            break;
+        }
+
+        // Bytes >= 0x80 are negative and never letters
+        __m128i Letter = _mm_and_si128(_mm_cmpgt_epi8(Block, First), _mm_cmplt_epi8(Block, Last));
+        _mm_storeu_si128((__m128i*)(pOutput + i), _mm_xor_si128(Block, _mm_and_si128(Letter, CaseBit)));
+    }
+#else
+    for (; i + 8 <= Size; i += 8)
+    {
+        uint64_t Word;
+        memcpy(&Word, pInput + i, sizeof(Word));
+        if (true == StopAtNonAscii && 0 != (Word & 0x8080'8080'8080'8080ULL))
+        {
+            break;
+        }
+
+        Word = KS_SwarChangeCaseAscii64(Word, Upper);
+        memcpy(pOutput + i, &Word, sizeof(Word));
+    }
+#endif
+
+    return i;
+}
+
+// Flip the case of ASCII letters in leading 8-unit blocks of UTF-16 (StopAtNonAscii: only blocks of units <= 0x7F)
+inline static size_t KS_SimdChangeCaseAsciiUtf16(const uint8_t* pInput, size_t Count, uint8_t* pOutput, bool BigEndian, bool Upper, bool StopAtNonAscii)
+{
+    size_t i = 0;
+
+#if defined(KSTRING_HAS_SSE2)
+    const __m128i First    = _mm_set1_epi16((true == Upper) ? 'a' - 1 : 'A' - 1);
+    const __m128i Last     = _mm_set1_epi16((true == Upper) ? 'z' + 1 : 'Z' + 1);
+    const __m128i CaseBit  = _mm_set1_epi16(0x20);
+    const __m128i AsciiMax = _mm_set1_epi16(0x7F);
+    const __m128i Zero     = _mm_setzero_si128();
+    for (; i + 8 <= Count; i += 8)
+    {
+        __m128i Block = _mm_loadu_si128((const __m128i*)(pInput + 2 * i));
+        if (true == BigEndian)
+        {
+            Block = KS_SimdSwapBytes16(Block);
+        }
+
+        if (true == StopAtNonAscii && 0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_subs_epu16(Block, AsciiMax), Zero)))
+        {
+            break;
+        }
+
+        // Units >= 0x8000 are negative and never letters
+        __m128i Letter = _mm_and_si128(_mm_cmpgt_epi16(Block, First), _mm_cmplt_epi16(Block, Last));
+        Block          = _mm_xor_si128(Block, _mm_and_si128(Letter, CaseBit));
+        if (true == BigEndian)
+        {
+            Block = KS_SimdSwapBytes16(Block);
+        }
+        _mm_storeu_si128((__m128i*)(pOutput + 2 * i), Block);
+    }
+#else
+    (void)pInput;
+    (void)Count;
+    (void)pOutput;
+    (void)BigEndian;
+    (void)Upper;
+    (void)StopAtNonAscii;
+#endif
+
+    return i;
+}
+
+//
+// Normalization
+//
+
+// Number of leading bytes below Limit (Limit > 0) in 16-byte blocks
+inline static size_t KS_SimdBytesBelowPrefix(const uint8_t* pData, size_t Size, uint8_t Limit)
+{
+    size_t i = 0;
+
+#if defined(KSTRING_HAS_SSE2)
+    // Saturating subtraction leaves zero exactly for bytes <= Limit - 1
+    const __m128i Max  = _mm_set1_epi8((char)(Limit - 1));
+    const __m128i Zero = _mm_setzero_si128();
+    for (; i + 16 <= Size; i += 16)
+    {
+        __m128i Block = _mm_loadu_si128((const __m128i*)(pData + i));
+        if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_subs_epu8(Block, Max), Zero)))
+        {
+            break;
+        }
+    }
+#else
+    for (; i + 8 <= Size; i += 8)
+    {
+        size_t j = 0;
+        while (j < 8 && pData[i + j] < Limit)
+        {
+            ++j;
+        }
+        if (j < 8)
+        {
+            break;
+        }
+    }
+#endif
+
+    return i;
+}
+
+// Number of leading UTF-16 units below Limit (Limit > 0) in 8-unit blocks
+inline static size_t KS_SimdUtf16BelowPrefix(const uint8_t* pInput, size_t Count, bool BigEndian, uint16_t Limit)
+{
+    size_t i = 0;
+
+#if defined(KSTRING_HAS_SSE2)
+    const __m128i Max  = _mm_set1_epi16((short)(Limit - 1));
+    const __m128i Zero = _mm_setzero_si128();
+    for (; i + 8 <= Count; i += 8)
+    {
+        __m128i Block = _mm_loadu_si128((const __m128i*)(pInput + 2 * i));
+        if (true == BigEndian)
+        {
+            Block = KS_SimdSwapBytes16(Block);
+        }
+
+        if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_subs_epu16(Block, Max), Zero)))
+        {
+            break;
+        }
+    }
+#else
+    (void)pInput;
+    (void)Count;
+    (void)BigEndian;
+    (void)Limit;
+#endif
+
+    return i;
+}
+
+//
+// Encoding Detection
+//
+
+// Count zero bytes at even and odd offsets in leading 16-byte blocks, returns bytes processed
+inline static size_t KS_SimdCountZeroBytes(const uint8_t* pData, size_t Size, size_t* pEven, size_t* pOdd)
+{
+    size_t i    = 0;
+    size_t Even = 0;
+    size_t Odd  = 0;
+
+#if defined(KSTRING_HAS_SSE2)
+    const __m128i Zero = _mm_setzero_si128();
+    for (; i + 16 <= Size; i += 16)
+    {
+        uint32_t Mask  = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(pData + i)), Zero));
+        Even          += KS_PopCount32(Mask & 0x5555);
+        Odd           += KS_PopCount32(Mask & 0xAAAA);
+    }
+#else
+    (void)pData;
+    (void)Size;
+#endif
+
+    *pEven = Even;
+    *pOdd  = Odd;
+    return i;
+}
+
+#endif // KSTRING_SIMD_H
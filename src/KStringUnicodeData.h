@@ -0,0 +1,1363 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+
+// Generated by tools/GenerateUnicodeTables.py from Unicode 14.0.0, do not edit
+
+#ifndef KSTRING_UNICODE_DATA_H
+#define KSTRING_UNICODE_DATA_H
+
+#include <stdint.h>
+
+//
+// Simple Case Folding (CaseFolding.txt status C and S)
+//
+
+#define KSTRING_CASEFOLD_LIMIT 0x1EA00
+
+static const uint8_t KS_CaseFoldStage1[245] = {
+    0, 1, 2, 3, 3, 3, 3, 3, 4, 5, 3, 3, 3, 3, 6, 7, 8, 3, 9, 3, 3, 3, 10, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 11, 3, 12, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 13,
+    3, 3, 14, 3, 3, 3, 15, 3, 3, 3, 3, 3, 16, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 17, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18,
+};
+
+static const uint8_t KS_CaseFoldStage2[608] = {
+    0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 4, 5, 0, 0, 6, 6, 6, 7, 8, 6, 6, 9, 10, 11, 12, 13, 14, 15, 6, 16,
+    6, 6, 17, 18, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 21, 22, 1, 23, 0, 24, 25, 6, 26,
+    27, 4, 4, 0, 0, 0, 6, 6, 28, 6, 6, 6, 29, 6, 6, 6, 6, 6, 6, 30, 31, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 33, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35,
+    0, 0, 0, 0, 0, 0, 0, 0, 36, 37, 37, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 39, 6, 6, 6, 6, 6, 6, 40, 35, 40, 40, 35, 41, 40, 0, 40, 40, 40, 42, 43, 44, 45, 46,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 48, 0, 0, 49, 0, 50, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    31, 31, 31, 0, 0, 0, 53, 54, 6, 6, 6, 6, 6, 6, 55, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 6, 57, 0, 6, 58, 0, 0, 0, 0, 0, 0, 0, 0, 59, 59, 6, 6, 6, 60, 61, 62, 63, 64, 65, 66, 0, 67,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 68, 68, 68, 68, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    69, 69, 70, 0, 0, 0, 0, 0, 0, 0, 0, 69, 69, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 72, 73, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 74, 74, 74, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 76, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t KS_CaseFoldStage3[1248] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 0, 66, 66, 66, 66, 66, 66, 66, 0,
+    59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 0, 0, 59, 0, 59, 0, 59, 0, 0, 59, 0, 59, 0, 59, 0, 59,
+    0, 59, 0, 59, 0, 59, 0, 59, 0, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 40, 59, 0, 59, 0, 59, 0, 34,
+    0, 86, 59, 0, 59, 0, 83, 59, 0, 82, 82, 59, 0, 0, 77, 80, 81, 59, 0, 82, 84, 0, 87, 85, 59, 0, 0, 0, 87, 88, 0, 89,
+    59, 0, 59, 0, 59, 0, 91, 59, 0, 91, 0, 0, 59, 0, 91, 59, 0, 90, 90, 59, 0, 59, 0, 92, 59, 0, 0, 0, 59, 0, 0, 0,
+    0, 0, 0, 0, 60, 59, 0, 60, 59, 0, 60, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 0, 59, 0,
+    0, 60, 59, 0, 59, 0, 43, 49, 59, 0, 59, 0, 59, 0, 59, 0, 37, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+    59, 0, 59, 0, 0, 0, 0, 0, 0, 0, 97, 59, 0, 36, 96, 0, 0, 59, 0, 35, 75, 76, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+    0, 0, 0, 0, 0, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 59, 0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 79,
+    0, 0, 0, 0, 0, 0, 69, 0, 68, 68, 68, 0, 74, 0, 73, 73, 66, 66, 0, 66, 66, 66, 66, 66, 66, 66, 66, 66, 0, 0, 0, 0,
+    0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 61, 52, 53, 0, 0, 0, 55, 54, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+    50, 51, 0, 0, 47, 46, 0, 59, 0, 58, 59, 0, 0, 37, 37, 37, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 59, 0, 59, 0, 62, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 0,
+    0, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    72, 72, 72, 72, 72, 72, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+    95, 95, 95, 95, 95, 95, 0, 95, 0, 0, 0, 0, 0, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 57, 57, 57, 57, 0, 0,
+    25, 26, 27, 29, 29, 28, 30, 31, 98, 0, 0, 0, 0, 0, 0, 0, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 0, 0, 33, 33, 33, 59, 0, 59, 0, 59, 0, 0, 0, 0, 0, 0, 48, 0, 0, 22, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 57, 0, 57, 0, 57,
+    0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 45, 45, 56, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 56, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 42, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 41, 41, 58, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 38, 38, 39, 39, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 20, 21, 0, 0, 0, 0,
+    0, 0, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 59, 0, 18, 32, 19, 0, 0, 59, 0, 59, 0, 59, 0, 16, 17, 14,
+    15, 0, 59, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13, 59, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 59, 0, 0,
+    0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 0, 0,
+    59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 0, 0, 0, 0, 0, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 59, 0, 12, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 0, 0, 0, 59, 0, 7, 0, 0,
+    59, 0, 59, 0, 0, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 3, 1, 2, 5, 3, 0,
+    9, 6, 8, 94, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 51, 4, 11, 59, 0, 59, 0, 0, 0, 0, 0, 0,
+    59, 0, 0, 0, 0, 0, 59, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+    71, 71, 71, 71, 71, 71, 71, 71, 0, 0, 0, 0, 0, 0, 0, 0, 71, 71, 71, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 0, 70, 70, 70, 70, 70, 70, 70, 0, 70, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const int32_t KS_CaseFoldDeltas[99] = {
+    0, -42319, -42315, -42308, -42307, -42305, -42282, -42280, -42261, -42258, -38864, -35384,
+    -35332, -10815, -10783, -10782, -10780, -10749, -10743, -10727, -8383, -8262, -7615, -7517,
+    -7173, -6222, -6221, -6212, -6211, -6210, -6204, -6180, -3814, -3008, -268, -195,
+    -163, -130, -128, -126, -121, -112, -100, -97, -86, -74, -64, -60,
+    -58, -56, -54, -48, -30, -25, -22, -15, -9, -8, -7, 1,
+    2, 8, 15, 16, 26, 28, 32, 34, 37, 38, 39, 40,
+    48, 63, 64, 69, 71, 79, 80, 116, 202, 203, 205, 206,
+    207, 209, 210, 211, 213, 214, 217, 218, 219, 775, 928, 7264,
+    10792, 10795, 35267,
+};
+
+//
+// Simple Case Mapping (UnicodeData.txt simple lowercase and uppercase)
+//
+
+#define KSTRING_LOWERCASE_LIMIT 0x1EA00
+
+static const uint8_t KS_LowerCaseStage1[245] = {
+    0, 1, 2, 3, 3, 3, 3, 3, 4, 5, 3, 3, 3, 3, 6, 7, 8, 3, 9, 3, 3, 3, 10, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 11, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 12,
+    3, 3, 13, 3, 3, 3, 14, 3, 3, 3, 3, 3, 15, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 16, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 17,
+};
+
+static const uint8_t KS_LowerCaseStage2[576] = {
+    0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 3, 4, 0, 0, 5, 5, 5, 6, 7, 5, 5, 8, 9, 10, 11, 12, 13, 14, 5, 15,
+    5, 5, 16, 17, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 20, 1, 21, 0, 22, 23, 5, 24,
+    25, 3, 3, 0, 0, 0, 5, 5, 26, 5, 5, 5, 27, 5, 5, 5, 5, 5, 5, 28, 29, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 31, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 33, 33, 33, 33, 34,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 35, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 37, 5, 5, 5, 5, 5, 5, 38, 39, 38, 38, 39, 40, 38, 0, 38, 38, 38, 41, 42, 43, 44, 45,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 47, 0, 0, 48, 0, 49, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29, 29, 29, 0, 0, 0, 52, 53, 5, 5, 5, 5, 5, 5, 54, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 5, 56, 0, 5, 57, 0, 0, 0, 0, 0, 0, 0, 0, 58, 58, 5, 5, 5, 59, 60, 61, 62, 63, 64, 65, 0, 66,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    67, 67, 68, 0, 0, 0, 0, 0, 0, 0, 0, 67, 67, 69, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 70, 71, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 72, 72, 72, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 74, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t KS_LowerCaseStage3[1216] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0,
+    25, 0, 43, 0, 43, 0, 43, 0, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 0, 43, 0, 43, 0, 43, 0,
+    43, 0, 43, 0, 43, 0, 43, 0, 31, 43, 0, 43, 0, 43, 0, 0, 0, 70, 43, 0, 43, 0, 67, 43, 0, 66, 66, 43, 0, 0, 61, 64,
+    65, 43, 0, 66, 68, 0, 71, 69, 43, 0, 0, 0, 71, 72, 0, 73, 43, 0, 43, 0, 43, 0, 75, 43, 0, 75, 0, 0, 43, 0, 75, 43,
+    0, 74, 74, 43, 0, 43, 0, 76, 43, 0, 0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 44, 43, 0, 44, 43, 0, 44, 43, 0, 43, 0, 43,
+    0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 0, 43, 0, 0, 44, 43, 0, 43, 0, 34, 38, 43, 0, 43, 0, 43, 0, 43, 0,
+    28, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 0, 0, 0, 0, 0, 0, 80, 43, 0, 27, 79, 0,
+    0, 43, 0, 26, 59, 60, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 63,
+    0, 0, 0, 0, 0, 0, 53, 0, 52, 52, 52, 0, 58, 0, 57, 57, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 43, 0, 43, 0, 43, 0,
+    0, 0, 0, 0, 37, 0, 0, 43, 0, 42, 43, 0, 0, 28, 28, 28, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 43, 0, 43, 0, 46, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 0,
+    0, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 0, 78, 0, 0, 0, 0, 0, 78, 0, 0, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    45, 45, 45, 45, 45, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 24, 24, 24, 43, 0, 43, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 41, 41, 41, 41, 41, 41, 41, 41, 0, 0, 0, 0, 0, 0, 0, 0, 41, 41, 41, 41, 41, 41, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 41, 0, 41, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 41, 41, 36, 36, 40, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 35, 35, 35, 35, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 41, 33, 33, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 41, 41, 32, 32, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 30, 30, 40, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 19, 20, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 0, 0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    43, 0, 17, 23, 18, 0, 0, 43, 0, 43, 0, 43, 0, 15, 16, 13, 14, 0, 43, 0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 12, 12,
+    43, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 43, 0, 0, 0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 0, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 0, 0, 0, 0,
+    0, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 43, 0, 11, 43, 0,
+    43, 0, 43, 0, 43, 0, 43, 0, 0, 0, 0, 43, 0, 7, 0, 0, 43, 0, 43, 0, 0, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0,
+    43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 3, 1, 2, 5, 3, 0, 9, 6, 8, 77, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0,
+    43, 0, 43, 0, 39, 4, 10, 43, 0, 43, 0, 0, 0, 0, 0, 0, 43, 0, 0, 0, 0, 0, 43, 0, 43, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 0, 0, 0, 0, 0, 0, 0, 0, 55, 55, 55, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const int32_t KS_LowerCaseDeltas[82] = {
+    0, -42319, -42315, -42308, -42307, -42305, -42282, -42280, -42261, -42258, -35384, -35332,
+    -10815, -10783, -10782, -10780, -10749, -10743, -10727, -8383, -8262, -7615, -7517, -3814,
+    -3008, -199, -195, -163, -130, -128, -126, -121, -112, -100, -97, -86,
+    -74, -60, -56, -48, -9, -8, -7, 1, 2, 8, 15, 16,
+    26, 28, 32, 34, 37, 38, 39, 40, 48, 63, 64, 69,
+    71, 79, 80, 116, 202, 203, 205, 206, 207, 209, 210, 211,
+    213, 214, 217, 218, 219, 928, 7264, 10792, 10795, 38864,
+};
+
+#define KSTRING_UPPERCASE_LIMIT 0x1EA00
+
+static const uint8_t KS_UpperCaseStage1[245] = {
+    0, 1, 2, 3, 3, 3, 3, 3, 4, 5, 3, 3, 3, 3, 6, 7, 8, 3, 9, 3, 3, 3, 10, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 11, 3, 12, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 13,
+    3, 3, 14, 3, 3, 3, 15, 3, 3, 3, 3, 3, 16, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 17, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18,
+};
+
+static const uint8_t KS_UpperCaseStage2[608] = {
+    0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 3, 0, 0, 4, 5, 6, 6, 6, 7, 8, 6, 6, 9, 10, 11, 12, 13, 14, 15, 6, 16,
+    6, 6, 17, 18, 19, 20, 21, 22, 23, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 26, 0, 0, 27, 1, 28, 29, 6, 30,
+    0, 0, 0, 4, 4, 31, 6, 6, 32, 6, 6, 6, 33, 6, 6, 6, 6, 6, 6, 0, 0, 0, 34, 35, 36, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39,
+    0, 0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 42, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 43, 6, 6, 6, 6, 6, 6, 44, 45, 44, 44, 45, 46, 44, 47, 44, 44, 44, 48, 49, 50, 51, 49,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 0, 0, 53, 54, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 35, 35, 35, 57, 58, 6, 6, 6, 6, 6, 6, 59, 60, 61, 61, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 6, 63, 0, 6, 64, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 6, 6, 6, 65, 66, 67, 68, 69, 70, 71, 0, 72,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 0, 74, 74, 74, 74, 74, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 75, 76, 76, 0, 0, 0, 0, 0, 0, 0, 0, 75, 76, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 79, 80, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 81, 81, 82, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 84, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t KS_UpperCaseStage3[1376] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 49, 49, 49, 49, 49, 49, 49, 69,
+    0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 15, 0, 57, 0, 57, 0, 57, 0, 0, 57, 0, 57, 0, 57, 0,
+    57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 0, 57, 0, 57, 0, 57, 14,
+    74, 0, 0, 57, 0, 57, 0, 0, 57, 0, 0, 0, 57, 0, 0, 0, 0, 0, 57, 0, 0, 66, 0, 0, 0, 57, 73, 0, 0, 0, 72, 0,
+    0, 57, 0, 57, 0, 57, 0, 0, 57, 0, 0, 0, 0, 57, 0, 0, 57, 0, 0, 0, 57, 0, 57, 0, 0, 57, 0, 0, 0, 57, 0, 62,
+    0, 0, 0, 0, 0, 57, 56, 0, 57, 56, 0, 57, 56, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 33, 0, 57,
+    0, 0, 57, 56, 0, 57, 0, 0, 0, 57, 0, 57, 0, 57, 0, 57, 0, 0, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57,
+    0, 57, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 0, 84, 84, 0, 57, 0, 0, 0, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57,
+    83, 81, 82, 22, 25, 0, 26, 26, 0, 28, 0, 27, 96, 0, 0, 0, 26, 95, 0, 24, 0, 90, 94, 0, 23, 21, 94, 79, 92, 0, 0, 21,
+    0, 80, 20, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 78, 0, 0, 17, 0, 93, 17, 0, 0, 0, 91, 17, 35, 18, 18, 34, 0, 0, 0,
+    0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 88, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 57, 0, 57, 0, 0, 0, 57, 0, 0, 0, 72, 72, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 47, 47, 47,
+    49, 49, 50, 49, 49, 49, 49, 49, 49, 49, 49, 49, 36, 37, 37, 0, 38, 40, 0, 0, 0, 43, 41, 55, 0, 57, 0, 57, 0, 57, 0, 57,
+    31, 32, 58, 29, 0, 30, 0, 0, 57, 0, 0, 57, 0, 0, 0, 0, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 57, 0, 57, 0, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 54,
+    0, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 0, 0, 76, 76, 76, 0, 0, 0, 0, 0, 0, 0, 0, 55, 55, 55, 55, 55, 55, 0, 0,
+    6, 7, 8, 10, 10, 9, 11, 12, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 86, 0, 0, 0, 77, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87, 0, 0, 57, 0, 57, 0, 57, 0, 0, 0, 0, 0, 39, 0, 0, 0, 0,
+    59, 59, 59, 59, 59, 59, 59, 59, 0, 0, 0, 0, 0, 0, 0, 0, 59, 59, 59, 59, 59, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 59, 0, 59, 0, 59, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 63, 63, 65, 65, 65, 65, 67, 67, 71, 71, 68, 68, 70, 70, 0, 0,
+    59, 59, 0, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    59, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 59, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    0, 0, 0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 0, 0, 0, 0, 0, 0, 0, 57, 0, 0, 0, 2, 3, 0, 57, 0, 57, 0, 57, 0, 0, 0,
+    0, 0, 0, 57, 0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 57, 0,
+    0, 0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 0, 4, 0, 0, 0, 0, 0, 4, 0, 0, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 0,
+    0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 57, 0, 0, 57,
+    0, 57, 0, 57, 0, 57, 0, 57, 0, 0, 0, 0, 57, 0, 0, 0, 0, 57, 0, 57, 61, 0, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57,
+    0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57,
+    0, 57, 0, 57, 0, 0, 0, 0, 57, 0, 57, 0, 0, 0, 0, 0, 0, 57, 0, 0, 0, 0, 0, 57, 0, 57, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44, 44, 44, 44,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 0, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+    45, 45, 0, 45, 45, 45, 45, 45, 45, 45, 0, 45, 45, 0, 0, 0, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const int32_t KS_UpperCaseDeltas[97] = {
+    0, -38864, -10795, -10792, -7264, -7205, -6254, -6253, -6244, -6243, -6242, -6236,
+    -6181, -928, -300, -232, -219, -218, -217, -214, -213, -211, -210, -209,
+    -207, -206, -205, -203, -202, -116, -96, -86, -80, -79, -71, -69,
+    -64, -63, -62, -59, -57, -54, -48, -47, -40, -39, -38, -37,
+    -34, -32, -31, -28, -26, -16, -15, -8, -2, -1, 7, 8,
+    9, 48, 56, 74, 84, 86, 97, 100, 112, 121, 126, 128,
+    130, 163, 195, 743, 3008, 3814, 10727, 10743, 10749, 10780, 10782, 10783,
+    10815, 35266, 35332, 35384, 42258, 42261, 42280, 42282, 42305, 42307, 42308, 42315,
+    42319,
+};
+
+//
+// Canonical Normalization (combining classes, NFC/NFD quick check, decompositions and compositions)
+//
+
+#define KSTRING_NFC_QUICK_LIMIT 0x300
+#define KSTRING_NFD_QUICK_LIMIT 0xC0
+
+#define KSTRING_NFD_QC_NO    0x100
+#define KSTRING_NFC_QC_NO    0x200
+#define KSTRING_NFC_QC_MAYBE 0x400
+
+#define KSTRING_NORMALIZATION_LIMIT 0x2FC00
+
+static const uint8_t KS_NormalizationStage1[382] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 10, 10, 10, 18, 19, 10, 20, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 21, 22, 23, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 25, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 26, 27, 10, 28,
+    29, 30, 10, 10, 10, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 41, 10, 42, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 43, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 44, 45, 10, 10, 10, 10, 10, 10, 46, 47, 10, 10, 48, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 49, 50,
+};
+
+static const uint8_t KS_NormalizationStage2[1632] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 1, 3, 4, 5, 6, 7, 8, 9, 6, 10, 0, 0, 11, 12, 13, 14, 15, 16,
+    4, 17, 18, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 21, 22, 23, 24, 25, 26, 27, 28, 12, 29, 12, 30, 31, 0, 0,
+    32, 33, 0, 33, 0, 32, 0, 34, 35, 0, 0, 0, 36, 37, 38, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 41, 42, 43, 0, 0, 0,
+    0, 44, 45, 0, 46, 47, 0, 48, 0, 0, 0, 0, 49, 50, 51, 0, 0, 52, 0, 53, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 56,
+    0, 57, 58, 0, 0, 59, 0, 0, 0, 60, 0, 0, 61, 62, 63, 64, 0, 0, 33, 65, 66, 67, 0, 0, 0, 0, 0, 68, 69, 70, 0, 71,
+    0, 0, 0, 72, 66, 73, 0, 0, 0, 0, 0, 74, 66, 0, 0, 0, 0, 0, 0, 68, 75, 76, 0, 0, 0, 77, 0, 78, 79, 80, 0, 0,
+    0, 0, 0, 74, 81, 82, 0, 0, 0, 0, 0, 74, 83, 84, 0, 0, 0, 0, 0, 85, 79, 80, 0, 0, 0, 0, 0, 0, 86, 87, 0, 0,
+    0, 0, 0, 88, 89, 0, 0, 0, 0, 0, 0, 90, 91, 0, 0, 0, 0, 92, 0, 93, 94, 95, 96, 97, 98, 94, 95, 96, 99, 0, 0, 0,
+    0, 0, 100, 101, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 104, 0, 0, 105, 106, 107, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 109, 0, 110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 111, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 112, 0, 0, 0, 0, 0, 0, 0, 0, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 114, 0, 0, 0, 0, 115, 116, 0, 0, 0, 117, 118, 0, 0, 0, 119, 120, 0, 121, 122, 0, 123, 124, 0, 0, 125, 0, 0, 0, 126, 127,
+    0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 129, 130, 131, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 132, 133, 134, 135,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 136, 4, 4, 4, 4, 4, 137, 4, 138, 4, 4, 138, 139, 4, 140, 4, 4, 4, 141, 142, 143, 144, 145,
+    146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 147, 148, 149, 0, 0, 150, 0, 0, 0, 0, 0, 0, 151, 152, 0, 13, 0, 0, 0,
+    153, 0, 154, 0, 155, 0, 156, 157, 157, 0, 158, 0, 0, 0, 159, 0, 0, 0, 160, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 161, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 162, 163, 0, 0, 0, 0, 0, 0, 0, 164, 0, 0, 0, 0, 0, 0, 134, 134,
+    0, 0, 165, 0, 166, 167, 168, 169, 0, 170, 166, 167, 168, 169, 0, 171, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 162, 172, 0, 173, 0, 0, 0, 0, 0, 163, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    174, 0, 175, 0, 0, 0, 0, 0, 0, 0, 0, 0, 110, 0, 134, 163, 0, 0, 176, 0, 0, 177, 0, 0, 0, 0, 0, 178, 115, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 179, 180, 0, 0, 174, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 19, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+    182, 183, 184, 181, 181, 181, 182, 181, 181, 181, 181, 181, 181, 185, 0, 0, 0, 186, 187, 188, 189, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 191, 0, 0, 0, 0, 0, 0, 0, 0, 192, 0, 0, 0, 0, 0, 0, 0, 0,
+    193, 0, 0, 194, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 195, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 196, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 198, 191, 0, 0, 199, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 174, 0, 0, 200, 0, 201, 202, 203, 0, 0, 0, 0, 204, 0, 205, 206, 0, 0, 0, 178, 0, 0, 0, 0, 207, 0, 0, 0,
+    0, 0, 0, 208, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 209, 0, 0, 0, 0, 210, 69, 80, 211, 212, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 213, 71, 0, 0, 0, 0, 0, 214, 215, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 216, 217, 218, 0, 0, 0,
+    0, 0, 0, 164, 0, 0, 0, 0, 0, 0, 0, 219, 0, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 221, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 178, 0, 0, 0, 0, 0, 0, 0, 0, 0, 115, 0,
+    0, 0, 0, 110, 223, 0, 0, 0, 0, 224, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 164, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 225, 0, 0, 0, 0, 223, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 226, 0, 0, 0, 227, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 228,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 229, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 231, 232, 233, 0, 234, 235, 236, 0, 0, 0,
+    0, 0, 0, 0, 237, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    238, 239, 240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 227, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 0, 0, 0, 241, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 242, 0, 0, 0, 0, 0, 0, 243, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+    181, 182, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t KS_NormalizationStage3[3904] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53, 53, 53, 53, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    0, 53, 53, 53, 53, 53, 53, 0, 0, 53, 53, 53, 53, 53, 0, 0, 0, 53, 53, 53, 53, 53, 53, 0, 0, 53, 53, 53, 53, 53, 0, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 0, 0, 53, 53, 53, 53, 0, 53, 53, 53, 53, 53, 53, 0,
+    0, 0, 0, 53, 53, 53, 53, 53, 53, 0, 0, 0, 53, 53, 53, 53, 53, 53, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53,
+    53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 53, 53, 53, 53, 53, 53, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 0, 0, 0, 53, 53, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 0, 53, 53,
+    0, 0, 0, 0, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    65, 65, 65, 65, 65, 49, 65, 65, 65, 65, 65, 65, 65, 49, 49, 65, 49, 65, 49, 65, 65, 50, 44, 44, 44, 44, 50, 63, 44, 44, 44, 44,
+    44, 40, 40, 64, 64, 64, 64, 62, 62, 44, 44, 44, 44, 64, 64, 44, 64, 64, 44, 44, 1, 1, 1, 1, 57, 44, 44, 44, 44, 49, 49, 49,
+    55, 55, 65, 55, 55, 66, 49, 44, 44, 44, 49, 49, 49, 44, 44, 0, 49, 49, 49, 44, 44, 44, 44, 49, 50, 44, 44, 49, 51, 52, 52, 51,
+    52, 52, 51, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0,
+    0, 0, 0, 0, 0, 53, 53, 54, 53, 53, 53, 0, 53, 0, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53, 53, 53, 53,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53, 53, 53, 0, 0, 0, 0, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    53, 53, 0, 53, 0, 0, 0, 53, 0, 0, 0, 0, 53, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53, 53, 0, 0, 53, 53, 0, 0, 53, 53, 53, 53, 53, 53,
+    0, 0, 53, 53, 53, 53, 53, 53, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 0, 53, 53, 0, 0, 0, 0, 0, 0,
+    0, 44, 49, 49, 49, 49, 44, 49, 49, 49, 45, 44, 49, 49, 49, 49, 49, 49, 44, 44, 44, 44, 44, 44, 49, 49, 44, 49, 49, 45, 48, 49,
+    5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 14, 15, 16, 17, 0, 18, 0, 19, 20, 0, 49, 44, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0,
+    49, 49, 49, 49, 49, 49, 49, 49, 25, 26, 27, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 23, 24, 25, 26, 27, 28, 29, 65, 65, 64, 44, 49, 49, 49, 49, 49, 44, 49, 49, 44,
+    30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 53, 0, 0, 49, 49, 49, 49, 49, 49, 49, 0, 0, 49, 49, 49, 49, 44, 49, 0, 0, 49, 49, 0, 44, 49, 49, 44, 0, 0,
+    0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 44, 49, 49, 44, 49, 49, 44, 44, 44, 49, 44, 44, 49, 44, 49,
+    49, 49, 44, 49, 44, 49, 44, 49, 44, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49,
+    49, 49, 44, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 0, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 0, 49, 49, 49, 0, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 49, 44, 44, 44, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 44,
+    44, 44, 44, 44, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 44, 49, 49, 44, 49, 49, 44, 49, 49, 49, 44, 44, 44,
+    22, 23, 24, 49, 49, 49, 44, 49, 49, 44, 44, 49, 49, 49, 49, 49, 0, 53, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 49, 44, 49, 49, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 54, 54, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0,
+    0, 0, 0, 54, 0, 0, 54, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 0, 0, 54, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 53, 53, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 56, 56, 0, 0, 0, 0, 54, 54, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 32, 61, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 56, 0, 0, 0, 0, 53, 53, 0, 53, 53, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 56, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 53, 53, 53, 56,
+    0, 0, 0, 0, 0, 0, 0, 0, 33, 33, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 34, 34, 34, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 35, 35, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 36, 36, 36, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 44, 0, 42, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 54, 0, 0, 0, 0, 54, 0, 0, 0, 0, 54, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 37, 38, 54, 39, 54, 54, 0, 54, 0, 38, 38, 38, 38, 0, 0,
+    38, 54, 49, 49, 4, 0, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 4, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 49, 44, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 49, 44, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 44, 49, 49, 49, 49, 49, 44, 44, 44, 44, 44, 44, 49, 49, 44, 0, 44,
+    44, 49, 49, 44, 44, 49, 49, 49, 49, 49, 44, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0,
+    0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 56, 0, 0, 0, 0, 0, 53, 0, 53, 0, 0,
+    53, 53, 0, 53, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 44, 49, 49, 49,
+    49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 0, 1, 44, 44, 44, 44, 44, 49, 49, 44, 44, 44, 44,
+    49, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 49, 49, 0, 0, 0, 0, 0, 0,
+    49, 49, 44, 49, 49, 49, 49, 49, 49, 49, 44, 49, 49, 52, 41, 44, 40, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 50, 48, 48, 44, 43, 49, 51, 44, 49, 44,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 53, 0, 0, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 0, 0, 0, 0, 0,
+    53, 53, 53, 53, 53, 53, 0, 0, 53, 53, 53, 53, 53, 53, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 0, 53, 0, 53, 0, 53, 0, 53,
+    53, 54, 53, 54, 53, 54, 53, 54, 53, 54, 53, 54, 53, 54, 0, 0, 53, 53, 53, 53, 53, 0, 53, 53, 53, 53, 53, 54, 53, 0, 54, 0,
+    0, 53, 53, 53, 53, 0, 53, 53, 53, 54, 53, 54, 53, 53, 53, 53, 53, 53, 53, 54, 0, 0, 53, 53, 53, 53, 53, 54, 0, 53, 53, 53,
+    53, 53, 53, 54, 53, 53, 53, 53, 53, 53, 53, 54, 53, 53, 54, 54, 0, 0, 53, 53, 53, 0, 53, 53, 53, 54, 53, 54, 53, 54, 0, 0,
+    54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 1, 1, 49, 49, 49, 49, 1, 1, 1, 49, 49, 0, 0, 0,
+    0, 49, 0, 0, 0, 1, 1, 49, 44, 49, 1, 1, 44, 44, 44, 44, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 53, 0, 0, 53, 0, 0, 0,
+    0, 0, 0, 0, 53, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 53, 0, 0, 53, 0, 53, 0, 0, 0, 0, 0, 0,
+    53, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53, 53, 53, 0, 0, 53, 53, 0, 0, 53, 53, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 0, 0, 0, 0, 0, 0, 53, 53, 53, 53, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 48, 50, 45, 46, 46,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 0,
+    53, 0, 53, 0, 0, 53, 0, 53, 0, 53, 0, 0, 0, 0, 0, 0, 53, 53, 0, 53, 53, 0, 53, 53, 0, 53, 53, 0, 53, 53, 0, 0,
+    0, 0, 0, 0, 53, 0, 0, 0, 0, 59, 59, 0, 0, 0, 53, 0, 0, 0, 0, 0, 53, 0, 0, 53, 53, 53, 53, 0, 0, 0, 53, 0,
+    0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49,
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 49, 49, 44, 0, 0, 49, 49, 0, 0, 0, 0, 0, 49, 49,
+    0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 54, 0, 54, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0,
+    54, 0, 54, 0, 0, 54, 54, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 21, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 54, 0, 54, 0, 54, 54, 0, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0,
+    49, 49, 49, 49, 49, 49, 49, 44, 44, 44, 44, 44, 44, 44, 49, 49, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 49,
+    0, 0, 0, 0, 0, 0, 0, 0, 49, 1, 44, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 49, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 44, 44, 49, 49, 49, 44, 49, 44, 44, 44, 0, 0, 49, 44, 49, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 53, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 58, 0, 0, 0, 0, 0,
+    49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 53, 53,
+    0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 56, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0,
+    49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 53, 53, 56, 53, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 0, 0, 0, 4,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0,
+    56, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 42, 42, 1, 1, 1, 0, 0, 0, 47, 42, 42,
+    42, 42, 42, 0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44, 44, 44, 44, 0, 0, 49, 49, 49, 49, 49, 44, 44, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54,
+    54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    49, 49, 49, 49, 49, 49, 49, 0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 49, 49, 49, 49, 49,
+    49, 49, 0, 49, 49, 0, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49,
+    44, 44, 44, 44, 44, 44, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 3, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t KS_NormalizationProperties[67] = {
+    0, 1, 6, 7, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+    84, 103, 107, 118, 122, 129, 130, 132, 202, 214, 216, 218, 220, 222, 224, 226,
+    228, 230, 232, 233, 234, 256, 768, 998, 1024, 1025, 1031, 1032, 1033, 1115, 1226, 1240,
+    1244, 1254, 1264,
+};
+
+#define KSTRING_DECOMPOSITION_MAX_LENGTH 4
+
+static const uint32_t KS_DecompositionCodePoints[2061] = {
+    192, 193, 194, 195, 196, 197, 199, 200, 201, 202, 203, 204,
+    205, 206, 207, 209, 210, 211, 212, 213, 214, 217, 218, 219,
+    220, 221, 224, 225, 226, 227, 228, 229, 231, 232, 233, 234,
+    235, 236, 237, 238, 239, 241, 242, 243, 244, 245, 246, 249,
+    250, 251, 252, 253, 255, 256, 257, 258, 259, 260, 261, 262,
+    263, 264, 265, 266, 267, 268, 269, 270, 271, 274, 275, 276,
+    277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288,
+    289, 290, 291, 292, 293, 296, 297, 298, 299, 300, 301, 302,
+    303, 304, 308, 309, 310, 311, 313, 314, 315, 316, 317, 318,
+    323, 324, 325, 326, 327, 328, 332, 333, 334, 335, 336, 337,
+    340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351,
+    352, 353, 354, 355, 356, 357, 360, 361, 362, 363, 364, 365,
+    366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377,
+    378, 379, 380, 381, 382, 416, 417, 431, 432, 461, 462, 463,
+    464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475,
+    476, 478, 479, 480, 481, 482, 483, 486, 487, 488, 489, 490,
+    491, 492, 493, 494, 495, 496, 500, 501, 504, 505, 506, 507,
+    508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519,
+    520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 542, 543, 550, 551,
+    552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563,
+    832, 833, 835, 836, 884, 894, 901, 902, 903, 904, 905, 906,
+    908, 910, 911, 912, 938, 939, 940, 941, 942, 943, 944, 970,
+    971, 972, 973, 974, 979, 980, 1024, 1025, 1027, 1031, 1036, 1037,
+    1038, 1049, 1081, 1104, 1105, 1107, 1111, 1116, 1117, 1118, 1142, 1143,
+    1217, 1218, 1232, 1233, 1234, 1235, 1238, 1239, 1242, 1243, 1244, 1245,
+    1246, 1247, 1250, 1251, 1252, 1253, 1254, 1255, 1258, 1259, 1260, 1261,
+    1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1272, 1273, 1570, 1571,
+    1572, 1573, 1574, 1728, 1730, 1747, 2345, 2353, 2356, 2392, 2393, 2394,
+    2395, 2396, 2397, 2398, 2399, 2507, 2508, 2524, 2525, 2527, 2611, 2614,
+    2649, 2650, 2651, 2654, 2888, 2891, 2892, 2908, 2909, 2964, 3018, 3019,
+    3020, 3144, 3264, 3271, 3272, 3274, 3275, 3402, 3403, 3404, 3546, 3548,
+    3549, 3550, 3907, 3917, 3922, 3927, 3932, 3945, 3955, 3957, 3958, 3960,
+    3969, 3987, 3997, 4002, 4007, 4012, 4025, 4134, 6918, 6920, 6922, 6924,
+    6926, 6930, 6971, 6973, 6976, 6977, 6979, 7680, 7681, 7682, 7683, 7684,
+    7685, 7686, 7687, 7688, 7689, 7690, 7691, 7692, 7693, 7694, 7695, 7696,
+    7697, 7698, 7699, 7700, 7701, 7702, 7703, 7704, 7705, 7706, 7707, 7708,
+    7709, 7710, 7711, 7712, 7713, 7714, 7715, 7716, 7717, 7718, 7719, 7720,
+    7721, 7722, 7723, 7724, 7725, 7726, 7727, 7728, 7729, 7730, 7731, 7732,
+    7733, 7734, 7735, 7736, 7737, 7738, 7739, 7740, 7741, 7742, 7743, 7744,
+    7745, 7746, 7747, 7748, 7749, 7750, 7751, 7752, 7753, 7754, 7755, 7756,
+    7757, 7758, 7759, 7760, 7761, 7762, 7763, 7764, 7765, 7766, 7767, 7768,
+    7769, 7770, 7771, 7772, 7773, 7774, 7775, 7776, 7777, 7778, 7779, 7780,
+    7781, 7782, 7783, 7784, 7785, 7786, 7787, 7788, 7789, 7790, 7791, 7792,
+    7793, 7794, 7795, 7796, 7797, 7798, 7799, 7800, 7801, 7802, 7803, 7804,
+    7805, 7806, 7807, 7808, 7809, 7810, 7811, 7812, 7813, 7814, 7815, 7816,
+    7817, 7818, 7819, 7820, 7821, 7822, 7823, 7824, 7825, 7826, 7827, 7828,
+    7829, 7830, 7831, 7832, 7833, 7835, 7840, 7841, 7842, 7843, 7844, 7845,
+    7846, 7847, 7848, 7849, 7850, 7851, 7852, 7853, 7854, 7855, 7856, 7857,
+    7858, 7859, 7860, 7861, 7862, 7863, 7864, 7865, 7866, 7867, 7868, 7869,
+    7870, 7871, 7872, 7873, 7874, 7875, 7876, 7877, 7878, 7879, 7880, 7881,
+    7882, 7883, 7884, 7885, 7886, 7887, 7888, 7889, 7890, 7891, 7892, 7893,
+    7894, 7895, 7896, 7897, 7898, 7899, 7900, 7901, 7902, 7903, 7904, 7905,
+    7906, 7907, 7908, 7909, 7910, 7911, 7912, 7913, 7914, 7915, 7916, 7917,
+    7918, 7919, 7920, 7921, 7922, 7923, 7924, 7925, 7926, 7927, 7928, 7929,
+    7936, 7937, 7938, 7939, 7940, 7941, 7942, 7943, 7944, 7945, 7946, 7947,
+    7948, 7949, 7950, 7951, 7952, 7953, 7954, 7955, 7956, 7957, 7960, 7961,
+    7962, 7963, 7964, 7965, 7968, 7969, 7970, 7971, 7972, 7973, 7974, 7975,
+    7976, 7977, 7978, 7979, 7980, 7981, 7982, 7983, 7984, 7985, 7986, 7987,
+    7988, 7989, 7990, 7991, 7992, 7993, 7994, 7995, 7996, 7997, 7998, 7999,
+    8000, 8001, 8002, 8003, 8004, 8005, 8008, 8009, 8010, 8011, 8012, 8013,
+    8016, 8017, 8018, 8019, 8020, 8021, 8022, 8023, 8025, 8027, 8029, 8031,
+    8032, 8033, 8034, 8035, 8036, 8037, 8038, 8039, 8040, 8041, 8042, 8043,
+    8044, 8045, 8046, 8047, 8048, 8049, 8050, 8051, 8052, 8053, 8054, 8055,
+    8056, 8057, 8058, 8059, 8060, 8061, 8064, 8065, 8066, 8067, 8068, 8069,
+    8070, 8071, 8072, 8073, 8074, 8075, 8076, 8077, 8078, 8079, 8080, 8081,
+    8082, 8083, 8084, 8085, 8086, 8087, 8088, 8089, 8090, 8091, 8092, 8093,
+    8094, 8095, 8096, 8097, 8098, 8099, 8100, 8101, 8102, 8103, 8104, 8105,
+    8106, 8107, 8108, 8109, 8110, 8111, 8112, 8113, 8114, 8115, 8116, 8118,
+    8119, 8120, 8121, 8122, 8123, 8124, 8126, 8129, 8130, 8131, 8132, 8134,
+    8135, 8136, 8137, 8138, 8139, 8140, 8141, 8142, 8143, 8144, 8145, 8146,
+    8147, 8150, 8151, 8152, 8153, 8154, 8155, 8157, 8158, 8159, 8160, 8161,
+    8162, 8163, 8164, 8165, 8166, 8167, 8168, 8169, 8170, 8171, 8172, 8173,
+    8174, 8175, 8178, 8179, 8180, 8182, 8183, 8184, 8185, 8186, 8187, 8188,
+    8189, 8192, 8193, 8486, 8490, 8491, 8602, 8603, 8622, 8653, 8654, 8655,
+    8708, 8713, 8716, 8740, 8742, 8769, 8772, 8775, 8777, 8800, 8802, 8813,
+    8814, 8815, 8816, 8817, 8820, 8821, 8824, 8825, 8832, 8833, 8836, 8837,
+    8840, 8841, 8876, 8877, 8878, 8879, 8928, 8929, 8930, 8931, 8938, 8939,
+    8940, 8941, 9001, 9002, 10972, 12364, 12366, 12368, 12370, 12372, 12374, 12376,
+    12378, 12380, 12382, 12384, 12386, 12389, 12391, 12393, 12400, 12401, 12403, 12404,
+    12406, 12407, 12409, 12410, 12412, 12413, 12436, 12446, 12460, 12462, 12464, 12466,
+    12468, 12470, 12472, 12474, 12476, 12478, 12480, 12482, 12485, 12487, 12489, 12496,
+    12497, 12499, 12500, 12502, 12503, 12505, 12506, 12508, 12509, 12532, 12535, 12536,
+    12537, 12538, 12542, 63744, 63745, 63746, 63747, 63748, 63749, 63750, 63751, 63752,
+    63753, 63754, 63755, 63756, 63757, 63758, 63759, 63760, 63761, 63762, 63763, 63764,
+    63765, 63766, 63767, 63768, 63769, 63770, 63771, 63772, 63773, 63774, 63775, 63776,
+    63777, 63778, 63779, 63780, 63781, 63782, 63783, 63784, 63785, 63786, 63787, 63788,
+    63789, 63790, 63791, 63792, 63793, 63794, 63795, 63796, 63797, 63798, 63799, 63800,
+    63801, 63802, 63803, 63804, 63805, 63806, 63807, 63808, 63809, 63810, 63811, 63812,
+    63813, 63814, 63815, 63816, 63817, 63818, 63819, 63820, 63821, 63822, 63823, 63824,
+    63825, 63826, 63827, 63828, 63829, 63830, 63831, 63832, 63833, 63834, 63835, 63836,
+    63837, 63838, 63839, 63840, 63841, 63842, 63843, 63844, 63845, 63846, 63847, 63848,
+    63849, 63850, 63851, 63852, 63853, 63854, 63855, 63856, 63857, 63858, 63859, 63860,
+    63861, 63862, 63863, 63864, 63865, 63866, 63867, 63868, 63869, 63870, 63871, 63872,
+    63873, 63874, 63875, 63876, 63877, 63878, 63879, 63880, 63881, 63882, 63883, 63884,
+    63885, 63886, 63887, 63888, 63889, 63890, 63891, 63892, 63893, 63894, 63895, 63896,
+    63897, 63898, 63899, 63900, 63901, 63902, 63903, 63904, 63905, 63906, 63907, 63908,
+    63909, 63910, 63911, 63912, 63913, 63914, 63915, 63916, 63917, 63918, 63919, 63920,
+    63921, 63922, 63923, 63924, 63925, 63926, 63927, 63928, 63929, 63930, 63931, 63932,
+    63933, 63934, 63935, 63936, 63937, 63938, 63939, 63940, 63941, 63942, 63943, 63944,
+    63945, 63946, 63947, 63948, 63949, 63950, 63951, 63952, 63953, 63954, 63955, 63956,
+    63957, 63958, 63959, 63960, 63961, 63962, 63963, 63964, 63965, 63966, 63967, 63968,
+    63969, 63970, 63971, 63972, 63973, 63974, 63975, 63976, 63977, 63978, 63979, 63980,
+    63981, 63982, 63983, 63984, 63985, 63986, 63987, 63988, 63989, 63990, 63991, 63992,
+    63993, 63994, 63995, 63996, 63997, 63998, 63999, 64000, 64001, 64002, 64003, 64004,
+    64005, 64006, 64007, 64008, 64009, 64010, 64011, 64012, 64013, 64016, 64018, 64021,
+    64022, 64023, 64024, 64025, 64026, 64027, 64028, 64029, 64030, 64032, 64034, 64037,
+    64038, 64042, 64043, 64044, 64045, 64046, 64047, 64048, 64049, 64050, 64051, 64052,
+    64053, 64054, 64055, 64056, 64057, 64058, 64059, 64060, 64061, 64062, 64063, 64064,
+    64065, 64066, 64067, 64068, 64069, 64070, 64071, 64072, 64073, 64074, 64075, 64076,
+    64077, 64078, 64079, 64080, 64081, 64082, 64083, 64084, 64085, 64086, 64087, 64088,
+    64089, 64090, 64091, 64092, 64093, 64094, 64095, 64096, 64097, 64098, 64099, 64100,
+    64101, 64102, 64103, 64104, 64105, 64106, 64107, 64108, 64109, 64112, 64113, 64114,
+    64115, 64116, 64117, 64118, 64119, 64120, 64121, 64122, 64123, 64124, 64125, 64126,
+    64127, 64128, 64129, 64130, 64131, 64132, 64133, 64134, 64135, 64136, 64137, 64138,
+    64139, 64140, 64141, 64142, 64143, 64144, 64145, 64146, 64147, 64148, 64149, 64150,
+    64151, 64152, 64153, 64154, 64155, 64156, 64157, 64158, 64159, 64160, 64161, 64162,
+    64163, 64164, 64165, 64166, 64167, 64168, 64169, 64170, 64171, 64172, 64173, 64174,
+    64175, 64176, 64177, 64178, 64179, 64180, 64181, 64182, 64183, 64184, 64185, 64186,
+    64187, 64188, 64189, 64190, 64191, 64192, 64193, 64194, 64195, 64196, 64197, 64198,
+    64199, 64200, 64201, 64202, 64203, 64204, 64205, 64206, 64207, 64208, 64209, 64210,
+    64211, 64212, 64213, 64214, 64215, 64216, 64217, 64285, 64287, 64298, 64299, 64300,
+    64301, 64302, 64303, 64304, 64305, 64306, 64307, 64308, 64309, 64310, 64312, 64313,
+    64314, 64315, 64316, 64318, 64320, 64321, 64323, 64324, 64326, 64327, 64328, 64329,
+    64330, 64331, 64332, 64333, 64334, 69786, 69788, 69803, 69934, 69935, 70475, 70476,
+    70843, 70844, 70846, 71098, 71099, 71992, 119134, 119135, 119136, 119137, 119138, 119139,
+    119140, 119227, 119228, 119229, 119230, 119231, 119232, 194560, 194561, 194562, 194563, 194564,
+    194565, 194566, 194567, 194568, 194569, 194570, 194571, 194572, 194573, 194574, 194575, 194576,
+    194577, 194578, 194579, 194580, 194581, 194582, 194583, 194584, 194585, 194586, 194587, 194588,
+    194589, 194590, 194591, 194592, 194593, 194594, 194595, 194596, 194597, 194598, 194599, 194600,
+    194601, 194602, 194603, 194604, 194605, 194606, 194607, 194608, 194609, 194610, 194611, 194612,
+    194613, 194614, 194615, 194616, 194617, 194618, 194619, 194620, 194621, 194622, 194623, 194624,
+    194625, 194626, 194627, 194628, 194629, 194630, 194631, 194632, 194633, 194634, 194635, 194636,
+    194637, 194638, 194639, 194640, 194641, 194642, 194643, 194644, 194645, 194646, 194647, 194648,
+    194649, 194650, 194651, 194652, 194653, 194654, 194655, 194656, 194657, 194658, 194659, 194660,
+    194661, 194662, 194663, 194664, 194665, 194666, 194667, 194668, 194669, 194670, 194671, 194672,
+    194673, 194674, 194675, 194676, 194677, 194678, 194679, 194680, 194681, 194682, 194683, 194684,
+    194685, 194686, 194687, 194688, 194689, 194690, 194691, 194692, 194693, 194694, 194695, 194696,
+    194697, 194698, 194699, 194700, 194701, 194702, 194703, 194704, 194705, 194706, 194707, 194708,
+    194709, 194710, 194711, 194712, 194713, 194714, 194715, 194716, 194717, 194718, 194719, 194720,
+    194721, 194722, 194723, 194724, 194725, 194726, 194727, 194728, 194729, 194730, 194731, 194732,
+    194733, 194734, 194735, 194736, 194737, 194738, 194739, 194740, 194741, 194742, 194743, 194744,
+    194745, 194746, 194747, 194748, 194749, 194750, 194751, 194752, 194753, 194754, 194755, 194756,
+    194757, 194758, 194759, 194760, 194761, 194762, 194763, 194764, 194765, 194766, 194767, 194768,
+    194769, 194770, 194771, 194772, 194773, 194774, 194775, 194776, 194777, 194778, 194779, 194780,
+    194781, 194782, 194783, 194784, 194785, 194786, 194787, 194788, 194789, 194790, 194791, 194792,
+    194793, 194794, 194795, 194796, 194797, 194798, 194799, 194800, 194801, 194802, 194803, 194804,
+    194805, 194806, 194807, 194808, 194809, 194810, 194811, 194812, 194813, 194814, 194815, 194816,
+    194817, 194818, 194819, 194820, 194821, 194822, 194823, 194824, 194825, 194826, 194827, 194828,
+    194829, 194830, 194831, 194832, 194833, 194834, 194835, 194836, 194837, 194838, 194839, 194840,
+    194841, 194842, 194843, 194844, 194845, 194846, 194847, 194848, 194849, 194850, 194851, 194852,
+    194853, 194854, 194855, 194856, 194857, 194858, 194859, 194860, 194861, 194862, 194863, 194864,
+    194865, 194866, 194867, 194868, 194869, 194870, 194871, 194872, 194873, 194874, 194875, 194876,
+    194877, 194878, 194879, 194880, 194881, 194882, 194883, 194884, 194885, 194886, 194887, 194888,
+    194889, 194890, 194891, 194892, 194893, 194894, 194895, 194896, 194897, 194898, 194899, 194900,
+    194901, 194902, 194903, 194904, 194905, 194906, 194907, 194908, 194909, 194910, 194911, 194912,
+    194913, 194914, 194915, 194916, 194917, 194918, 194919, 194920, 194921, 194922, 194923, 194924,
+    194925, 194926, 194927, 194928, 194929, 194930, 194931, 194932, 194933, 194934, 194935, 194936,
+    194937, 194938, 194939, 194940, 194941, 194942, 194943, 194944, 194945, 194946, 194947, 194948,
+    194949, 194950, 194951, 194952, 194953, 194954, 194955, 194956, 194957, 194958, 194959, 194960,
+    194961, 194962, 194963, 194964, 194965, 194966, 194967, 194968, 194969, 194970, 194971, 194972,
+    194973, 194974, 194975, 194976, 194977, 194978, 194979, 194980, 194981, 194982, 194983, 194984,
+    194985, 194986, 194987, 194988, 194989, 194990, 194991, 194992, 194993, 194994, 194995, 194996,
+    194997, 194998, 194999, 195000, 195001, 195002, 195003, 195004, 195005, 195006, 195007, 195008,
+    195009, 195010, 195011, 195012, 195013, 195014, 195015, 195016, 195017, 195018, 195019, 195020,
+    195021, 195022, 195023, 195024, 195025, 195026, 195027, 195028, 195029, 195030, 195031, 195032,
+    195033, 195034, 195035, 195036, 195037, 195038, 195039, 195040, 195041, 195042, 195043, 195044,
+    195045, 195046, 195047, 195048, 195049, 195050, 195051, 195052, 195053, 195054, 195055, 195056,
+    195057, 195058, 195059, 195060, 195061, 195062, 195063, 195064, 195065, 195066, 195067, 195068,
+    195069, 195070, 195071, 195072, 195073, 195074, 195075, 195076, 195077, 195078, 195079, 195080,
+    195081, 195082, 195083, 195084, 195085, 195086, 195087, 195088, 195089, 195090, 195091, 195092,
+    195093, 195094, 195095, 195096, 195097, 195098, 195099, 195100, 195101,
+};
+
+static const uint16_t KS_DecompositionOffsets[2062] = {
+    0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30,
+    32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62,
+    64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 88, 90, 92, 94,
+    96, 98, 100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124, 126,
+    128, 130, 132, 134, 136, 138, 140, 142, 144, 146, 148, 150, 152, 154, 156, 158,
+    160, 162, 164, 166, 168, 170, 172, 174, 176, 178, 180, 182, 184, 186, 188, 190,
+    192, 194, 196, 198, 200, 202, 204, 206, 208, 210, 212, 214, 216, 218, 220, 222,
+    224, 226, 228, 230, 232, 234, 236, 238, 240, 242, 244, 246, 248, 250, 252, 254,
+    256, 258, 260, 262, 264, 266, 268, 270, 272, 274, 276, 278, 280, 282, 284, 286,
+    288, 290, 292, 294, 296, 298, 300, 302, 304, 306, 308, 310, 312, 314, 316, 318,
+    320, 322, 324, 326, 328, 330, 332, 334, 336, 338, 340, 342, 344, 346, 349, 352,
+    355, 358, 361, 364, 367, 370, 373, 376, 379, 382, 384, 386, 388, 390, 392, 394,
+    396, 398, 401, 404, 406, 408, 410, 412, 414, 416, 418, 421, 424, 426, 428, 430,
+    432, 434, 436, 438, 440, 442, 444, 446, 448, 450, 452, 454, 456, 458, 460, 462,
+    464, 466, 468, 470, 472, 474, 476, 478, 480, 482, 484, 486, 488, 490, 492, 494,
+    496, 498, 500, 503, 506, 509, 512, 514, 516, 519, 522, 524, 526, 527, 528, 529,
+    531, 532, 533, 535, 537, 538, 540, 542, 544, 546, 548, 550, 553, 555, 557, 559,
+    561, 563, 565, 568, 570, 572, 574, 576, 578, 580, 582, 584, 586, 588, 590, 592,
+    594, 596, 598, 600, 602, 604, 606, 608, 610, 612, 614, 616, 618, 620, 622, 624,
+    626, 628, 630, 632, 634, 636, 638, 640, 642, 644, 646, 648, 650, 652, 654, 656,
+    658, 660, 662, 664, 666, 668, 670, 672, 674, 676, 678, 680, 682, 684, 686, 688,
+    690, 692, 694, 696, 698, 700, 702, 704, 706, 708, 710, 712, 714, 716, 718, 720,
+    722, 724, 726, 728, 730, 732, 734, 736, 738, 740, 742, 744, 746, 748, 750, 752,
+    754, 756, 758, 760, 762, 764, 766, 768, 770, 772, 774, 777, 779, 781, 783, 785,
+    787, 790, 792, 794, 796, 798, 800, 802, 804, 806, 808, 810, 812, 814, 816, 818,
+    820, 822, 824, 826, 828, 830, 832, 834, 836, 838, 840, 842, 844, 846, 848, 850,
+    852, 854, 856, 858, 860, 862, 864, 866, 869, 872, 874, 876, 878, 880, 882, 884,
+    886, 888, 890, 892, 895, 898, 901, 904, 906, 908, 910, 912, 915, 918, 920, 922,
+    924, 926, 928, 930, 932, 934, 936, 938, 940, 942, 944, 946, 948, 950, 953, 956,
+    958, 960, 962, 964, 966, 968, 970, 972, 975, 978, 980, 982, 984, 986, 988, 990,
+    992, 994, 996, 998, 1000, 1002, 1004, 1006, 1008, 1010, 1012, 1014, 1017, 1020, 1023, 1026,
+    1029, 1032, 1035, 1038, 1040, 1042, 1044, 1046, 1048, 1050, 1052, 1054, 1057, 1060, 1062, 1064,
+    1066, 1068, 1070, 1072, 1075, 1078, 1081, 1084, 1087, 1090, 1092, 1094, 1096, 1098, 1100, 1102,
+    1104, 1106, 1108, 1110, 1112, 1114, 1116, 1118, 1121, 1124, 1127, 1130, 1132, 1134, 1136, 1138,
+    1140, 1142, 1144, 1146, 1148, 1150, 1152, 1154, 1156, 1158, 1160, 1162, 1164, 1166, 1168, 1170,
+    1172, 1174, 1176, 1178, 1180, 1182, 1184, 1186, 1188, 1190, 1192, 1194, 1196, 1198, 1200, 1203,
+    1206, 1209, 1212, 1215, 1218, 1221, 1224, 1227, 1230, 1233, 1236, 1239, 1242, 1245, 1248, 1251,
+    1254, 1257, 1260, 1262, 1264, 1266, 1268, 1270, 1272, 1275, 1278, 1281, 1284, 1287, 1290, 1293,
+    1296, 1299, 1302, 1304, 1306, 1308, 1310, 1312, 1314, 1316, 1318, 1321, 1324, 1327, 1330, 1333,
+    1336, 1339, 1342, 1345, 1348, 1351, 1354, 1357, 1360, 1363, 1366, 1369, 1372, 1375, 1378, 1380,
+    1382, 1384, 1386, 1389, 1392, 1395, 1398, 1401, 1404, 1407, 1410, 1413, 1416, 1418, 1420, 1422,
+    1424, 1426, 1428, 1430, 1432, 1434, 1436, 1439, 1442, 1445, 1448, 1451, 1454, 1456, 1458, 1461,
+    1464, 1467, 1470, 1473, 1476, 1478, 1480, 1483, 1486, 1489, 1492, 1494, 1496, 1499, 1502, 1505,
+    1508, 1510, 1512, 1515, 1518, 1521, 1524, 1527, 1530, 1532, 1534, 1537, 1540, 1543, 1546, 1549,
+    1552, 1554, 1556, 1559, 1562, 1565, 1568, 1571, 1574, 1576, 1578, 1581, 1584, 1587, 1590, 1593,
+    1596, 1598, 1600, 1603, 1606, 1609, 1612, 1614, 1616, 1619, 1622, 1625, 1628, 1630, 1632, 1635,
+    1638, 1641, 1644, 1647, 1650, 1652, 1655, 1658, 1661, 1663, 1665, 1668, 1671, 1674, 1677, 1680,
+    1683, 1685, 1687, 1690, 1693, 1696, 1699, 1702, 1705, 1707, 1709, 1711, 1713, 1715, 1717, 1719,
+    1721, 1723, 1725, 1727, 1729, 1731, 1733, 1736, 1739, 1743, 1747, 1751, 1755, 1759, 1763, 1766,
+    1769, 1773, 1777, 1781, 1785, 1789, 1793, 1796, 1799, 1803, 1807, 1811, 1815, 1819, 1823, 1826,
+    1829, 1833, 1837, 1841, 1845, 1849, 1853, 1856, 1859, 1863, 1867, 1871, 1875, 1879, 1883, 1886,
+    1889, 1893, 1897, 1901, 1905, 1909, 1913, 1915, 1917, 1920, 1922, 1925, 1927, 1930, 1932, 1934,
+    1936, 1938, 1940, 1941, 1943, 1946, 1948, 1951, 1953, 1956, 1958, 1960, 1962, 1964, 1966, 1968,
+    1970, 1972, 1974, 1976, 1979, 1982, 1984, 1987, 1989, 1991, 1993, 1995, 1997, 1999, 2001, 2003,
+    2005, 2008, 2011, 2013, 2015, 2017, 2020, 2022, 2024, 2026, 2028, 2030, 2032, 2034, 2035, 2038,
+    2040, 2043, 2045, 2048, 2050, 2052, 2054, 2056, 2058, 2059, 2060, 2061, 2062, 2063, 2065, 2067,
+    2069, 2071, 2073, 2075, 2077, 2079, 2081, 2083, 2085, 2087, 2089, 2091, 2093, 2095, 2097, 2099,
+    2101, 2103, 2105, 2107, 2109, 2111, 2113, 2115, 2117, 2119, 2121, 2123, 2125, 2127, 2129, 2131,
+    2133, 2135, 2137, 2139, 2141, 2143, 2145, 2147, 2149, 2151, 2153, 2154, 2155, 2157, 2159, 2161,
+    2163, 2165, 2167, 2169, 2171, 2173, 2175, 2177, 2179, 2181, 2183, 2185, 2187, 2189, 2191, 2193,
+    2195, 2197, 2199, 2201, 2203, 2205, 2207, 2209, 2211, 2213, 2215, 2217, 2219, 2221, 2223, 2225,
+    2227, 2229, 2231, 2233, 2235, 2237, 2239, 2241, 2243, 2245, 2247, 2249, 2251, 2253, 2255, 2257,
+    2259, 2261, 2263, 2265, 2267, 2269, 2271, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281,
+    2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297,
+    2298, 2299, 2300, 2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313,
+    2314, 2315, 2316, 2317, 2318, 2319, 2320, 2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329,
+    2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345,
+    2346, 2347, 2348, 2349, 2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361,
+    2362, 2363, 2364, 2365, 2366, 2367, 2368, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377,
+    2378, 2379, 2380, 2381, 2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393,
+    2394, 2395, 2396, 2397, 2398, 2399, 2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409,
+    2410, 2411, 2412, 2413, 2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425,
+    2426, 2427, 2428, 2429, 2430, 2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441,
+    2442, 2443, 2444, 2445, 2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457,
+    2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473,
+    2474, 2475, 2476, 2477, 2478, 2479, 2480, 2481, 2482, 2483, 2484, 2485, 2486, 2487, 2488, 2489,
+    2490, 2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505,
+    2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520, 2521,
+    2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533, 2534, 2535, 2536, 2537,
+    2538, 2539, 2540, 2541, 2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553,
+    2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569,
+    2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584, 2585,
+    2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597, 2598, 2599, 2600, 2601,
+    2602, 2603, 2604, 2605, 2606, 2607, 2608, 2609, 2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617,
+    2618, 2619, 2620, 2621, 2622, 2623, 2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633,
+    2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643, 2644, 2645, 2646, 2647, 2648, 2649,
+    2650, 2651, 2652, 2653, 2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665,
+    2666, 2667, 2668, 2669, 2670, 2671, 2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681,
+    2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691, 2692, 2693, 2694, 2695, 2696, 2697,
+    2698, 2699, 2700, 2701, 2702, 2703, 2704, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713,
+    2714, 2715, 2716, 2717, 2718, 2719, 2720, 2721, 2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729,
+    2730, 2731, 2732, 2733, 2735, 2737, 2739, 2741, 2744, 2747, 2749, 2751, 2753, 2755, 2757, 2759,
+    2761, 2763, 2765, 2767, 2769, 2771, 2773, 2775, 2777, 2779, 2781, 2783, 2785, 2787, 2789, 2791,
+    2793, 2795, 2797, 2799, 2801, 2803, 2805, 2807, 2809, 2811, 2813, 2815, 2817, 2819, 2821, 2823,
+    2825, 2827, 2829, 2831, 2833, 2836, 2839, 2842, 2845, 2848, 2850, 2852, 2855, 2858, 2861, 2864,
+    2865, 2866, 2867, 2868, 2869, 2870, 2871, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 2879, 2880,
+    2881, 2882, 2883, 2884, 2885, 2886, 2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894, 2895, 2896,
+    2897, 2898, 2899, 2900, 2901, 2902, 2903, 2904, 2905, 2906, 2907, 2908, 2909, 2910, 2911, 2912,
+    2913, 2914, 2915, 2916, 2917, 2918, 2919, 2920, 2921, 2922, 2923, 2924, 2925, 2926, 2927, 2928,
+    2929, 2930, 2931, 2932, 2933, 2934, 2935, 2936, 2937, 2938, 2939, 2940, 2941, 2942, 2943, 2944,
+    2945, 2946, 2947, 2948, 2949, 2950, 2951, 2952, 2953, 2954, 2955, 2956, 2957, 2958, 2959, 2960,
+    2961, 2962, 2963, 2964, 2965, 2966, 2967, 2968, 2969, 2970, 2971, 2972, 2973, 2974, 2975, 2976,
+    2977, 2978, 2979, 2980, 2981, 2982, 2983, 2984, 2985, 2986, 2987, 2988, 2989, 2990, 2991, 2992,
+    2993, 2994, 2995, 2996, 2997, 2998, 2999, 3000, 3001, 3002, 3003, 3004, 3005, 3006, 3007, 3008,
+    3009, 3010, 3011, 3012, 3013, 3014, 3015, 3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024,
+    3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032, 3033, 3034, 3035, 3036, 3037, 3038, 3039, 3040,
+    3041, 3042, 3043, 3044, 3045, 3046, 3047, 3048, 3049, 3050, 3051, 3052, 3053, 3054, 3055, 3056,
+    3057, 3058, 3059, 3060, 3061, 3062, 3063, 3064, 3065, 3066, 3067, 3068, 3069, 3070, 3071, 3072,
+    3073, 3074, 3075, 3076, 3077, 3078, 3079, 3080, 3081, 3082, 3083, 3084, 3085, 3086, 3087, 3088,
+    3089, 3090, 3091, 3092, 3093, 3094, 3095, 3096, 3097, 3098, 3099, 3100, 3101, 3102, 3103, 3104,
+    3105, 3106, 3107, 3108, 3109, 3110, 3111, 3112, 3113, 3114, 3115, 3116, 3117, 3118, 3119, 3120,
+    3121, 3122, 3123, 3124, 3125, 3126, 3127, 3128, 3129, 3130, 3131, 3132, 3133, 3134, 3135, 3136,
+    3137, 3138, 3139, 3140, 3141, 3142, 3143, 3144, 3145, 3146, 3147, 3148, 3149, 3150, 3151, 3152,
+    3153, 3154, 3155, 3156, 3157, 3158, 3159, 3160, 3161, 3162, 3163, 3164, 3165, 3166, 3167, 3168,
+    3169, 3170, 3171, 3172, 3173, 3174, 3175, 3176, 3177, 3178, 3179, 3180, 3181, 3182, 3183, 3184,
+    3185, 3186, 3187, 3188, 3189, 3190, 3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200,
+    3201, 3202, 3203, 3204, 3205, 3206, 3207, 3208, 3209, 3210, 3211, 3212, 3213, 3214, 3215, 3216,
+    3217, 3218, 3219, 3220, 3221, 3222, 3223, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 3231, 3232,
+    3233, 3234, 3235, 3236, 3237, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3245, 3246, 3247, 3248,
+    3249, 3250, 3251, 3252, 3253, 3254, 3255, 3256, 3257, 3258, 3259, 3260, 3261, 3262, 3263, 3264,
+    3265, 3266, 3267, 3268, 3269, 3270, 3271, 3272, 3273, 3274, 3275, 3276, 3277, 3278, 3279, 3280,
+    3281, 3282, 3283, 3284, 3285, 3286, 3287, 3288, 3289, 3290, 3291, 3292, 3293, 3294, 3295, 3296,
+    3297, 3298, 3299, 3300, 3301, 3302, 3303, 3304, 3305, 3306, 3307, 3308, 3309, 3310, 3311, 3312,
+    3313, 3314, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3322, 3323, 3324, 3325, 3326, 3327, 3328,
+    3329, 3330, 3331, 3332, 3333, 3334, 3335, 3336, 3337, 3338, 3339, 3340, 3341, 3342, 3343, 3344,
+    3345, 3346, 3347, 3348, 3349, 3350, 3351, 3352, 3353, 3354, 3355, 3356, 3357, 3358, 3359, 3360,
+    3361, 3362, 3363, 3364, 3365, 3366, 3367, 3368, 3369, 3370, 3371, 3372, 3373, 3374, 3375, 3376,
+    3377, 3378, 3379, 3380, 3381, 3382, 3383, 3384, 3385, 3386, 3387, 3388, 3389, 3390, 3391, 3392,
+    3393, 3394, 3395, 3396, 3397, 3398, 3399, 3400, 3401, 3402, 3403, 3404, 3405, 3406,
+};
+
+static const uint32_t KS_DecompositionData[3406] = {
+    65, 768, 65, 769, 65, 770, 65, 771, 65, 776, 65, 778,
+    67, 807, 69, 768, 69, 769, 69, 770, 69, 776, 73, 768,
+    73, 769, 73, 770, 73, 776, 78, 771, 79, 768, 79, 769,
+    79, 770, 79, 771, 79, 776, 85, 768, 85, 769, 85, 770,
+    85, 776, 89, 769, 97, 768, 97, 769, 97, 770, 97, 771,
+    97, 776, 97, 778, 99, 807, 101, 768, 101, 769, 101, 770,
+    101, 776, 105, 768, 105, 769, 105, 770, 105, 776, 110, 771,
+    111, 768, 111, 769, 111, 770, 111, 771, 111, 776, 117, 768,
+    117, 769, 117, 770, 117, 776, 121, 769, 121, 776, 65, 772,
+    97, 772, 65, 774, 97, 774, 65, 808, 97, 808, 67, 769,
+    99, 769, 67, 770, 99, 770, 67, 775, 99, 775, 67, 780,
+    99, 780, 68, 780, 100, 780, 69, 772, 101, 772, 69, 774,
+    101, 774, 69, 775, 101, 775, 69, 808, 101, 808, 69, 780,
+    101, 780, 71, 770, 103, 770, 71, 774, 103, 774, 71, 775,
+    103, 775, 71, 807, 103, 807, 72, 770, 104, 770, 73, 771,
+    105, 771, 73, 772, 105, 772, 73, 774, 105, 774, 73, 808,
+    105, 808, 73, 775, 74, 770, 106, 770, 75, 807, 107, 807,
+    76, 769, 108, 769, 76, 807, 108, 807, 76, 780, 108, 780,
+    78, 769, 110, 769, 78, 807, 110, 807, 78, 780, 110, 780,
+    79, 772, 111, 772, 79, 774, 111, 774, 79, 779, 111, 779,
+    82, 769, 114, 769, 82, 807, 114, 807, 82, 780, 114, 780,
+    83, 769, 115, 769, 83, 770, 115, 770, 83, 807, 115, 807,
+    83, 780, 115, 780, 84, 807, 116, 807, 84, 780, 116, 780,
+    85, 771, 117, 771, 85, 772, 117, 772, 85, 774, 117, 774,
+    85, 778, 117, 778, 85, 779, 117, 779, 85, 808, 117, 808,
+    87, 770, 119, 770, 89, 770, 121, 770, 89, 776, 90, 769,
+    122, 769, 90, 775, 122, 775, 90, 780, 122, 780, 79, 795,
+    111, 795, 85, 795, 117, 795, 65, 780, 97, 780, 73, 780,
+    105, 780, 79, 780, 111, 780, 85, 780, 117, 780, 85, 776,
+    772, 117, 776, 772, 85, 776, 769, 117, 776, 769, 85, 776,
+    780, 117, 776, 780, 85, 776, 768, 117, 776, 768, 65, 776,
+    772, 97, 776, 772, 65, 775, 772, 97, 775, 772, 198, 772,
+    230, 772, 71, 780, 103, 780, 75, 780, 107, 780, 79, 808,
+    111, 808, 79, 808, 772, 111, 808, 772, 439, 780, 658, 780,
+    106, 780, 71, 769, 103, 769, 78, 768, 110, 768, 65, 778,
+    769, 97, 778, 769, 198, 769, 230, 769, 216, 769, 248, 769,
+    65, 783, 97, 783, 65, 785, 97, 785, 69, 783, 101, 783,
+    69, 785, 101, 785, 73, 783, 105, 783, 73, 785, 105, 785,
+    79, 783, 111, 783, 79, 785, 111, 785, 82, 783, 114, 783,
+    82, 785, 114, 785, 85, 783, 117, 783, 85, 785, 117, 785,
+    83, 806, 115, 806, 84, 806, 116, 806, 72, 780, 104, 780,
+    65, 775, 97, 775, 69, 807, 101, 807, 79, 776, 772, 111,
+    776, 772, 79, 771, 772, 111, 771, 772, 79, 775, 111, 775,
+    79, 775, 772, 111, 775, 772, 89, 772, 121, 772, 768, 769,
+    787, 776, 769, 697, 59, 168, 769, 913, 769, 183, 917, 769,
+    919, 769, 921, 769, 927, 769, 933, 769, 937, 769, 953, 776,
+    769, 921, 776, 933, 776, 945, 769, 949, 769, 951, 769, 953,
+    769, 965, 776, 769, 953, 776, 965, 776, 959, 769, 965, 769,
+    969, 769, 978, 769, 978, 776, 1045, 768, 1045, 776, 1043, 769,
+    1030, 776, 1050, 769, 1048, 768, 1059, 774, 1048, 774, 1080, 774,
+    1077, 768, 1077, 776, 1075, 769, 1110, 776, 1082, 769, 1080, 768,
+    1091, 774, 1140, 783, 1141, 783, 1046, 774, 1078, 774, 1040, 774,
+    1072, 774, 1040, 776, 1072, 776, 1045, 774, 1077, 774, 1240, 776,
+    1241, 776, 1046, 776, 1078, 776, 1047, 776, 1079, 776, 1048, 772,
+    1080, 772, 1048, 776, 1080, 776, 1054, 776, 1086, 776, 1256, 776,
+    1257, 776, 1069, 776, 1101, 776, 1059, 772, 1091, 772, 1059, 776,
+    1091, 776, 1059, 779, 1091, 779, 1063, 776, 1095, 776, 1067, 776,
+    1099, 776, 1575, 1619, 1575, 1620, 1608, 1620, 1575, 1621, 1610, 1620,
+    1749, 1620, 1729, 1620, 1746, 1620, 2344, 2364, 2352, 2364, 2355, 2364,
+    2325, 2364, 2326, 2364, 2327, 2364, 2332, 2364, 2337, 2364, 2338, 2364,
+    2347, 2364, 2351, 2364, 2503, 2494, 2503, 2519, 2465, 2492, 2466, 2492,
+    2479, 2492, 2610, 2620, 2616, 2620, 2582, 2620, 2583, 2620, 2588, 2620,
+    2603, 2620, 2887, 2902, 2887, 2878, 2887, 2903, 2849, 2876, 2850, 2876,
+    2962, 3031, 3014, 3006, 3015, 3006, 3014, 3031, 3142, 3158, 3263, 3285,
+    3270, 3285, 3270, 3286, 3270, 3266, 3270, 3266, 3285, 3398, 3390, 3399,
+    3390, 3398, 3415, 3545, 3530, 3545, 3535, 3545, 3535, 3530, 3545, 3551,
+    3906, 4023, 3916, 4023, 3921, 4023, 3926, 4023, 3931, 4023, 3904, 4021,
+    3953, 3954, 3953, 3956, 4018, 3968, 4019, 3968, 3953, 3968, 3986, 4023,
+    3996, 4023, 4001, 4023, 4006, 4023, 4011, 4023, 3984, 4021, 4133, 4142,
+    6917, 6965, 6919, 6965, 6921, 6965, 6923, 6965, 6925, 6965, 6929, 6965,
+    6970, 6965, 6972, 6965, 6974, 6965, 6975, 6965, 6978, 6965, 65, 805,
+    97, 805, 66, 775, 98, 775, 66, 803, 98, 803, 66, 817,
+    98, 817, 67, 807, 769, 99, 807, 769, 68, 775, 100, 775,
+    68, 803, 100, 803, 68, 817, 100, 817, 68, 807, 100, 807,
+    68, 813, 100, 813, 69, 772, 768, 101, 772, 768, 69, 772,
+    769, 101, 772, 769, 69, 813, 101, 813, 69, 816, 101, 816,
+    69, 807, 774, 101, 807, 774, 70, 775, 102, 775, 71, 772,
+    103, 772, 72, 775, 104, 775, 72, 803, 104, 803, 72, 776,
+    104, 776, 72, 807, 104, 807, 72, 814, 104, 814, 73, 816,
+    105, 816, 73, 776, 769, 105, 776, 769, 75, 769, 107, 769,
+    75, 803, 107, 803, 75, 817, 107, 817, 76, 803, 108, 803,
+    76, 803, 772, 108, 803, 772, 76, 817, 108, 817, 76, 813,
+    108, 813, 77, 769, 109, 769, 77, 775, 109, 775, 77, 803,
+    109, 803, 78, 775, 110, 775, 78, 803, 110, 803, 78, 817,
+    110, 817, 78, 813, 110, 813, 79, 771, 769, 111, 771, 769,
+    79, 771, 776, 111, 771, 776, 79, 772, 768, 111, 772, 768,
+    79, 772, 769, 111, 772, 769, 80, 769, 112, 769, 80, 775,
+    112, 775, 82, 775, 114, 775, 82, 803, 114, 803, 82, 803,
+    772, 114, 803, 772, 82, 817, 114, 817, 83, 775, 115, 775,
+    83, 803, 115, 803, 83, 769, 775, 115, 769, 775, 83, 780,
+    775, 115, 780, 775, 83, 803, 775, 115, 803, 775, 84, 775,
+    116, 775, 84, 803, 116, 803, 84, 817, 116, 817, 84, 813,
+    116, 813, 85, 804, 117, 804, 85, 816, 117, 816, 85, 813,
+    117, 813, 85, 771, 769, 117, 771, 769, 85, 772, 776, 117,
+    772, 776, 86, 771, 118, 771, 86, 803, 118, 803, 87, 768,
+    119, 768, 87, 769, 119, 769, 87, 776, 119, 776, 87, 775,
+    119, 775, 87, 803, 119, 803, 88, 775, 120, 775, 88, 776,
+    120, 776, 89, 775, 121, 775, 90, 770, 122, 770, 90, 803,
+    122, 803, 90, 817, 122, 817, 104, 817, 116, 776, 119, 778,
+    121, 778, 383, 775, 65, 803, 97, 803, 65, 777, 97, 777,
+    65, 770, 769, 97, 770, 769, 65, 770, 768, 97, 770, 768,
+    65, 770, 777, 97, 770, 777, 65, 770, 771, 97, 770, 771,
+    65, 803, 770, 97, 803, 770, 65, 774, 769, 97, 774, 769,
+    65, 774, 768, 97, 774, 768, 65, 774, 777, 97, 774, 777,
+    65, 774, 771, 97, 774, 771, 65, 803, 774, 97, 803, 774,
+    69, 803, 101, 803, 69, 777, 101, 777, 69, 771, 101, 771,
+    69, 770, 769, 101, 770, 769, 69, 770, 768, 101, 770, 768,
+    69, 770, 777, 101, 770, 777, 69, 770, 771, 101, 770, 771,
+    69, 803, 770, 101, 803, 770, 73, 777, 105, 777, 73, 803,
+    105, 803, 79, 803, 111, 803, 79, 777, 111, 777, 79, 770,
+    769, 111, 770, 769, 79, 770, 768, 111, 770, 768, 79, 770,
+    777, 111, 770, 777, 79, 770, 771, 111, 770, 771, 79, 803,
+    770, 111, 803, 770, 79, 795, 769, 111, 795, 769, 79, 795,
+    768, 111, 795, 768, 79, 795, 777, 111, 795, 777, 79, 795,
+    771, 111, 795, 771, 79, 795, 803, 111, 795, 803, 85, 803,
+    117, 803, 85, 777, 117, 777, 85, 795, 769, 117, 795, 769,
+    85, 795, 768, 117, 795, 768, 85, 795, 777, 117, 795, 777,
+    85, 795, 771, 117, 795, 771, 85, 795, 803, 117, 795, 803,
+    89, 768, 121, 768, 89, 803, 121, 803, 89, 777, 121, 777,
+    89, 771, 121, 771, 945, 787, 945, 788, 945, 787, 768, 945,
+    788, 768, 945, 787, 769, 945, 788, 769, 945, 787, 834, 945,
+    788, 834, 913, 787, 913, 788, 913, 787, 768, 913, 788, 768,
+    913, 787, 769, 913, 788, 769, 913, 787, 834, 913, 788, 834,
+    949, 787, 949, 788, 949, 787, 768, 949, 788, 768, 949, 787,
+    769, 949, 788, 769, 917, 787, 917, 788, 917, 787, 768, 917,
+    788, 768, 917, 787, 769, 917, 788, 769, 951, 787, 951, 788,
+    951, 787, 768, 951, 788, 768, 951, 787, 769, 951, 788, 769,
+    951, 787, 834, 951, 788, 834, 919, 787, 919, 788, 919, 787,
+    768, 919, 788, 768, 919, 787, 769, 919, 788, 769, 919, 787,
+    834, 919, 788, 834, 953, 787, 953, 788, 953, 787, 768, 953,
+    788, 768, 953, 787, 769, 953, 788, 769, 953, 787, 834, 953,
+    788, 834, 921, 787, 921, 788, 921, 787, 768, 921, 788, 768,
+    921, 787, 769, 921, 788, 769, 921, 787, 834, 921, 788, 834,
+    959, 787, 959, 788, 959, 787, 768, 959, 788, 768, 959, 787,
+    769, 959, 788, 769, 927, 787, 927, 788, 927, 787, 768, 927,
+    788, 768, 927, 787, 769, 927, 788, 769, 965, 787, 965, 788,
+    965, 787, 768, 965, 788, 768, 965, 787, 769, 965, 788, 769,
+    965, 787, 834, 965, 788, 834, 933, 788, 933, 788, 768, 933,
+    788, 769, 933, 788, 834, 969, 787, 969, 788, 969, 787, 768,
+    969, 788, 768, 969, 787, 769, 969, 788, 769, 969, 787, 834,
+    969, 788, 834, 937, 787, 937, 788, 937, 787, 768, 937, 788,
+    768, 937, 787, 769, 937, 788, 769, 937, 787, 834, 937, 788,
+    834, 945, 768, 945, 769, 949, 768, 949, 769, 951, 768, 951,
+    769, 953, 768, 953, 769, 959, 768, 959, 769, 965, 768, 965,
+    769, 969, 768, 969, 769, 945, 787, 837, 945, 788, 837, 945,
+    787, 768, 837, 945, 788, 768, 837, 945, 787, 769, 837, 945,
+    788, 769, 837, 945, 787, 834, 837, 945, 788, 834, 837, 913,
+    787, 837, 913, 788, 837, 913, 787, 768, 837, 913, 788, 768,
+    837, 913, 787, 769, 837, 913, 788, 769, 837, 913, 787, 834,
+    837, 913, 788, 834, 837, 951, 787, 837, 951, 788, 837, 951,
+    787, 768, 837, 951, 788, 768, 837, 951, 787, 769, 837, 951,
+    788, 769, 837, 951, 787, 834, 837, 951, 788, 834, 837, 919,
+    787, 837, 919, 788, 837, 919, 787, 768, 837, 919, 788, 768,
+    837, 919, 787, 769, 837, 919, 788, 769, 837, 919, 787, 834,
+    837, 919, 788, 834, 837, 969, 787, 837, 969, 788, 837, 969,
+    787, 768, 837, 969, 788, 768, 837, 969, 787, 769, 837, 969,
+    788, 769, 837, 969, 787, 834, 837, 969, 788, 834, 837, 937,
+    787, 837, 937, 788, 837, 937, 787, 768, 837, 937, 788, 768,
+    837, 937, 787, 769, 837, 937, 788, 769, 837, 937, 787, 834,
+    837, 937, 788, 834, 837, 945, 774, 945, 772, 945, 768, 837,
+    945, 837, 945, 769, 837, 945, 834, 945, 834, 837, 913, 774,
+    913, 772, 913, 768, 913, 769, 913, 837, 953, 168, 834, 951,
+    768, 837, 951, 837, 951, 769, 837, 951, 834, 951, 834, 837,
+    917, 768, 917, 769, 919, 768, 919, 769, 919, 837, 8127, 768,
+    8127, 769, 8127, 834, 953, 774, 953, 772, 953, 776, 768, 953,
+    776, 769, 953, 834, 953, 776, 834, 921, 774, 921, 772, 921,
+    768, 921, 769, 8190, 768, 8190, 769, 8190, 834, 965, 774, 965,
+    772, 965, 776, 768, 965, 776, 769, 961, 787, 961, 788, 965,
+    834, 965, 776, 834, 933, 774, 933, 772, 933, 768, 933, 769,
+    929, 788, 168, 768, 168, 769, 96, 969, 768, 837, 969, 837,
+    969, 769, 837, 969, 834, 969, 834, 837, 927, 768, 927, 769,
+    937, 768, 937, 769, 937, 837, 180, 8194, 8195, 937, 75, 65,
+    778, 8592, 824, 8594, 824, 8596, 824, 8656, 824, 8660, 824, 8658,
+    824, 8707, 824, 8712, 824, 8715, 824, 8739, 824, 8741, 824, 8764,
+    824, 8771, 824, 8773, 824, 8776, 824, 61, 824, 8801, 824, 8781,
+    824, 60, 824, 62, 824, 8804, 824, 8805, 824, 8818, 824, 8819,
+    824, 8822, 824, 8823, 824, 8826, 824, 8827, 824, 8834, 824, 8835,
+    824, 8838, 824, 8839, 824, 8866, 824, 8872, 824, 8873, 824, 8875,
+    824, 8828, 824, 8829, 824, 8849, 824, 8850, 824, 8882, 824, 8883,
+    824, 8884, 824, 8885, 824, 12296, 12297, 10973, 824, 12363, 12441, 12365,
+    12441, 12367, 12441, 12369, 12441, 12371, 12441, 12373, 12441, 12375, 12441, 12377,
+    12441, 12379, 12441, 12381, 12441, 12383, 12441, 12385, 12441, 12388, 12441, 12390,
+    12441, 12392, 12441, 12399, 12441, 12399, 12442, 12402, 12441, 12402, 12442, 12405,
+    12441, 12405, 12442, 12408, 12441, 12408, 12442, 12411, 12441, 12411, 12442, 12358,
+    12441, 12445, 12441, 12459, 12441, 12461, 12441, 12463, 12441, 12465, 12441, 12467,
+    12441, 12469, 12441, 12471, 12441, 12473, 12441, 12475, 12441, 12477, 12441, 12479,
+    12441, 12481, 12441, 12484, 12441, 12486, 12441, 12488, 12441, 12495, 12441, 12495,
+    12442, 12498, 12441, 12498, 12442, 12501, 12441, 12501, 12442, 12504, 12441, 12504,
+    12442, 12507, 12441, 12507, 12442, 12454, 12441, 12527, 12441, 12528, 12441, 12529,
+    12441, 12530, 12441, 12541, 12441, 35912, 26356, 36554, 36040, 28369, 20018, 21477,
+    40860, 40860, 22865, 37329, 21895, 22856, 25078, 30313, 32645, 34367, 34746, 35064,
+    37007, 27138, 27931, 28889, 29662, 33853, 37226, 39409, 20098, 21365, 27396, 29211,
+    34349, 40478, 23888, 28651, 34253, 35172, 25289, 33240, 34847, 24266, 26391, 28010,
+    29436, 37070, 20358, 20919, 21214, 25796, 27347, 29200, 30439, 32769, 34310, 34396,
+    36335, 38706, 39791, 40442, 30860, 31103, 32160, 33737, 37636, 40575, 35542, 22751,
+    24324, 31840, 32894, 29282, 30922, 36034, 38647, 22744, 23650, 27155, 28122, 28431,
+    32047, 32311, 38475, 21202, 32907, 20956, 20940, 31260, 32190, 33777, 38517, 35712,
+    25295, 27138, 35582, 20025, 23527, 24594, 29575, 30064, 21271, 30971, 20415, 24489,
+    19981, 27852, 25976, 32034, 21443, 22622, 30465, 33865, 35498, 27578, 36784, 27784,
+    25342, 33509, 25504, 30053, 20142, 20841, 20937, 26753, 31975, 33391, 35538, 37327,
+    21237, 21570, 22899, 24300, 26053, 28670, 31018, 38317, 39530, 40599, 40654, 21147,
+    26310, 27511, 36706, 24180, 24976, 25088, 25754, 28451, 29001, 29833, 31178, 32244,
+    32879, 36646, 34030, 36899, 37706, 21015, 21155, 21693, 28872, 35010, 35498, 24265,
+    24565, 25467, 27566, 31806, 29557, 20196, 22265, 23527, 23994, 24604, 29618, 29801,
+    32666, 32838, 37428, 38646, 38728, 38936, 20363, 31150, 37300, 38584, 24801, 20102,
+    20698, 23534, 23615, 26009, 27138, 29134, 30274, 34044, 36988, 40845, 26248, 38446,
+    21129, 26491, 26611, 27969, 28316, 29705, 30041, 30827, 32016, 39006, 20845, 25134,
+    38520, 20523, 23833, 28138, 36650, 24459, 24900, 26647, 29575, 38534, 21033, 21519,
+    23653, 26131, 26446, 26792, 27877, 29702, 30178, 32633, 35023, 35041, 37324, 38626,
+    21311, 28346, 21533, 29136, 29848, 34298, 38563, 40023, 40607, 26519, 28107, 33256,
+    31435, 31520, 31890, 29376, 28825, 35672, 20160, 33590, 21050, 20999, 24230, 25299,
+    31958, 23429, 27934, 26292, 36667, 34892, 38477, 35211, 24275, 20800, 21952, 22618,
+    26228, 20958, 29482, 30410, 31036, 31070, 31077, 31119, 38742, 31934, 32701, 34322,
+    35576, 36920, 37117, 39151, 39164, 39208, 40372, 37086, 38583, 20398, 20711, 20813,
+    21193, 21220, 21329, 21917, 22022, 22120, 22592, 22696, 23652, 23662, 24724, 24936,
+    24974, 25074, 25935, 26082, 26257, 26757, 28023, 28186, 28450, 29038, 29227, 29730,
+    30865, 31038, 31049, 31048, 31056, 31062, 31069, 31117, 31118, 31296, 31361, 31680,
+    32244, 32265, 32321, 32626, 32773, 33261, 33401, 33401, 33879, 35088, 35222, 35585,
+    35641, 36051, 36104, 36790, 36920, 38627, 38911, 38971, 24693, 148206, 33304, 20006,
+    20917, 20840, 20352, 20805, 20864, 21191, 21242, 21917, 21845, 21913, 21986, 22618,
+    22707, 22852, 22868, 23138, 23336, 24274, 24281, 24425, 24493, 24792, 24910, 24840,
+    24974, 24928, 25074, 25140, 25540, 25628, 25682, 25942, 26228, 26391, 26395, 26454,
+    27513, 27578, 27969, 28379, 28363, 28450, 28702, 29038, 30631, 29237, 29359, 29482,
+    29809, 29958, 30011, 30237, 30239, 30410, 30427, 30452, 30538, 30528, 30924, 31409,
+    31680, 31867, 32091, 32244, 32574, 32773, 33618, 33775, 34681, 35137, 35206, 35222,
+    35519, 35576, 35531, 35585, 35582, 35565, 35641, 35722, 36104, 36664, 36978, 37273,
+    37494, 38524, 38627, 38742, 38875, 38911, 38923, 38971, 39698, 40860, 141386, 141380,
+    144341, 15261, 16408, 16441, 152137, 154832, 163539, 40771, 40846, 1497, 1460, 1522,
+    1463, 1513, 1473, 1513, 1474, 1513, 1468, 1473, 1513, 1468, 1474, 1488,
+    1463, 1488, 1464, 1488, 1468, 1489, 1468, 1490, 1468, 1491, 1468, 1492,
+    1468, 1493, 1468, 1494, 1468, 1496, 1468, 1497, 1468, 1498, 1468, 1499,
+    1468, 1500, 1468, 1502, 1468, 1504, 1468, 1505, 1468, 1507, 1468, 1508,
+    1468, 1510, 1468, 1511, 1468, 1512, 1468, 1513, 1468, 1514, 1468, 1493,
+    1465, 1489, 1471, 1499, 1471, 1508, 1471, 69785, 69818, 69787, 69818, 69797,
+    69818, 69937, 69927, 69938, 69927, 70471, 70462, 70471, 70487, 70841, 70842, 70841,
+    70832, 70841, 70845, 71096, 71087, 71097, 71087, 71989, 71984, 119127, 119141, 119128,
+    119141, 119128, 119141, 119150, 119128, 119141, 119151, 119128, 119141, 119152, 119128, 119141,
+    119153, 119128, 119141, 119154, 119225, 119141, 119226, 119141, 119225, 119141, 119150, 119226,
+    119141, 119150, 119225, 119141, 119151, 119226, 119141, 119151, 20029, 20024, 20033, 131362,
+    20320, 20398, 20411, 20482, 20602, 20633, 20711, 20687, 13470, 132666, 20813, 20820,
+    20836, 20855, 132380, 13497, 20839, 20877, 132427, 20887, 20900, 20172, 20908, 20917,
+    168415, 20981, 20995, 13535, 21051, 21062, 21106, 21111, 13589, 21191, 21193, 21220,
+    21242, 21253, 21254, 21271, 21321, 21329, 21338, 21363, 21373, 21375, 21375, 21375,
+    133676, 28784, 21450, 21471, 133987, 21483, 21489, 21510, 21662, 21560, 21576, 21608,
+    21666, 21750, 21776, 21843, 21859, 21892, 21892, 21913, 21931, 21939, 21954, 22294,
+    22022, 22295, 22097, 22132, 20999, 22766, 22478, 22516, 22541, 22411, 22578, 22577,
+    22700, 136420, 22770, 22775, 22790, 22810, 22818, 22882, 136872, 136938, 23020, 23067,
+    23079, 23000, 23142, 14062, 14076, 23304, 23358, 23358, 137672, 23491, 23512, 23527,
+    23539, 138008, 23551, 23558, 24403, 23586, 14209, 23648, 23662, 23744, 23693, 138724,
+    23875, 138726, 23918, 23915, 23932, 24033, 24034, 14383, 24061, 24104, 24125, 24169,
+    14434, 139651, 14460, 24240, 24243, 24246, 24266, 172946, 24318, 140081, 140081, 33281,
+    24354, 24354, 14535, 144056, 156122, 24418, 24427, 14563, 24474, 24525, 24535, 24569,
+    24705, 14650, 14620, 24724, 141012, 24775, 24904, 24908, 24910, 24908, 24954, 24974,
+    25010, 24996, 25007, 25054, 25074, 25078, 25104, 25115, 25181, 25265, 25300, 25424,
+    142092, 25405, 25340, 25448, 25475, 25572, 142321, 25634, 25541, 25513, 14894, 25705,
+    25726, 25757, 25719, 14956, 25935, 25964, 143370, 26083, 26360, 26185, 15129, 26257,
+    15112, 15076, 20882, 20885, 26368, 26268, 32941, 17369, 26391, 26395, 26401, 26462,
+    26451, 144323, 15177, 26618, 26501, 26706, 26757, 144493, 26766, 26655, 26900, 15261,
+    26946, 27043, 27114, 27304, 145059, 27355, 15384, 27425, 145575, 27476, 15438, 27506,
+    27551, 27578, 27579, 146061, 138507, 146170, 27726, 146620, 27839, 27853, 27751, 27926,
+    27966, 28023, 27969, 28009, 28024, 28037, 146718, 27956, 28207, 28270, 15667, 28363,
+    28359, 147153, 28153, 28526, 147294, 147342, 28614, 28729, 28702, 28699, 15766, 28746,
+    28797, 28791, 28845, 132389, 28997, 148067, 29084, 148395, 29224, 29237, 29264, 149000,
+    29312, 29333, 149301, 149524, 29562, 29579, 16044, 29605, 16056, 16056, 29767, 29788,
+    29809, 29829, 29898, 16155, 29988, 150582, 30014, 150674, 30064, 139679, 30224, 151457,
+    151480, 151620, 16380, 16392, 30452, 151795, 151794, 151833, 151859, 30494, 30495, 30495,
+    30538, 16441, 30603, 16454, 16534, 152605, 30798, 30860, 30924, 16611, 153126, 31062,
+    153242, 153285, 31119, 31211, 16687, 31296, 31306, 31311, 153980, 154279, 154279, 31470,
+    16898, 154539, 31686, 31689, 16935, 154752, 31954, 17056, 31976, 31971, 32000, 155526,
+    32099, 17153, 32199, 32258, 32325, 17204, 156200, 156231, 17241, 156377, 32634, 156478,
+    32661, 32762, 32773, 156890, 156963, 32864, 157096, 32880, 144223, 17365, 32946, 33027,
+    17419, 33086, 23221, 157607, 157621, 144275, 144284, 33281, 33284, 36766, 17515, 33425,
+    33419, 33437, 21171, 33457, 33459, 33469, 33510, 158524, 33509, 33565, 33635, 33709,
+    33571, 33725, 33767, 33879, 33619, 33738, 33740, 33756, 158774, 159083, 158933, 17707,
+    34033, 34035, 34070, 160714, 34148, 159532, 17757, 17761, 159665, 159954, 17771, 34384,
+    34396, 34407, 34409, 34473, 34440, 34574, 34530, 34681, 34600, 34667, 34694, 17879,
+    34785, 34817, 17913, 34912, 34915, 161383, 35031, 35038, 17973, 35066, 13499, 161966,
+    162150, 18110, 18119, 35488, 35565, 35722, 35925, 162984, 36011, 36033, 36123, 36215,
+    163631, 133124, 36299, 36284, 36336, 133342, 36564, 36664, 165330, 165357, 37012, 37105,
+    37137, 165678, 37147, 37432, 37591, 37592, 37500, 37881, 37909, 166906, 38283, 18837,
+    38327, 167287, 18918, 38595, 23986, 38691, 168261, 168474, 19054, 19062, 38880, 168970,
+    19122, 169110, 38923, 38923, 38953, 169398, 39138, 19251, 39209, 39335, 39362, 39422,
+    19406, 170800, 39698, 40000, 40189, 19662, 19693, 40295, 172238, 19704, 172293, 172558,
+    172689, 40635, 19798, 40697, 40702, 40709, 40719, 40726, 40763, 173568,
+};
+
+static const uint64_t KS_CompositionPairs[941] = {
+    0x7800338ULL, 0x7A00338ULL, 0x7C00338ULL, 0x8200300ULL, 0x8200301ULL, 0x8200302ULL,
+    0x8200303ULL, 0x8200304ULL, 0x8200306ULL, 0x8200307ULL, 0x8200308ULL, 0x8200309ULL,
+    0x820030AULL, 0x820030CULL, 0x820030FULL, 0x8200311ULL, 0x8200323ULL, 0x8200325ULL,
+    0x8200328ULL, 0x8400307ULL, 0x8400323ULL, 0x8400331ULL, 0x8600301ULL, 0x8600302ULL,
+    0x8600307ULL, 0x860030CULL, 0x8600327ULL, 0x8800307ULL, 0x880030CULL, 0x8800323ULL,
+    0x8800327ULL, 0x880032DULL, 0x8800331ULL, 0x8A00300ULL, 0x8A00301ULL, 0x8A00302ULL,
+    0x8A00303ULL, 0x8A00304ULL, 0x8A00306ULL, 0x8A00307ULL, 0x8A00308ULL, 0x8A00309ULL,
+    0x8A0030CULL, 0x8A0030FULL, 0x8A00311ULL, 0x8A00323ULL, 0x8A00327ULL, 0x8A00328ULL,
+    0x8A0032DULL, 0x8A00330ULL, 0x8C00307ULL, 0x8E00301ULL, 0x8E00302ULL, 0x8E00304ULL,
+    0x8E00306ULL, 0x8E00307ULL, 0x8E0030CULL, 0x8E00327ULL, 0x9000302ULL, 0x9000307ULL,
+    0x9000308ULL, 0x900030CULL, 0x9000323ULL, 0x9000327ULL, 0x900032EULL, 0x9200300ULL,
+    0x9200301ULL, 0x9200302ULL, 0x9200303ULL, 0x9200304ULL, 0x9200306ULL, 0x9200307ULL,
+    0x9200308ULL, 0x9200309ULL, 0x920030CULL, 0x920030FULL, 0x9200311ULL, 0x9200323ULL,
+    0x9200328ULL, 0x9200330ULL, 0x9400302ULL, 0x9600301ULL, 0x960030CULL, 0x9600323ULL,
+    0x9600327ULL, 0x9600331ULL, 0x9800301ULL, 0x980030CULL, 0x9800323ULL, 0x9800327ULL,
+    0x980032DULL, 0x9800331ULL, 0x9A00301ULL, 0x9A00307ULL, 0x9A00323ULL, 0x9C00300ULL,
+    0x9C00301ULL, 0x9C00303ULL, 0x9C00307ULL, 0x9C0030CULL, 0x9C00323ULL, 0x9C00327ULL,
+    0x9C0032DULL, 0x9C00331ULL, 0x9E00300ULL, 0x9E00301ULL, 0x9E00302ULL, 0x9E00303ULL,
+    0x9E00304ULL, 0x9E00306ULL, 0x9E00307ULL, 0x9E00308ULL, 0x9E00309ULL, 0x9E0030BULL,
+    0x9E0030CULL, 0x9E0030FULL, 0x9E00311ULL, 0x9E0031BULL, 0x9E00323ULL, 0x9E00328ULL,
+    0xA000301ULL, 0xA000307ULL, 0xA400301ULL, 0xA400307ULL, 0xA40030CULL, 0xA40030FULL,
+    0xA400311ULL, 0xA400323ULL, 0xA400327ULL, 0xA400331ULL, 0xA600301ULL, 0xA600302ULL,
+    0xA600307ULL, 0xA60030CULL, 0xA600323ULL, 0xA600326ULL, 0xA600327ULL, 0xA800307ULL,
+    0xA80030CULL, 0xA800323ULL, 0xA800326ULL, 0xA800327ULL, 0xA80032DULL, 0xA800331ULL,
+    0xAA00300ULL, 0xAA00301ULL, 0xAA00302ULL, 0xAA00303ULL, 0xAA00304ULL, 0xAA00306ULL,
+    0xAA00308ULL, 0xAA00309ULL, 0xAA0030AULL, 0xAA0030BULL, 0xAA0030CULL, 0xAA0030FULL,
+    0xAA00311ULL, 0xAA0031BULL, 0xAA00323ULL, 0xAA00324ULL, 0xAA00328ULL, 0xAA0032DULL,
+    0xAA00330ULL, 0xAC00303ULL, 0xAC00323ULL, 0xAE00300ULL, 0xAE00301ULL, 0xAE00302ULL,
+    0xAE00307ULL, 0xAE00308ULL, 0xAE00323ULL, 0xB000307ULL, 0xB000308ULL, 0xB200300ULL,
+    0xB200301ULL, 0xB200302ULL, 0xB200303ULL, 0xB200304ULL, 0xB200307ULL, 0xB200308ULL,
+    0xB200309ULL, 0xB200323ULL, 0xB400301ULL, 0xB400302ULL, 0xB400307ULL, 0xB40030CULL,
+    0xB400323ULL, 0xB400331ULL, 0xC200300ULL, 0xC200301ULL, 0xC200302ULL, 0xC200303ULL,
+    0xC200304ULL, 0xC200306ULL, 0xC200307ULL, 0xC200308ULL, 0xC200309ULL, 0xC20030AULL,
+    0xC20030CULL, 0xC20030FULL, 0xC200311ULL, 0xC200323ULL, 0xC200325ULL, 0xC200328ULL,
+    0xC400307ULL, 0xC400323ULL, 0xC400331ULL, 0xC600301ULL, 0xC600302ULL, 0xC600307ULL,
+    0xC60030CULL, 0xC600327ULL, 0xC800307ULL, 0xC80030CULL, 0xC800323ULL, 0xC800327ULL,
+    0xC80032DULL, 0xC800331ULL, 0xCA00300ULL, 0xCA00301ULL, 0xCA00302ULL, 0xCA00303ULL,
+    0xCA00304ULL, 0xCA00306ULL, 0xCA00307ULL, 0xCA00308ULL, 0xCA00309ULL, 0xCA0030CULL,
+    0xCA0030FULL, 0xCA00311ULL, 0xCA00323ULL, 0xCA00327ULL, 0xCA00328ULL, 0xCA0032DULL,
+    0xCA00330ULL, 0xCC00307ULL, 0xCE00301ULL, 0xCE00302ULL, 0xCE00304ULL, 0xCE00306ULL,
+    0xCE00307ULL, 0xCE0030CULL, 0xCE00327ULL, 0xD000302ULL, 0xD000307ULL, 0xD000308ULL,
+    0xD00030CULL, 0xD000323ULL, 0xD000327ULL, 0xD00032EULL, 0xD000331ULL, 0xD200300ULL,
+    0xD200301ULL, 0xD200302ULL, 0xD200303ULL, 0xD200304ULL, 0xD200306ULL, 0xD200308ULL,
+    0xD200309ULL, 0xD20030CULL, 0xD20030FULL, 0xD200311ULL, 0xD200323ULL, 0xD200328ULL,
+    0xD200330ULL, 0xD400302ULL, 0xD40030CULL, 0xD600301ULL, 0xD60030CULL, 0xD600323ULL,
+    0xD600327ULL, 0xD600331ULL, 0xD800301ULL, 0xD80030CULL, 0xD800323ULL, 0xD800327ULL,
+    0xD80032DULL, 0xD800331ULL, 0xDA00301ULL, 0xDA00307ULL, 0xDA00323ULL, 0xDC00300ULL,
+    0xDC00301ULL, 0xDC00303ULL, 0xDC00307ULL, 0xDC0030CULL, 0xDC00323ULL, 0xDC00327ULL,
+    0xDC0032DULL, 0xDC00331ULL, 0xDE00300ULL, 0xDE00301ULL, 0xDE00302ULL, 0xDE00303ULL,
+    0xDE00304ULL, 0xDE00306ULL, 0xDE00307ULL, 0xDE00308ULL, 0xDE00309ULL, 0xDE0030BULL,
+    0xDE0030CULL, 0xDE0030FULL, 0xDE00311ULL, 0xDE0031BULL, 0xDE00323ULL, 0xDE00328ULL,
+    0xE000301ULL, 0xE000307ULL, 0xE400301ULL, 0xE400307ULL, 0xE40030CULL, 0xE40030FULL,
+    0xE400311ULL, 0xE400323ULL, 0xE400327ULL, 0xE400331ULL, 0xE600301ULL, 0xE600302ULL,
+    0xE600307ULL, 0xE60030CULL, 0xE600323ULL, 0xE600326ULL, 0xE600327ULL, 0xE800307ULL,
+    0xE800308ULL, 0xE80030CULL, 0xE800323ULL, 0xE800326ULL, 0xE800327ULL, 0xE80032DULL,
+    0xE800331ULL, 0xEA00300ULL, 0xEA00301ULL, 0xEA00302ULL, 0xEA00303ULL, 0xEA00304ULL,
+    0xEA00306ULL, 0xEA00308ULL, 0xEA00309ULL, 0xEA0030AULL, 0xEA0030BULL, 0xEA0030CULL,
+    0xEA0030FULL, 0xEA00311ULL, 0xEA0031BULL, 0xEA00323ULL, 0xEA00324ULL, 0xEA00328ULL,
+    0xEA0032DULL, 0xEA00330ULL, 0xEC00303ULL, 0xEC00323ULL, 0xEE00300ULL, 0xEE00301ULL,
+    0xEE00302ULL, 0xEE00307ULL, 0xEE00308ULL, 0xEE0030AULL, 0xEE00323ULL, 0xF000307ULL,
+    0xF000308ULL, 0xF200300ULL, 0xF200301ULL, 0xF200302ULL, 0xF200303ULL, 0xF200304ULL,
+    0xF200307ULL, 0xF200308ULL, 0xF200309ULL, 0xF20030AULL, 0xF200323ULL, 0xF400301ULL,
+    0xF400302ULL, 0xF400307ULL, 0xF40030CULL, 0xF400323ULL, 0xF400331ULL, 0x15000300ULL,
+    0x15000301ULL, 0x15000342ULL, 0x18400300ULL, 0x18400301ULL, 0x18400303ULL, 0x18400309ULL,
+    0x18800304ULL, 0x18A00301ULL, 0x18C00301ULL, 0x18C00304ULL, 0x18E00301ULL, 0x19400300ULL,
+    0x19400301ULL, 0x19400303ULL, 0x19400309ULL, 0x19E00301ULL, 0x1A800300ULL, 0x1A800301ULL,
+    0x1A800303ULL, 0x1A800309ULL, 0x1AA00301ULL, 0x1AA00304ULL, 0x1AA00308ULL, 0x1AC00304ULL,
+    0x1B000301ULL, 0x1B800300ULL, 0x1B800301ULL, 0x1B800304ULL, 0x1B80030CULL, 0x1C400300ULL,
+    0x1C400301ULL, 0x1C400303ULL, 0x1C400309ULL, 0x1C800304ULL, 0x1CA00301ULL, 0x1CC00301ULL,
+    0x1CC00304ULL, 0x1CE00301ULL, 0x1D400300ULL, 0x1D400301ULL, 0x1D400303ULL, 0x1D400309ULL,
+    0x1DE00301ULL, 0x1E800300ULL, 0x1E800301ULL, 0x1E800303ULL, 0x1E800309ULL, 0x1EA00301ULL,
+    0x1EA00304ULL, 0x1EA00308ULL, 0x1EC00304ULL, 0x1F000301ULL, 0x1F800300ULL, 0x1F800301ULL,
+    0x1F800304ULL, 0x1F80030CULL, 0x20400300ULL, 0x20400301ULL, 0x20400303ULL, 0x20400309ULL,
+    0x20600300ULL, 0x20600301ULL, 0x20600303ULL, 0x20600309ULL, 0x22400300ULL, 0x22400301ULL,
+    0x22600300ULL, 0x22600301ULL, 0x29800300ULL, 0x29800301ULL, 0x29A00300ULL, 0x29A00301ULL,
+    0x2B400307ULL, 0x2B600307ULL, 0x2C000307ULL, 0x2C200307ULL, 0x2D000301ULL, 0x2D200301ULL,
+    0x2D400308ULL, 0x2D600308ULL, 0x2FE00307ULL, 0x34000300ULL, 0x34000301ULL, 0x34000303ULL,
+    0x34000309ULL, 0x34000323ULL, 0x34200300ULL, 0x34200301ULL, 0x34200303ULL, 0x34200309ULL,
+    0x34200323ULL, 0x35E00300ULL, 0x35E00301ULL, 0x35E00303ULL, 0x35E00309ULL, 0x35E00323ULL,
+    0x36000300ULL, 0x36000301ULL, 0x36000303ULL, 0x36000309ULL, 0x36000323ULL, 0x36E0030CULL,
+    0x3D400304ULL, 0x3D600304ULL, 0x44C00304ULL, 0x44E00304ULL, 0x45000306ULL, 0x45200306ULL,
+    0x45C00304ULL, 0x45E00304ULL, 0x5240030CULL, 0x72200300ULL, 0x72200301ULL, 0x72200304ULL,
+    0x72200306ULL, 0x72200313ULL, 0x72200314ULL, 0x72200345ULL, 0x72A00300ULL, 0x72A00301ULL,
+    0x72A00313ULL, 0x72A00314ULL, 0x72E00300ULL, 0x72E00301ULL, 0x72E00313ULL, 0x72E00314ULL,
+    0x72E00345ULL, 0x73200300ULL, 0x73200301ULL, 0x73200304ULL, 0x73200306ULL, 0x73200308ULL,
+    0x73200313ULL, 0x73200314ULL, 0x73E00300ULL, 0x73E00301ULL, 0x73E00313ULL, 0x73E00314ULL,
+    0x74200314ULL, 0x74A00300ULL, 0x74A00301ULL, 0x74A00304ULL, 0x74A00306ULL, 0x74A00308ULL,
+    0x74A00314ULL, 0x75200300ULL, 0x75200301ULL, 0x75200313ULL, 0x75200314ULL, 0x75200345ULL,
+    0x75800345ULL, 0x75C00345ULL, 0x76200300ULL, 0x76200301ULL, 0x76200304ULL, 0x76200306ULL,
+    0x76200313ULL, 0x76200314ULL, 0x76200342ULL, 0x76200345ULL, 0x76A00300ULL, 0x76A00301ULL,
+    0x76A00313ULL, 0x76A00314ULL, 0x76E00300ULL, 0x76E00301ULL, 0x76E00313ULL, 0x76E00314ULL,
+    0x76E00342ULL, 0x76E00345ULL, 0x77200300ULL, 0x77200301ULL, 0x77200304ULL, 0x77200306ULL,
+    0x77200308ULL, 0x77200313ULL, 0x77200314ULL, 0x77200342ULL, 0x77E00300ULL, 0x77E00301ULL,
+    0x77E00313ULL, 0x77E00314ULL, 0x78200313ULL, 0x78200314ULL, 0x78A00300ULL, 0x78A00301ULL,
+    0x78A00304ULL, 0x78A00306ULL, 0x78A00308ULL, 0x78A00313ULL, 0x78A00314ULL, 0x78A00342ULL,
+    0x79200300ULL, 0x79200301ULL, 0x79200313ULL, 0x79200314ULL, 0x79200342ULL, 0x79200345ULL,
+    0x79400300ULL, 0x79400301ULL, 0x79400342ULL, 0x79600300ULL, 0x79600301ULL, 0x79600342ULL,
+    0x79C00345ULL, 0x7A400301ULL, 0x7A400308ULL, 0x80C00308ULL, 0x82000306ULL, 0x82000308ULL,
+    0x82600301ULL, 0x82A00300ULL, 0x82A00306ULL, 0x82A00308ULL, 0x82C00306ULL, 0x82C00308ULL,
+    0x82E00308ULL, 0x83000300ULL, 0x83000304ULL, 0x83000306ULL, 0x83000308ULL, 0x83400301ULL,
+    0x83C00308ULL, 0x84600304ULL, 0x84600306ULL, 0x84600308ULL, 0x8460030BULL, 0x84E00308ULL,
+    0x85600308ULL, 0x85A00308ULL, 0x86000306ULL, 0x86000308ULL, 0x86600301ULL, 0x86A00300ULL,
+    0x86A00306ULL, 0x86A00308ULL, 0x86C00306ULL, 0x86C00308ULL, 0x86E00308ULL, 0x87000300ULL,
+    0x87000304ULL, 0x87000306ULL, 0x87000308ULL, 0x87400301ULL, 0x87C00308ULL, 0x88600304ULL,
+    0x88600306ULL, 0x88600308ULL, 0x8860030BULL, 0x88E00308ULL, 0x89600308ULL, 0x89A00308ULL,
+    0x8AC00308ULL, 0x8E80030FULL, 0x8EA0030FULL, 0x9B000308ULL, 0x9B200308ULL, 0x9D000308ULL,
+    0x9D200308ULL, 0xC4E00653ULL, 0xC4E00654ULL, 0xC4E00655ULL, 0xC9000654ULL, 0xC9400654ULL,
+    0xD8200654ULL, 0xDA400654ULL, 0xDAA00654ULL, 0x12500093CULL, 0x12600093CULL, 0x12660093CULL,
+    0x138E009BEULL, 0x138E009D7ULL, 0x168E00B3EULL, 0x168E00B56ULL, 0x168E00B57ULL, 0x172400BD7ULL,
+    0x178C00BBEULL, 0x178C00BD7ULL, 0x178E00BBEULL, 0x188C00C56ULL, 0x197E00CD5ULL, 0x198C00CC2ULL,
+    0x198C00CD5ULL, 0x198C00CD6ULL, 0x199400CD5ULL, 0x1A8C00D3EULL, 0x1A8C00D57ULL, 0x1A8E00D3EULL,
+    0x1BB200DCAULL, 0x1BB200DCFULL, 0x1BB200DDFULL, 0x1BB800DCAULL, 0x204A0102EULL, 0x360A01B35ULL,
+    0x360E01B35ULL, 0x361201B35ULL, 0x361601B35ULL, 0x361A01B35ULL, 0x362201B35ULL, 0x367401B35ULL,
+    0x367801B35ULL, 0x367C01B35ULL, 0x367E01B35ULL, 0x368401B35ULL, 0x3C6C00304ULL, 0x3C6E00304ULL,
+    0x3CB400304ULL, 0x3CB600304ULL, 0x3CC400307ULL, 0x3CC600307ULL, 0x3D4000302ULL, 0x3D4000306ULL,
+    0x3D4200302ULL, 0x3D4200306ULL, 0x3D7000302ULL, 0x3D7200302ULL, 0x3D9800302ULL, 0x3D9A00302ULL,
+    0x3E0000300ULL, 0x3E0000301ULL, 0x3E0000342ULL, 0x3E0000345ULL, 0x3E0200300ULL, 0x3E0200301ULL,
+    0x3E0200342ULL, 0x3E0200345ULL, 0x3E0400345ULL, 0x3E0600345ULL, 0x3E0800345ULL, 0x3E0A00345ULL,
+    0x3E0C00345ULL, 0x3E0E00345ULL, 0x3E1000300ULL, 0x3E1000301ULL, 0x3E1000342ULL, 0x3E1000345ULL,
+    0x3E1200300ULL, 0x3E1200301ULL, 0x3E1200342ULL, 0x3E1200345ULL, 0x3E1400345ULL, 0x3E1600345ULL,
+    0x3E1800345ULL, 0x3E1A00345ULL, 0x3E1C00345ULL, 0x3E1E00345ULL, 0x3E2000300ULL, 0x3E2000301ULL,
+    0x3E2200300ULL, 0x3E2200301ULL, 0x3E3000300ULL, 0x3E3000301ULL, 0x3E3200300ULL, 0x3E3200301ULL,
+    0x3E4000300ULL, 0x3E4000301ULL, 0x3E4000342ULL, 0x3E4000345ULL, 0x3E4200300ULL, 0x3E4200301ULL,
+    0x3E4200342ULL, 0x3E4200345ULL, 0x3E4400345ULL, 0x3E4600345ULL, 0x3E4800345ULL, 0x3E4A00345ULL,
+    0x3E4C00345ULL, 0x3E4E00345ULL, 0x3E5000300ULL, 0x3E5000301ULL, 0x3E5000342ULL, 0x3E5000345ULL,
+    0x3E5200300ULL, 0x3E5200301ULL, 0x3E5200342ULL, 0x3E5200345ULL, 0x3E5400345ULL, 0x3E5600345ULL,
+    0x3E5800345ULL, 0x3E5A00345ULL, 0x3E5C00345ULL, 0x3E5E00345ULL, 0x3E6000300ULL, 0x3E6000301ULL,
+    0x3E6000342ULL, 0x3E6200300ULL, 0x3E6200301ULL, 0x3E6200342ULL, 0x3E7000300ULL, 0x3E7000301ULL,
+    0x3E7000342ULL, 0x3E7200300ULL, 0x3E7200301ULL, 0x3E7200342ULL, 0x3E8000300ULL, 0x3E8000301ULL,
+    0x3E8200300ULL, 0x3E8200301ULL, 0x3E9000300ULL, 0x3E9000301ULL, 0x3E9200300ULL, 0x3E9200301ULL,
+    0x3EA000300ULL, 0x3EA000301ULL, 0x3EA000342ULL, 0x3EA200300ULL, 0x3EA200301ULL, 0x3EA200342ULL,
+    0x3EB200300ULL, 0x3EB200301ULL, 0x3EB200342ULL, 0x3EC000300ULL, 0x3EC000301ULL, 0x3EC000342ULL,
+    0x3EC000345ULL, 0x3EC200300ULL, 0x3EC200301ULL, 0x3EC200342ULL, 0x3EC200345ULL, 0x3EC400345ULL,
+    0x3EC600345ULL, 0x3EC800345ULL, 0x3ECA00345ULL, 0x3ECC00345ULL, 0x3ECE00345ULL, 0x3ED000300ULL,
+    0x3ED000301ULL, 0x3ED000342ULL, 0x3ED000345ULL, 0x3ED200300ULL, 0x3ED200301ULL, 0x3ED200342ULL,
+    0x3ED200345ULL, 0x3ED400345ULL, 0x3ED600345ULL, 0x3ED800345ULL, 0x3EDA00345ULL, 0x3EDC00345ULL,
+    0x3EDE00345ULL, 0x3EE000345ULL, 0x3EE800345ULL, 0x3EF800345ULL, 0x3F6C00345ULL, 0x3F7E00300ULL,
+    0x3F7E00301ULL, 0x3F7E00342ULL, 0x3F8C00345ULL, 0x3FEC00345ULL, 0x3FFC00300ULL, 0x3FFC00301ULL,
+    0x3FFC00342ULL, 0x432000338ULL, 0x432400338ULL, 0x432800338ULL, 0x43A000338ULL, 0x43A400338ULL,
+    0x43A800338ULL, 0x440600338ULL, 0x441000338ULL, 0x441600338ULL, 0x444600338ULL, 0x444A00338ULL,
+    0x447800338ULL, 0x448600338ULL, 0x448A00338ULL, 0x449000338ULL, 0x449A00338ULL, 0x44C200338ULL,
+    0x44C800338ULL, 0x44CA00338ULL, 0x44E400338ULL, 0x44E600338ULL, 0x44EC00338ULL, 0x44EE00338ULL,
+    0x44F400338ULL, 0x44F600338ULL, 0x44F800338ULL, 0x44FA00338ULL, 0x450400338ULL, 0x450600338ULL,
+    0x450C00338ULL, 0x450E00338ULL, 0x452200338ULL, 0x452400338ULL, 0x454400338ULL, 0x455000338ULL,
+    0x455200338ULL, 0x455600338ULL, 0x456400338ULL, 0x456600338ULL, 0x456800338ULL, 0x456A00338ULL,
+    0x608C03099ULL, 0x609603099ULL, 0x609A03099ULL, 0x609E03099ULL, 0x60A203099ULL, 0x60A603099ULL,
+    0x60AA03099ULL, 0x60AE03099ULL, 0x60B203099ULL, 0x60B603099ULL, 0x60BA03099ULL, 0x60BE03099ULL,
+    0x60C203099ULL, 0x60C803099ULL, 0x60CC03099ULL, 0x60D003099ULL, 0x60DE03099ULL, 0x60DE0309AULL,
+    0x60E403099ULL, 0x60E40309AULL, 0x60EA03099ULL, 0x60EA0309AULL, 0x60F003099ULL, 0x60F00309AULL,
+    0x60F603099ULL, 0x60F60309AULL, 0x613A03099ULL, 0x614C03099ULL, 0x615603099ULL, 0x615A03099ULL,
+    0x615E03099ULL, 0x616203099ULL, 0x616603099ULL, 0x616A03099ULL, 0x616E03099ULL, 0x617203099ULL,
+    0x617603099ULL, 0x617A03099ULL, 0x617E03099ULL, 0x618203099ULL, 0x618803099ULL, 0x618C03099ULL,
+    0x619003099ULL, 0x619E03099ULL, 0x619E0309AULL, 0x61A403099ULL, 0x61A40309AULL, 0x61AA03099ULL,
+    0x61AA0309AULL, 0x61B003099ULL, 0x61B00309AULL, 0x61B603099ULL, 0x61B60309AULL, 0x61DE03099ULL,
+    0x61E003099ULL, 0x61E203099ULL, 0x61E403099ULL, 0x61FA03099ULL, 0x22132110BAULL, 0x22136110BAULL,
+    0x2214A110BAULL, 0x2226211127ULL, 0x2226411127ULL, 0x2268E1133EULL, 0x2268E11357ULL, 0x22972114B0ULL,
+    0x22972114BAULL, 0x22972114BDULL, 0x22B70115AFULL, 0x22B72115AFULL, 0x2326A11930ULL,
+};
+
+static const uint32_t KS_CompositionResults[941] = {
+    8814, 8800, 8815, 192, 193, 194, 195, 256, 258, 550, 196, 7842,
+    197, 461, 512, 514, 7840, 7680, 260, 7682, 7684, 7686, 262, 264,
+    266, 268, 199, 7690, 270, 7692, 7696, 7698, 7694, 200, 201, 202,
+    7868, 274, 276, 278, 203, 7866, 282, 516, 518, 7864, 552, 280,
+    7704, 7706, 7710, 500, 284, 7712, 286, 288, 486, 290, 292, 7714,
+    7718, 542, 7716, 7720, 7722, 204, 205, 206, 296, 298, 300, 304,
+    207, 7880, 463, 520, 522, 7882, 302, 7724, 308, 7728, 488, 7730,
+    310, 7732, 313, 317, 7734, 315, 7740, 7738, 7742, 7744, 7746, 504,
+    323, 209, 7748, 327, 7750, 325, 7754, 7752, 210, 211, 212, 213,
+    332, 334, 558, 214, 7886, 336, 465, 524, 526, 416, 7884, 490,
+    7764, 7766, 340, 7768, 344, 528, 530, 7770, 342, 7774, 346, 348,
+    7776, 352, 7778, 536, 350, 7786, 356, 7788, 538, 354, 7792, 7790,
+    217, 218, 219, 360, 362, 364, 220, 7910, 366, 368, 467, 532,
+    534, 431, 7908, 7794, 370, 7798, 7796, 7804, 7806, 7808, 7810, 372,
+    7814, 7812, 7816, 7818, 7820, 7922, 221, 374, 7928, 562, 7822, 376,
+    7926, 7924, 377, 7824, 379, 381, 7826, 7828, 224, 225, 226, 227,
+    257, 259, 551, 228, 7843, 229, 462, 513, 515, 7841, 7681, 261,
+    7683, 7685, 7687, 263, 265, 267, 269, 231, 7691, 271, 7693, 7697,
+    7699, 7695, 232, 233, 234, 7869, 275, 277, 279, 235, 7867, 283,
+    517, 519, 7865, 553, 281, 7705, 7707, 7711, 501, 285, 7713, 287,
+    289, 487, 291, 293, 7715, 7719, 543, 7717, 7721, 7723, 7830, 236,
+    237, 238, 297, 299, 301, 239, 7881, 464, 521, 523, 7883, 303,
+    7725, 309, 496, 7729, 489, 7731, 311, 7733, 314, 318, 7735, 316,
+    7741, 7739, 7743, 7745, 7747, 505, 324, 241, 7749, 328, 7751, 326,
+    7755, 7753, 242, 243, 244, 245, 333, 335, 559, 246, 7887, 337,
+    466, 525, 527, 417, 7885, 491, 7765, 7767, 341, 7769, 345, 529,
+    531, 7771, 343, 7775, 347, 349, 7777, 353, 7779, 537, 351, 7787,
+    7831, 357, 7789, 539, 355, 7793, 7791, 249, 250, 251, 361, 363,
+    365, 252, 7911, 367, 369, 468, 533, 535, 432, 7909, 7795, 371,
+    7799, 7797, 7805, 7807, 7809, 7811, 373, 7815, 7813, 7832, 7817, 7819,
+    7821, 7923, 253, 375, 7929, 563, 7823, 255, 7927, 7833, 7925, 378,
+    7825, 380, 382, 7827, 7829, 8173, 901, 8129, 7846, 7844, 7850, 7848,
+    478, 506, 508, 482, 7688, 7872, 7870, 7876, 7874, 7726, 7890, 7888,
+    7894, 7892, 7756, 556, 7758, 554, 510, 475, 471, 469, 473, 7847,
+    7845, 7851, 7849, 479, 507, 509, 483, 7689, 7873, 7871, 7877, 7875,
+    7727, 7891, 7889, 7895, 7893, 7757, 557, 7759, 555, 511, 476, 472,
+    470, 474, 7856, 7854, 7860, 7858, 7857, 7855, 7861, 7859, 7700, 7702,
+    7701, 7703, 7760, 7762, 7761, 7763, 7780, 7781, 7782, 7783, 7800, 7801,
+    7802, 7803, 7835, 7900, 7898, 7904, 7902, 7906, 7901, 7899, 7905, 7903,
+    7907, 7914, 7912, 7918, 7916, 7920, 7915, 7913, 7919, 7917, 7921, 494,
+    492, 493, 480, 481, 7708, 7709, 560, 561, 495, 8122, 902, 8121,
+    8120, 7944, 7945, 8124, 8136, 904, 7960, 7961, 8138, 905, 7976, 7977,
+    8140, 8154, 906, 8153, 8152, 938, 7992, 7993, 8184, 908, 8008, 8009,
+    8172, 8170, 910, 8169, 8168, 939, 8025, 8186, 911, 8040, 8041, 8188,
+    8116, 8132, 8048, 940, 8113, 8112, 7936, 7937, 8118, 8115, 8050, 941,
+    7952, 7953, 8052, 942, 7968, 7969, 8134, 8131, 8054, 943, 8145, 8144,
+    970, 7984, 7985, 8150, 8056, 972, 8000, 8001, 8164, 8165, 8058, 973,
+    8161, 8160, 971, 8016, 8017, 8166, 8060, 974, 8032, 8033, 8182, 8179,
+    8146, 912, 8151, 8162, 944, 8167, 8180, 979, 980, 1031, 1232, 1234,
+    1027, 1024, 1238, 1025, 1217, 1244, 1246, 1037, 1250, 1049, 1252, 1036,
+    1254, 1262, 1038, 1264, 1266, 1268, 1272, 1260, 1233, 1235, 1107, 1104,
+    1239, 1105, 1218, 1245, 1247, 1117, 1251, 1081, 1253, 1116, 1255, 1263,
+    1118, 1265, 1267, 1269, 1273, 1261, 1111, 1142, 1143, 1242, 1243, 1258,
+    1259, 1570, 1571, 1573, 1572, 1574, 1730, 1747, 1728, 2345, 2353, 2356,
+    2507, 2508, 2891, 2888, 2892, 2964, 3018, 3020, 3019, 3144, 3264, 3274,
+    3271, 3272, 3275, 3402, 3404, 3403, 3546, 3548, 3550, 3549, 4134, 6918,
+    6920, 6922, 6924, 6926, 6930, 6971, 6973, 6976, 6977, 6979, 7736, 7737,
+    7772, 7773, 7784, 7785, 7852, 7862, 7853, 7863, 7878, 7879, 7896, 7897,
+    7938, 7940, 7942, 8064, 7939, 7941, 7943, 8065, 8066, 8067, 8068, 8069,
+    8070, 8071, 7946, 7948, 7950, 8072, 7947, 7949, 7951, 8073, 8074, 8075,
+    8076, 8077, 8078, 8079, 7954, 7956, 7955, 7957, 7962, 7964, 7963, 7965,
+    7970, 7972, 7974, 8080, 7971, 7973, 7975, 8081, 8082, 8083, 8084, 8085,
+    8086, 8087, 7978, 7980, 7982, 8088, 7979, 7981, 7983, 8089, 8090, 8091,
+    8092, 8093, 8094, 8095, 7986, 7988, 7990, 7987, 7989, 7991, 7994, 7996,
+    7998, 7995, 7997, 7999, 8002, 8004, 8003, 8005, 8010, 8012, 8011, 8013,
+    8018, 8020, 8022, 8019, 8021, 8023, 8027, 8029, 8031, 8034, 8036, 8038,
+    8096, 8035, 8037, 8039, 8097, 8098, 8099, 8100, 8101, 8102, 8103, 8042,
+    8044, 8046, 8104, 8043, 8045, 8047, 8105, 8106, 8107, 8108, 8109, 8110,
+    8111, 8114, 8130, 8178, 8119, 8141, 8142, 8143, 8135, 8183, 8157, 8158,
+    8159, 8602, 8603, 8622, 8653, 8655, 8654, 8708, 8713, 8716, 8740, 8742,
+    8769, 8772, 8775, 8777, 8813, 8802, 8816, 8817, 8820, 8821, 8824, 8825,
+    8832, 8833, 8928, 8929, 8836, 8837, 8840, 8841, 8930, 8931, 8876, 8877,
+    8878, 8879, 8938, 8939, 8940, 8941, 12436, 12364, 12366, 12368, 12370, 12372,
+    12374, 12376, 12378, 12380, 12382, 12384, 12386, 12389, 12391, 12393, 12400, 12401,
+    12403, 12404, 12406, 12407, 12409, 12410, 12412, 12413, 12446, 12532, 12460, 12462,
+    12464, 12466, 12468, 12470, 12472, 12474, 12476, 12478, 12480, 12482, 12485, 12487,
+    12489, 12496, 12497, 12499, 12500, 12502, 12503, 12505, 12506, 12508, 12509, 12535,
+    12536, 12537, 12538, 12542, 69786, 69788, 69803, 69934, 69935, 70475, 70476, 70844,
+    70843, 70846, 71098, 71099, 71992,
+};
+
+#endif // KSTRING_UNICODE_DATA_H
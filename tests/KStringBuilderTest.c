@@ -0,0 +1,104 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "KStringTest.h"
+
+//
+// Builder known answers: mixed appends, short and long results, heap and arena backing, sticky failure
+//
+
+static void KS_TestAppends(KStringArena* pArena)
+{
+    KStringBuilder Builder;
+    KStringBuilderInit(&Builder, KSTRING_ENCODING_UTF8, pArena);
+
+    KString Name = KStringCreate("answer", 6);
+    KS_CHECK(true == KStringBuilderAppend(&Builder, Name));
+    KS_CHECK(true == KStringBuilderAppendBytes(&Builder, " = ", 3));
+    KS_CHECK(true == KStringBuilderAppendInt(&Builder, -42));
+    KS_CHECK(true == KStringBuilderAppendBytes(&Builder, ", ", 2));
+    KS_CHECK(true == KStringBuilderAppendUInt(&Builder, UINT64_MAX));
+    KS_CHECK(true == KStringBuilderAppendFormat(&Builder, " [%s:%03d]", "x", 7));
+
+    static const char Expected[] = "answer = -42, 18446744073709551615 [x:007]";
+    KString           Result     = KStringBuilderFinish(&Builder);
+    KS_CHECK(true == KS_TestBytesEqual(Result, Expected, sizeof(Expected) - 1));
+    KS_CHECK(0 == strcmp(Expected, KStringCStr(Result)));
+    KS_CHECK((NULL != pArena) == KStringIsBorrowed(Result));
+
+    // The builder is empty again and can be reused, short results are inline
+    KS_CHECK(0 == Builder.Size && NULL == Builder.pBuffer);
+    KS_CHECK(true == KStringBuilderAppendInt(&Builder, 0));
+    KString Short = KStringBuilderFinish(&Builder);
+    KS_CHECK(true == KStringIsShort(Short) && true == KS_TestBytesEqual(Short, "0", 1));
+
+    KStringDestroy(Result);
+}
+
+static void KS_TestGrowth(void)
+{
+    // Many small appends cross several reallocations
+    KStringBuilder Builder;
+    KStringBuilderInit(&Builder, KSTRING_ENCODING_ANSI, NULL);
+    for (int i = 0; i < 1000; ++i)
+    {
+        KS_CHECK(true == KStringBuilderAppendBytes(&Builder, "0123456789" + (i % 10), 1));
+    }
+
+    KString Result = KStringBuilderFinish(&Builder);
+    KS_CHECK(1000 == KStringSize(Result) && KSTRING_ENCODING_ANSI == KStringGetEncoding(Result));
+    KS_CHECK(0 == KStringByteAt(Result, 0) - '0' && 9 == KStringByteAt(Result, 999) - '0');
+    KStringDestroy(Result);
+}
+
+static void KS_TestFailure(void)
+{
+    // A failed append is sticky and makes Finish return an invalid string
+    KStringBuilder Builder;
+    KStringBuilderInit(&Builder, KSTRING_ENCODING_UTF8, NULL);
+    KS_CHECK(true == KStringBuilderAppendBytes(&Builder, "partial content", 15));
+    KS_CHECK(false == KStringBuilderAppend(&Builder, KStringInvalid()));
+    KS_CHECK(false == KStringBuilderAppendBytes(&Builder, "more", 4));
+    KS_CHECK(false == KStringIsValid(KStringBuilderFinish(&Builder)));
+    KS_CHECK(NULL == Builder.pBuffer && false == Builder.Failed);
+}
+
+int main(void)
+{
+    KS_TestAppends(NULL);
+
+    KStringArena* pArena = KStringArenaCreate(4096);
+    KS_CHECK(NULL != pArena);
+    if (NULL != pArena)
+    {
+        KS_TestAppends(pArena);
+        KStringArenaDestroy(pArena);
+    }
+
+    KS_TestGrowth();
+    KS_TestFailure();
+    return KS_TEST_RESULT();
+}
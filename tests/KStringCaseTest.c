@@ -0,0 +1,122 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "KStringTest.h"
+
+//
+// Case known answers: simple case folding in comparisons across encodings, and case conversion
+//
+
+static void KS_TestFoldedComparisons(void)
+{
+    // ASCII, Latin-1, Greek and Cyrillic in UTF-8, long enough for the SIMD ASCII runs
+    KString Upper = KStringCreate("THE QUICK BROWN FOX \xC3\x84\xC3\x96\xC3\x9C \xCE\xA3\xCE\xA9 \xD0\x96", 34);
+    KString Lower = KStringCreate("the quick brown fox \xC3\xA4\xC3\xB6\xC3\xBC \xCF\x83\xCF\x89 \xD0\xB6", 34);
+    KS_CHECK(true == KStringEqualsIgnoreCase(Upper, Lower) && 0 == KStringCompareIgnoreCase(Upper, Lower));
+    KS_CHECK(false == KStringEquals(Upper, Lower));
+
+    // The same text in UTF-16LE and ANSI compares equal without converting
+    KString Utf16 = KStringConvertToEncoding(Lower, KSTRING_ENCODING_UTF16LE);
+    KS_CHECK(true == KStringEqualsIgnoreCase(Upper, Utf16) && true == KStringEqualsIgnoreCase(Utf16, Upper));
+    KString AnsiUpper = KStringCreateWithEncoding("STRA\xC3SSE \xC4", 10, KSTRING_ENCODING_ANSI);
+    KString AnsiLower = KStringCreate("stra\xC3\xA3sse \xC3\xA4", 12);
+    KS_CHECK(true == KStringEqualsIgnoreCase(AnsiUpper, AnsiLower));
+
+    // Prefixes, and ordering by length in code points first
+    KString Prefix = KStringCreate("THE QUICK brown", 15);
+    KS_CHECK(true == KStringStartsWithIgnoreCase(Lower, Prefix) && false == KStringStartsWithIgnoreCase(Prefix, Lower));
+    KS_CHECK(KStringCompareIgnoreCase(Prefix, Lower) < 0 && KStringCompareIgnoreCase(Lower, Prefix) > 0);
+
+    // U+00DF has no simple case folding to "ss"
+    KString Sharp = KStringCreate("stra\xC3\x9F" "e", 7);
+    KString Ss    = KStringCreate("STRASSE", 7);
+    KS_CHECK(false == KStringEqualsIgnoreCase(Sharp, Ss));
+
+    KStringDestroy(Ss);
+    KStringDestroy(Sharp);
+    KStringDestroy(Prefix);
+    KStringDestroy(AnsiLower);
+    KStringDestroy(AnsiUpper);
+    KStringDestroy(Utf16);
+    KStringDestroy(Lower);
+    KStringDestroy(Upper);
+}
+
+static void KS_TestConversions(void)
+{
+    // Long UTF-8: ASCII runs, two-byte letters, U+00FF to U+0178 and U+00DF kept
+    static const char Mixed[]      = "Hello World, \xC3\xA4\xC3\xB6 \xC3\xBF stra\xC3\x9F" "e";
+    static const char MixedUpper[] = "HELLO WORLD, \xC3\x84\xC3\x96 \xC5\xB8 STRA\xC3\x9F" "E";
+    static const char MixedLower[] = "hello world, \xC3\xA4\xC3\xB6 \xC3\xBF stra\xC3\x9F" "e";
+    KString           Str          = KStringCreate(Mixed, sizeof(Mixed) - 1);
+    KString           Upper        = KStringToUpper(Str);
+    KString           Lower        = KStringToLower(Upper);
+    KS_CHECK(true == KS_TestBytesEqual(Upper, MixedUpper, sizeof(MixedUpper) - 1));
+    KS_CHECK(true == KS_TestBytesEqual(Lower, MixedLower, sizeof(MixedLower) - 1));
+
+    // U+0131 (dotless i) maps to ASCII 'I': one byte shorter
+    KString Dotless      = KStringCreate("\xC4\xB1", 2);
+    KString DotlessUpper = KStringToUpper(Dotless);
+    KS_CHECK(true == KS_TestBytesEqual(DotlessUpper, "I", 1));
+
+    // UTF-16 and ANSI keep their encoding (Windows-1252: 0xE4 to 0xC4, 0x9A to 0x8A, 0xB5 kept)
+    KString Utf16      = KStringCreateWithEncoding("\xE4\0b\0", 4, KSTRING_ENCODING_UTF16LE);
+    KString Utf16Upper = KStringToUpper(Utf16);
+    KS_CHECK(true == KS_TestBytesEqual(Utf16Upper, "\xC4\0B\0", 4) && KSTRING_ENCODING_UTF16LE == KStringGetEncoding(Utf16Upper));
+    KString Ansi      = KStringCreateWithEncoding("\xE4\x9A\xB5x", 4, KSTRING_ENCODING_ANSI);
+    KString AnsiUpper = KStringToUpper(Ansi);
+    KS_CHECK(true == KS_TestBytesEqual(AnsiUpper, "\xC4\x8A\xB5X", 4) && KSTRING_ENCODING_ANSI == KStringGetEncoding(AnsiUpper));
+
+    // ASCII-only mapping leaves everything else alone
+    KString AsciiUpper = KStringToUpperAscii(Str);
+    KS_CHECK(true == KS_TestBytesEqual(AsciiUpper, "HELLO WORLD, \xC3\xA4\xC3\xB6 \xC3\xBF STRA\xC3\x9F" "E", sizeof(Mixed) - 1));
+
+    // In place: inline and TEMPORARY strings, never borrowed ones or UTF-8 size changes
+    KString Inline = KStringCreate("abc", 3);
+    KS_CHECK(true == KStringToUpperInPlace(&Inline, false) && true == KS_TestBytesEqual(Inline, "ABC", 3));
+    KS_CHECK(true == KStringToLowerInPlace(&Upper, false) && true == KS_TestBytesEqual(Upper, MixedLower, sizeof(MixedLower) - 1));
+    KString Borrowed = KStringCreatePersistent(Mixed, sizeof(Mixed) - 1);
+    KS_CHECK(false == KStringToUpperInPlace(&Borrowed, true));
+    KS_CHECK(false == KStringToUpperInPlace(&Dotless, false) && true == KS_TestBytesEqual(Dotless, "\xC4\xB1", 2));
+
+    KStringDestroy(AsciiUpper);
+    KStringDestroy(AnsiUpper);
+    KStringDestroy(Ansi);
+    KStringDestroy(Utf16Upper);
+    KStringDestroy(Utf16);
+    KStringDestroy(DotlessUpper);
+    KStringDestroy(Dotless);
+    KStringDestroy(Lower);
+    KStringDestroy(Upper);
+    KStringDestroy(Str);
+}
+
+int main(void)
+{
+    KS_TestFoldedComparisons();
+    KS_TestConversions();
+    return KS_TEST_RESULT();
+}
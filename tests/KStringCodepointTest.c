@@ -0,0 +1,151 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "KStringTest.h"
+
+//
+// Code point index known answers: indexed substrings agree with the unindexed walk at every offset
+//
+
+// Code points in the test text: three strides and a partial one
+#define KS_TEST_CODEPOINTS 201
+
+// Byte offsets of every code point (and the end) in UTF-8 and UTF-16
+static size_t KS_Utf8Offsets[KS_TEST_CODEPOINTS + 1];
+static size_t KS_Utf16Offsets[KS_TEST_CODEPOINTS + 1];
+
+// Mixed text: ASCII letters, U+00E4 (2 UTF-8 bytes) and U+1F600 (4 UTF-8 bytes, a UTF-16 surrogate pair)
+static size_t KS_BuildText(char* pText)
+{
+    size_t Size      = 0;
+    size_t Utf16Size = 0;
+    for (size_t i = 0; i < KS_TEST_CODEPOINTS; ++i)
+    {
+        KS_Utf8Offsets[i]  = Size;
+        KS_Utf16Offsets[i] = Utf16Size;
+        switch (i % 5)
+        {
+            case 1:
+                memcpy(pText + Size, "\xC3\xA4", 2);
+                Size      += 2;
+                Utf16Size += 2;
+                break;
+            case 3:
+                memcpy(pText + Size, "\xF0\x9F\x98\x80", 4);
+                Size      += 4;
+                Utf16Size += 4;
+                break;
+            default:
+                pText[Size++]  = (char)('a' + i % 26);
+                Utf16Size     += 2;
+                break;
+        }
+    }
+
+    KS_Utf8Offsets[KS_TEST_CODEPOINTS]  = Size;
+    KS_Utf16Offsets[KS_TEST_CODEPOINTS] = Utf16Size;
+    return Size;
+}
+
+// Every offset with counts around the stride and to the end, against the unindexed walk and the UTF-8 text
+static void KS_TestIndexedSubstrings(const KString Str, const KString Utf8, KStringCodepointIndex* pIndex)
+{
+    static const size_t Counts[] = {1, 63, 64, 65, KS_TEST_CODEPOINTS};
+
+    for (size_t Offset = 0; Offset < KS_TEST_CODEPOINTS; ++Offset)
+    {
+        for (size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+        {
+            KString Indexed  = KStringSubstringCodepoints(Str, Offset, Counts[c], pIndex);
+            KString Plain    = KStringSubstringCodepoints(Str, Offset, Counts[c], NULL);
+            size_t  End      = (Counts[c] < KS_TEST_CODEPOINTS - Offset) ? Offset + Counts[c] : KS_TEST_CODEPOINTS;
+            KString Expected = KStringSubstring(Utf8, KS_Utf8Offsets[Offset], KS_Utf8Offsets[End] - KS_Utf8Offsets[Offset]);
+            if (false == KStringEquals(Indexed, Plain) || false == KStringEqualsCodepoints(Indexed, Expected))
+            {
+                fprintf(stderr, "offset %zu, count %zu:\n", Offset, Counts[c]);
+            }
+            KS_CHECK(true == KStringIsValid(Indexed) && true == KStringEquals(Indexed, Plain));
+            KS_CHECK(true == KStringEqualsCodepoints(Indexed, Expected));
+            KStringDestroy(Expected);
+            KStringDestroy(Plain);
+            KStringDestroy(Indexed);
+        }
+    }
+
+    // One past the last code point is out of range either way
+    KS_CHECK(false == KStringIsValid(KStringSubstringCodepoints(Str, KS_TEST_CODEPOINTS, 1, pIndex)));
+    KS_CHECK(false == KStringIsValid(KStringSubstringCodepoints(Str, KS_TEST_CODEPOINTS, 1, NULL)));
+}
+
+int main(void)
+{
+    char    Text[4 * KS_TEST_CODEPOINTS];
+    size_t  Size  = KS_BuildText(Text);
+    KString Utf8  = KStringCreate(Text, Size);
+    KString Utf16 = KStringConvertToEncoding(Utf8, KSTRING_ENCODING_UTF16BE);
+    KS_CHECK(KS_TEST_CODEPOINTS == KStringCodepointCount(Utf8) && KS_TEST_CODEPOINTS == KStringCodepointCount(Utf16));
+
+    // Checkpoint layout: the byte offset of every 64th code point
+    KStringCodepointIndex Index;
+    KStringCodepointIndexInit(&Index);
+    KS_CHECK(true == KStringCodepointIndexBuild(&Index, Utf8));
+    KS_CHECK(KS_TEST_CODEPOINTS == Index.CodepointCount && KS_TEST_CODEPOINTS / 64 + 1 == Index.CheckpointCount);
+    for (size_t i = 0; i < Index.CheckpointCount; ++i)
+    {
+        KS_CHECK(KS_Utf8Offsets[64 * i] == Index.pOffsets[i]);
+    }
+
+    // Building again for the same string keeps the table
+    size_t* pOffsets = Index.pOffsets;
+    KS_CHECK(true == KStringCodepointIndexBuild(&Index, Utf8) && pOffsets == Index.pOffsets);
+    KS_TestIndexedSubstrings(Utf8, Utf8, &Index);
+
+    // Another string replaces the table
+    KS_CHECK(true == KStringCodepointIndexBuild(&Index, Utf16));
+    KS_CHECK(KS_TEST_CODEPOINTS == Index.CodepointCount && KS_TEST_CODEPOINTS / 64 + 1 == Index.CheckpointCount);
+    for (size_t i = 0; i < Index.CheckpointCount; ++i)
+    {
+        KS_CHECK(KS_Utf16Offsets[64 * i] == Index.pOffsets[i]);
+    }
+    KS_TestIndexedSubstrings(Utf16, Utf8, &Index);
+
+    // Substring builds the index lazily and switches strings on its own
+    KStringCodepointIndexDestroy(&Index);
+    KS_CHECK(NULL == Index.pOffsets);
+    KString Lazy = KStringSubstringCodepoints(Utf8, 66, 1, &Index);
+    KS_CHECK(NULL != Index.pOffsets && KS_Utf8Offsets[64] == Index.pOffsets[1]);
+    KS_CHECK(true == KS_TestBytesEqual(Lazy, "\xC3\xA4", 2));
+    KString Switched = KStringSubstringCodepoints(Utf16, 64, 1, &Index);
+    KS_CHECK(KS_Utf16Offsets[64] == Index.pOffsets[1]);
+    KS_CHECK(true == KS_TestBytesEqual(Switched, "\0m", 2));
+
+    KStringDestroy(Switched);
+    KStringDestroy(Lazy);
+    KStringCodepointIndexDestroy(&Index);
+    KStringDestroy(Utf16);
+    KStringDestroy(Utf8);
+    return KS_TEST_RESULT();
+}
@@ -0,0 +1,188 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "KStringTest.h"
+
+//
+// Cross-encoding comparison known answers: code point order regardless of the encodings on either side
+//
+
+// Check the order both ways and agreement with the equality test
+static bool KS_TestOrder(const KString StrA, const KString StrB, const int Expected)
+{
+    return Expected == KStringCompareCodepoints(StrA, StrB) && -Expected == KStringCompareCodepoints(StrB, StrA) &&
+           (0 == Expected) == KStringEqualsCodepoints(StrA, StrB) && (0 == Expected) == KStringEqualsCodepoints(StrB, StrA);
+}
+
+// The same text as plain UTF-8, validated UTF-8, UTF-16LE and UTF-16BE
+static void KS_TestCreateForms(const char* pUtf8, const size_t Size, KString Forms[4])
+{
+    Forms[0] = KStringCreate(pUtf8, Size);
+    Forms[1] = KStringCreateValidated(pUtf8, Size);
+    Forms[2] = KStringConvertToEncoding(Forms[0], KSTRING_ENCODING_UTF16LE);
+    Forms[3] = KStringConvertToEncoding(Forms[0], KSTRING_ENCODING_UTF16BE);
+    KS_CHECK(true == KStringIsValidatedUtf8(Forms[1]));
+}
+
+static void KS_TestDestroyForms(KString Forms[4])
+{
+    for (size_t i = 0; i < 4; ++i)
+    {
+        KStringDestroy(Forms[i]);
+    }
+}
+
+// Two ASCII blocks of 16 bytes, U+00E4, then more ASCII: mismatches before, on and after the block boundaries
+static void KS_TestBlockMismatches(void)
+{
+    static const char   Text[]      = "abcdefghijklmnopqrstuvwxyzABCDEFGH\xC3\xA4IJKLMNOPQR";
+    static const size_t Positions[] = {5, 15, 16, 17, 20, 31, 32, 33, 36, 45};
+
+    KString Base[4];
+    KS_TestCreateForms(Text, sizeof(Text) - 1, Base);
+    for (size_t a = 0; a < 4; ++a)
+    {
+        for (size_t b = 0; b < 4; ++b)
+        {
+            KS_CHECK(true == KS_TestOrder(Base[a], Base[b], 0));
+        }
+    }
+
+    for (size_t p = 0; p < sizeof(Positions) / sizeof(Positions[0]); ++p)
+    {
+        char Higher[sizeof(Text)];
+        memcpy(Higher, Text, sizeof(Text));
+        Higher[Positions[p]]++;
+
+        KString Forms[4];
+        KS_TestCreateForms(Higher, sizeof(Text) - 1, Forms);
+        for (size_t a = 0; a < 4; ++a)
+        {
+            for (size_t b = 0; b < 4; ++b)
+            {
+                if (false == KS_TestOrder(Base[a], Forms[b], -1))
+                {
+                    fprintf(stderr, "mismatch at byte %zu, forms %zu/%zu:\n", Positions[p], a, b);
+                }
+                KS_CHECK(true == KS_TestOrder(Base[a], Forms[b], -1));
+            }
+        }
+        KS_TestDestroyForms(Forms);
+    }
+
+    KS_TestDestroyForms(Base);
+}
+
+// U+1F600 orders after U+FFFF, although its UTF-16 high surrogate (0xD83D) is below 0xFFFF
+static void KS_TestSurrogateOrder(void)
+{
+    static const char Astral[]     = "\xF0\x9F\x98\x80";
+    static const char Bmp[]        = "\xEF\xBF\xBF";
+    static const char LongAstral[] = "0123456789abcdefghij\xF0\x9F\x98\x80";
+    static const char LongBmp[]    = "0123456789abcdefghij\xEF\xBF\xBF";
+
+    KString AstralForms[4];
+    KString BmpForms[4];
+    KString LongAstralForms[4];
+    KString LongBmpForms[4];
+    KS_TestCreateForms(Astral, sizeof(Astral) - 1, AstralForms);
+    KS_TestCreateForms(Bmp, sizeof(Bmp) - 1, BmpForms);
+    KS_TestCreateForms(LongAstral, sizeof(LongAstral) - 1, LongAstralForms);
+    KS_TestCreateForms(LongBmp, sizeof(LongBmp) - 1, LongBmpForms);
+
+    for (size_t a = 0; a < 4; ++a)
+    {
+        for (size_t b = 0; b < 4; ++b)
+        {
+            KS_CHECK(true == KS_TestOrder(AstralForms[a], BmpForms[b], 1));
+            KS_CHECK(true == KS_TestOrder(LongAstralForms[a], LongBmpForms[b], 1));
+            KS_CHECK(true == KS_TestOrder(AstralForms[a], AstralForms[b], 0));
+        }
+    }
+
+    KS_TestDestroyForms(LongBmpForms);
+    KS_TestDestroyForms(LongAstralForms);
+    KS_TestDestroyForms(BmpForms);
+    KS_TestDestroyForms(AstralForms);
+}
+
+static void KS_TestEdgeCases(void)
+{
+    // A proper prefix orders first, inline and long
+    KString Short[4];
+    KString ShortPrefix[4];
+    KString Long[4];
+    KString LongPrefix[4];
+    KS_TestCreateForms("abc\xC3\xA4", 5, Short);
+    KS_TestCreateForms("abc", 3, ShortPrefix);
+    KS_TestCreateForms("0123456789abcdefghij\xC3\xA4xyz", 25, Long);
+    KS_TestCreateForms("0123456789abcdefghij\xC3\xA4xy", 24, LongPrefix);
+    for (size_t a = 0; a < 4; ++a)
+    {
+        for (size_t b = 0; b < 4; ++b)
+        {
+            KS_CHECK(true == KS_TestOrder(ShortPrefix[a], Short[b], -1));
+            KS_CHECK(true == KS_TestOrder(LongPrefix[a], Long[b], -1));
+        }
+    }
+
+    // Invalid bytes compare as U+FFFD: a stray continuation byte, a truncated sequence and a lone surrogate
+    KString Replacement = KStringCreate("x\xEF\xBF\xBD" "y", 5);
+    KString Stray       = KStringCreate("x\x80y", 3);
+    KString Truncated   = KStringCreate("x\xE2\x82y", 4);
+    KString Lone        = KStringCreateWithEncoding("x\0\x00\xD8y\0", 6, KSTRING_ENCODING_UTF16LE);
+    KString LoneBe      = KStringCreateWithEncoding("\0x\xDC\x00\0y", 6, KSTRING_ENCODING_UTF16BE);
+    KS_CHECK(true == KS_TestOrder(Replacement, Stray, 0));
+    KS_CHECK(true == KS_TestOrder(Replacement, Truncated, 0));
+    KS_CHECK(true == KS_TestOrder(Replacement, Lone, 0));
+    KS_CHECK(true == KS_TestOrder(Stray, LoneBe, 0));
+
+    // Invalid strings order before every valid string, the empty one included
+    KString Empty = KStringCreateWithEncoding("", 0, KSTRING_ENCODING_UTF16LE);
+    KS_CHECK(-1 == KStringCompareCodepoints(KStringInvalid(), Empty) && 1 == KStringCompareCodepoints(Empty, KStringInvalid()));
+    KS_CHECK(0 == KStringCompareCodepoints(KStringInvalid(), KStringInvalid()));
+    KS_CHECK(false == KStringEqualsCodepoints(KStringInvalid(), KStringInvalid()));
+    KS_CHECK(true == KS_TestOrder(Empty, ShortPrefix[0], -1));
+
+    KStringDestroy(Empty);
+    KStringDestroy(LoneBe);
+    KStringDestroy(Lone);
+    KStringDestroy(Truncated);
+    KStringDestroy(Stray);
+    KStringDestroy(Replacement);
+    KS_TestDestroyForms(LongPrefix);
+    KS_TestDestroyForms(Long);
+    KS_TestDestroyForms(ShortPrefix);
+    KS_TestDestroyForms(Short);
+}
+
+int main(void)
+{
+    KS_TestBlockMismatches();
+    KS_TestSurrogateOrder();
+    KS_TestEdgeCases();
+    return KS_TEST_RESULT();
+}
@@ -0,0 +1,82 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "KStringTest.h"
+
+//
+// N-way concatenation and join known answers
+//
+
+int main(void)
+{
+    const KString Parts[4] = {
+        KStringCreate("ab", 2),
+        KStringCreate("a long part that lives on the heap", 34),
+        KStringCreate("", 0),
+        KStringCreatePersistent("another long borrowed part", 26),
+    };
+    const KString Separator = KStringCreate(" \xE2\x80\x94 ", 5); // U+2014 between spaces
+
+    // Short parts with a short result stay inline
+    KString Inline = KStringConcatN(Parts, 1);
+    KS_CHECK(true == KStringIsShort(Inline) && true == KS_TestBytesEqual(Inline, "ab", 2));
+    const KString Tiny[3]    = {Parts[0], Parts[2], Parts[0]};
+    KString       TinyJoined = KStringJoin(Tiny, 3, KStringCreate(",", 1));
+    KS_CHECK(true == KStringIsShort(TinyJoined) && true == KS_TestBytesEqual(TinyJoined, "ab,,ab", 6));
+
+    // Long results over mixed short, long, empty and borrowed parts
+    static const char Concatenated[] = "aba long part that lives on the heapanother long borrowed part";
+    KString           All            = KStringConcatN(Parts, 4);
+    KS_CHECK(false == KStringIsShort(All) && false == KStringIsBorrowed(All));
+    KS_CHECK(true == KS_TestBytesEqual(All, Concatenated, sizeof(Concatenated) - 1));
+
+    // A multi-byte separator goes between every pair, empty parts included
+    static const char Joined[] = "ab \xE2\x80\x94 a long part that lives on the heap \xE2\x80\x94  \xE2\x80\x94 another long borrowed part";
+    KString           Join     = KStringJoin(Parts, 4, Separator);
+    KS_CHECK(true == KS_TestBytesEqual(Join, Joined, sizeof(Joined) - 1));
+
+    // No parts is the empty string, one part is a copy without separator
+    KString None = KStringConcatN(Parts, 0);
+    KS_CHECK(true == KS_TestBytesEqual(None, "", 0) && true == KS_TestBytesEqual(KStringJoin(Parts, 0, Separator), "", 0));
+    KString Single = KStringJoin(&Parts[3], 1, Separator);
+    KS_CHECK(true == KS_TestBytesEqual(Single, "another long borrowed part", 26) && false == KStringIsBorrowed(Single));
+    KString SingleConcat = KStringConcatN(&Parts[1], 1);
+    KS_CHECK(true == KS_TestBytesEqual(SingleConcat, "a long part that lives on the heap", 34));
+
+    KStringDestroy(SingleConcat);
+    KStringDestroy(Single);
+    KStringDestroy(None);
+    KStringDestroy(Join);
+    KStringDestroy(All);
+    KStringDestroy(TinyJoined);
+    KStringDestroy(Inline);
+    for (size_t i = 0; i < 4; ++i)
+    {
+        KStringDestroy(Parts[i]);
+    }
+
+    return KS_TEST_RESULT();
+}
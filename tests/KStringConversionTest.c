@@ -0,0 +1,223 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "KStringTest.h"
+#include <stdlib.h>
+
+//
+// Encoding conversion known answers
+// Every conversion entry point (direct, sized, into a buffer, batched, concatenated, streamed) must agree byte for byte
+//
+
+// Convert through the streaming transcoder one input byte at a time
+static bool KS_TestTranscodeBytewise(const char* pSource, const size_t SourceSize, const KStringEncoding SourceEncoding, const KStringEncoding TargetEncoding,
+                                     const char* pExpected, const size_t ExpectedSize)
+{
+    KStringTranscoder Transcoder;
+    uint8_t           Output[256];
+    size_t            Total = 0;
+    KStringTranscoderInit(&Transcoder, SourceEncoding, TargetEncoding);
+
+    for (size_t i = 0; i < SourceSize; ++i)
+    {
+        size_t Consumed = 0;
+        size_t Written  = 0;
+        if (false == KStringTranscoderProcess(&Transcoder, pSource + i, 1, &Consumed, Output + Total, sizeof(Output) - Total, &Written) || 1 != Consumed)
+        {
+            return false;
+        }
+        Total += Written;
+    }
+
+    size_t Written = 0;
+    if (false == KStringTranscoderFinish(&Transcoder, Output + Total, sizeof(Output) - Total, &Written))
+    {
+        return false;
+    }
+    Total += Written;
+
+    return ExpectedSize == Total && 0 == memcmp(Output, pExpected, Total);
+}
+
+static void KS_TestConversion(const char* pSource, const size_t SourceSize, const KStringEncoding SourceEncoding, const KStringEncoding TargetEncoding,
+                              const char* pExpected, const size_t ExpectedSize, const size_t Codepoints)
+{
+    KString Source = KStringCreateWithEncoding(pSource, SourceSize, SourceEncoding);
+    KS_CHECK(true == KStringIsValid(Source));
+    KS_CHECK(Codepoints == KStringCodepointCount(Source));
+
+    KString Converted = KStringConvertToEncoding(Source, TargetEncoding);
+    KS_CHECK(true == KS_TestBytesEqual(Converted, pExpected, ExpectedSize));
+    KS_CHECK(TargetEncoding == KStringGetEncoding(Converted));
+    KS_CHECK(ExpectedSize == KStringConvertedSize(Source, TargetEncoding));
+    KStringDestroy(Converted);
+
+    // Exact capacity succeeds, one byte less reports the required size
+    char   Buffer[256];
+    size_t Written = 0;
+    KS_CHECK(true == KStringConvertInto(Source, TargetEncoding, Buffer, ExpectedSize, &Written));
+    KS_CHECK(ExpectedSize == Written && 0 == memcmp(Buffer, pExpected, ExpectedSize));
+    if (0 != ExpectedSize)
+    {
+        KS_CHECK(false == KStringConvertInto(Source, TargetEncoding, Buffer, ExpectedSize - 1, &Written));
+        KS_CHECK(ExpectedSize == Written);
+    }
+
+    KStringArena* pArena = KStringArenaCreate(4096);
+    KString       Batch  = KStringInvalid();
+    KS_CHECK(NULL != pArena && true == KStringConvertBatch(&Source, 1, TargetEncoding, pArena, &Batch));
+    KS_CHECK(true == KS_TestBytesEqual(Batch, pExpected, ExpectedSize));
+    KStringArenaDestroy(pArena);
+
+    KString Empty  = KStringCreateWithEncoding("", 0, TargetEncoding);
+    KString Joined = KStringConcatWithEncoding(Empty, Source, TargetEncoding);
+    KS_CHECK(true == KS_TestBytesEqual(Joined, pExpected, ExpectedSize));
+    KStringDestroy(Joined);
+
+    KS_CHECK(true == KS_TestTranscodeBytewise(pSource, SourceSize, SourceEncoding, TargetEncoding, pExpected, ExpectedSize));
+    KStringDestroy(Source);
+}
+
+#define KS_CONVERT(Source, SourceEncoding, TargetEncoding, Expected, Codepoints) \
+    KS_TestConversion(Source, sizeof(Source) - 1, SourceEncoding, TargetEncoding, Expected, sizeof(Expected) - 1, Codepoints)
+
+static void KS_TestKnownAnswers(void)
+{
+    // U+0041, U+20AC (Windows-1252 0x80) and U+1F600 (surrogate pair, no Windows-1252 byte)
+    KS_CONVERT("A\xE2\x82\xAC\xF0\x9F\x98\x80", KSTRING_ENCODING_UTF8, KSTRING_ENCODING_UTF16LE, "A\0\xAC\x20\x3D\xD8\x00\xDE", 3);
+    KS_CONVERT("A\xE2\x82\xAC\xF0\x9F\x98\x80", KSTRING_ENCODING_UTF8, KSTRING_ENCODING_UTF16BE, "\0A\x20\xAC\xD8\x3D\xDE\x00", 3);
+    KS_CONVERT("A\xE2\x82\xAC\xF0\x9F\x98\x80", KSTRING_ENCODING_UTF8, KSTRING_ENCODING_ANSI, "A\x80?", 3);
+    KS_CONVERT("A\0\xAC\x20\x3D\xD8\x00\xDE", KSTRING_ENCODING_UTF16LE, KSTRING_ENCODING_UTF8, "A\xE2\x82\xAC\xF0\x9F\x98\x80", 3);
+    KS_CONVERT("A\0\xAC\x20\x3D\xD8\x00\xDE", KSTRING_ENCODING_UTF16LE, KSTRING_ENCODING_UTF16BE, "\0A\x20\xAC\xD8\x3D\xDE\x00", 3);
+    KS_CONVERT("\0A\x20\xAC\xD8\x3D\xDE\x00", KSTRING_ENCODING_UTF16BE, KSTRING_ENCODING_ANSI, "A\x80?", 3);
+    KS_CONVERT("\x80\x9F\xFF", KSTRING_ENCODING_ANSI, KSTRING_ENCODING_UTF8, "\xE2\x82\xAC\xC5\xB8\xC3\xBF", 3);
+    KS_CONVERT("\x80\x9F\xFF", KSTRING_ENCODING_ANSI, KSTRING_ENCODING_UTF16BE, "\x20\xAC\x01\x78\x00\xFF", 3);
+
+    // Long strings take the heap paths and the 16-byte ASCII blocks
+    KS_CONVERT("0123456789abcdef\xC3\xA4", KSTRING_ENCODING_UTF8, KSTRING_ENCODING_UTF16LE,
+               "0\0" "1\0" "2\0" "3\0" "4\0" "5\0" "6\0" "7\0" "8\0" "9\0" "a\0" "b\0" "c\0" "d\0" "e\0" "f\0" "\xE4\0", 17);
+    KS_CONVERT("0123456789abcdef\xC3\xA4", KSTRING_ENCODING_UTF8, KSTRING_ENCODING_ANSI, "0123456789abcdef\xE4", 17);
+
+    // Invalid input becomes U+FFFD: a truncated UTF-8 sequence and a lone UTF-16 surrogate
+    KS_CONVERT("\xC3(", KSTRING_ENCODING_UTF8, KSTRING_ENCODING_UTF16LE, "\xFD\xFF(\0", 2);
+    KS_CONVERT("\0\xD8" "A\0", KSTRING_ENCODING_UTF16LE, KSTRING_ENCODING_UTF8, "\xEF\xBF\xBD" "A", 2);
+}
+
+// A trailing odd UTF-16 byte is one U+FFFD for every target, same encoding included
+static void KS_TestOddUtf16Byte(void)
+{
+    KS_CONVERT("A\0B\0C", KSTRING_ENCODING_UTF16LE, KSTRING_ENCODING_UTF8, "AB\xEF\xBF\xBD", 3);
+    KS_CONVERT("A\0B\0C", KSTRING_ENCODING_UTF16LE, KSTRING_ENCODING_UTF16BE, "\0A\0B\xFF\xFD", 3);
+    KS_CONVERT("A\0B\0C", KSTRING_ENCODING_UTF16LE, KSTRING_ENCODING_UTF16LE, "A\0B\0\xFD\xFF", 3);
+    KS_CONVERT("A\0B\0C", KSTRING_ENCODING_UTF16LE, KSTRING_ENCODING_ANSI, "AB?", 3);
+    KS_CONVERT("\0A\0B\0C\0D\0E\0F\0", KSTRING_ENCODING_UTF16BE, KSTRING_ENCODING_UTF8, "ABCDEF\xEF\xBF\xBD", 7);
+    KS_CONVERT("\0A\0B\0C\0D\0E\0F\0", KSTRING_ENCODING_UTF16BE, KSTRING_ENCODING_UTF16BE, "\0A\0B\0C\0D\0E\0F\xFF\xFD", 7);
+    KS_CONVERT("\0A\0B\0C\0D\0E\0F\0", KSTRING_ENCODING_UTF16BE, KSTRING_ENCODING_UTF16LE, "A\0B\0C\0D\0E\0F\0\xFD\xFF", 7);
+
+    // The character semantics agree: the odd byte is the last code point
+    KString Odd  = KStringCreateWithEncoding("\0A\0B\0C\0D\0E\0F\0", 13, KSTRING_ENCODING_UTF16BE);
+    KString Last = KStringSubstringCodepoints(Odd, 6, 1, NULL);
+    KS_CHECK(true == KS_TestBytesEqual(Last, "\0", 1));
+    KS_CHECK(false == KStringIsValid(KStringSubstringCodepoints(Odd, 7, 1, NULL)));
+    KStringDestroy(Last);
+
+    // Swapping in place cannot make room for the U+FFFD
+    KString Swapped = KStringCreateWithEncoding("A\0B\0C", 5, KSTRING_ENCODING_UTF16LE);
+    KS_CHECK(false == KStringSwapUtf16InPlace(&Swapped));
+    KS_CHECK(KSTRING_ENCODING_UTF16LE == KStringGetEncoding(Swapped));
+    KStringDestroy(Swapped);
+    KStringDestroy(Odd);
+}
+
+// A borrowed buffer changed after validation keeps the flag: the flag-based sizes are wrong and must not overflow
+static void KS_TestStaleValidatedFlag(void)
+{
+    char Buffer[32];
+    memset(Buffer, 'a', sizeof(Buffer));
+    KString Stale = KStringCreateTransientValidated(Buffer, sizeof(Buffer));
+    KS_CHECK(true == KStringIsValidatedUtf8(Stale));
+
+    // Lone continuation bytes count as no code point but each becomes U+FFFD or '?'
+    memset(Buffer, 0x80, sizeof(Buffer));
+    KS_CHECK(false == KStringIsValid(KStringConvertUtf8ToUtf16Le(Stale)));
+    KS_CHECK(false == KStringIsValid(KStringConvertUtf8ToUtf16Be(Stale)));
+    KS_CHECK(false == KStringIsValid(KStringConvertUtf8ToAnsi(Stale)));
+
+    // The caller's capacity is a hard limit, the failure reports the size the bytes really need
+    char   Output[16];
+    size_t Written = 0;
+    KS_CHECK(false == KStringConvertInto(Stale, KSTRING_ENCODING_UTF16LE, Output, sizeof(Output), &Written));
+    KS_CHECK(2 * sizeof(Buffer) == Written);
+    KS_CHECK(false == KStringConvertInto(Stale, KSTRING_ENCODING_ANSI, Output, sizeof(Output), &Written));
+    KS_CHECK(sizeof(Buffer) == Written);
+
+    KString Empty = KStringCreateWithEncoding("", 0, KSTRING_ENCODING_UTF16LE);
+    KS_CHECK(false == KStringIsValid(KStringConcatWithEncoding(Empty, Stale, KSTRING_ENCODING_UTF16LE)));
+
+    // A batch keeps the stale element inside its own slot and still converts its neighbours
+    const KString Inputs[3] = {KStringCreate("first neighbour", 15), Stale, KStringCreate("second neighbour", 16)};
+    KString       Results[3];
+    KStringArena* pArena = KStringArenaCreate(4096);
+    KS_CHECK(NULL != pArena && true == KStringConvertBatch(Inputs, 3, KSTRING_ENCODING_ANSI, pArena, Results));
+    KS_CHECK(true == KS_TestBytesEqual(Results[0], "first neighbour", 15));
+    KS_CHECK(false == KStringIsValid(Results[1]));
+    KS_CHECK(true == KS_TestBytesEqual(Results[2], "second neighbour", 16));
+    KStringArenaDestroy(pArena);
+    KStringDestroy(Inputs[2]);
+    KStringDestroy(Inputs[0]);
+}
+
+// An output buffer too small for the next code point fails instead of returning without progress
+static void KS_TestTranscoderNoProgress(void)
+{
+    static const char Astral[] = "\xF0\x9F\x98\x80";
+    KStringTranscoder Transcoder;
+    uint8_t           Output[4];
+    size_t            Consumed = 0;
+    size_t            Written  = 0;
+    KStringTranscoderInit(&Transcoder, KSTRING_ENCODING_UTF8, KSTRING_ENCODING_UTF16LE);
+    KS_CHECK(false == KStringTranscoderProcess(&Transcoder, Astral, 4, &Consumed, Output, 3, &Written));
+    KS_CHECK(0 == Consumed && 0 == Written);
+    KS_CHECK(true == KStringTranscoderProcess(&Transcoder, Astral, 4, &Consumed, Output, sizeof(Output), &Written));
+    KS_CHECK(4 == Consumed && 4 == Written && 0 == memcmp(Output, "\x3D\xD8\x00\xDE", 4));
+
+    // The same holds for a sequence completed from the carry-over
+    KStringTranscoderInit(&Transcoder, KSTRING_ENCODING_UTF8, KSTRING_ENCODING_UTF16LE);
+    KS_CHECK(true == KStringTranscoderProcess(&Transcoder, Astral, 2, &Consumed, Output, sizeof(Output), &Written));
+    KS_CHECK(2 == Consumed && 0 == Written);
+    KS_CHECK(false == KStringTranscoderProcess(&Transcoder, Astral + 2, 2, &Consumed, Output, 3, &Written));
+    KS_CHECK(true == KStringTranscoderProcess(&Transcoder, Astral + 2, 2, &Consumed, Output, sizeof(Output), &Written));
+    KS_CHECK(2 == Consumed && 4 == Written);
+}
+
+int main(void)
+{
+    KS_TestKnownAnswers();
+    KS_TestOddUtf16Byte();
+    KS_TestStaleValidatedFlag();
+    KS_TestTranscoderNoProgress();
+    return KS_TEST_RESULT();
+}
@@ -0,0 +1,108 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "KStringTest.h"
+
+//
+// CSV quoting across 64-byte classification blocks
+// Every shift of the leading field moves the quoted field (and its escaped quote pair) over a block boundary
+//
+
+#define KS_CSV_MAX_SHIFT 130
+
+static void KS_TestShift(const size_t Shift)
+{
+    static const char Quoted[] = "\"x\"\"y,z\nw\"";
+    static const char Tail[]   = ",end\n1,2,3\r\n\"q\"";
+    char              Input[KS_CSV_MAX_SHIFT + sizeof(Quoted) + sizeof(Tail) + 1];
+    char              Padding[KS_CSV_MAX_SHIFT];
+
+    memset(Padding, 'a', Shift);
+    memcpy(Input, Padding, Shift);
+    Input[Shift] = ',';
+    memcpy(Input + Shift + 1, Quoted, sizeof(Quoted) - 1);
+    memcpy(Input + Shift + sizeof(Quoted), Tail, sizeof(Tail) - 1);
+    size_t Size = Shift + sizeof(Quoted) + sizeof(Tail) - 1;
+
+    KStringCsvTable* pTable = KStringCsvParse(Input, Size, ',', '"');
+    KS_CHECK(NULL != pTable);
+    if (NULL == pTable)
+    {
+        return;
+    }
+
+    bool Matches = 3 == KStringCsvRowCount(pTable) && 3 == KStringCsvColumnCount(pTable) &&
+                   KS_TestBytesEqual(KStringCsvGet(pTable, 0, 0), Padding, Shift) && KS_TestBytesEqual(KStringCsvGet(pTable, 0, 1), "x\"y,z\nw", 7) &&
+                   KS_TestBytesEqual(KStringCsvGet(pTable, 0, 2), "end", 3) && KS_TestBytesEqual(KStringCsvGet(pTable, 1, 0), "1", 1) &&
+                   KS_TestBytesEqual(KStringCsvGet(pTable, 1, 2), "3", 1) && KS_TestBytesEqual(KStringCsvGet(pTable, 2, 0), "q", 1) &&
+                   KS_TestBytesEqual(KStringCsvGet(pTable, 2, 1), "", 0);
+    if (false == Matches)
+    {
+        fprintf(stderr, "shift %zu:\n", Shift);
+    }
+    KS_CHECK(Matches);
+
+    KStringCsvDestroy(pTable);
+}
+
+// A quoted field spanning several blocks full of delimiters and newlines stays one field
+static void KS_TestLongQuotedField(void)
+{
+    char Input[200];
+    Input[0] = '"';
+    for (size_t i = 1; i < sizeof(Input) - 3; i++)
+    {
+        Input[i] = (0 == i % 2) ? ',' : '\n';
+    }
+    Input[sizeof(Input) - 3] = '"';
+    Input[sizeof(Input) - 2] = ',';
+    Input[sizeof(Input) - 1] = 'b';
+
+    KStringCsvTable* pTable = KStringCsvParse(Input, sizeof(Input), ',', '"');
+    KS_CHECK(NULL != pTable);
+    if (NULL == pTable)
+    {
+        return;
+    }
+
+    KS_CHECK(1 == KStringCsvRowCount(pTable));
+    KS_CHECK(2 == KStringCsvColumnCount(pTable));
+    KS_CHECK(KS_TestBytesEqual(KStringCsvGet(pTable, 0, 0), Input + 1, sizeof(Input) - 4));
+    KS_CHECK(KS_TestBytesEqual(KStringCsvGet(pTable, 0, 1), "b", 1));
+
+    KStringCsvDestroy(pTable);
+}
+
+int main(void)
+{
+    for (size_t Shift = 0; Shift < KS_CSV_MAX_SHIFT; Shift++)
+    {
+        KS_TestShift(Shift);
+    }
+    KS_TestLongQuotedField();
+
+    return KS_TEST_RESULT();
+}
@@ -0,0 +1,90 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "KStringTest.h"
+
+//
+// Encoding detection known answers: byte order marks first, then NUL byte distribution, UTF-8 validity, ANSI
+//
+
+static void KS_TestDetect(const char* pData, const size_t Size, const KStringEncoding Expected, const size_t ExpectedBomSize)
+{
+    size_t BomSize = 99;
+    KS_CHECK(Expected == KStringDetectEncoding(pData, Size, &BomSize) && ExpectedBomSize == BomSize);
+}
+
+#define KS_DETECT(Data, Expected, BomSize) KS_TestDetect(Data, sizeof(Data) - 1, Expected, BomSize)
+
+static void KS_TestDetection(void)
+{
+    KS_DETECT("\xEF\xBB\xBFtext", KSTRING_ENCODING_UTF8, 3);
+    KS_DETECT("\xFF\xFEt\0", KSTRING_ENCODING_UTF16LE, 2);
+    KS_DETECT("\xFE\xFF\0t", KSTRING_ENCODING_UTF16BE, 2);
+
+    // Without a BOM: ASCII in UTF-16 has a NUL byte on one side of every unit (long enough for the SIMD count)
+    KS_DETECT("H\0e\0l\0l\0o\0,\0 \0w\0o\0r\0l\0d\0 \0\xE4\0!\0", KSTRING_ENCODING_UTF16LE, 0);
+    KS_DETECT("\0H\0e\0l\0l\0o\0,\0 \0w\0o\0r\0l\0d\0 \0\xE4\0!", KSTRING_ENCODING_UTF16BE, 0);
+    KS_DETECT("gr\xC3\xBC\xC3\x9F" "e", KSTRING_ENCODING_UTF8, 0);
+    KS_DETECT("gr\xFC\xDF" "e", KSTRING_ENCODING_ANSI, 0);
+    KS_DETECT("", KSTRING_ENCODING_UTF8, 0);
+
+    // A lone NUL does not make text UTF-16, an odd size never is
+    KS_DETECT("plain ascii text\0with one nul", KSTRING_ENCODING_UTF8, 0);
+    KS_DETECT("a\0b\0c", KSTRING_ENCODING_UTF8, 0);
+
+    size_t BomSize = 99;
+    KS_CHECK(KSTRING_ENCODING_UTF8 == KStringDetectEncoding(NULL, 4, &BomSize) && 0 == BomSize);
+}
+
+static void KS_TestCreate(void)
+{
+    // The BOM is not part of the string, transient strings view the input past it
+    static const char Utf16[] = "\xFF\xFEH\0e\0l\0l\0o\0 \0w\0o\0r\0l\0d\0";
+    KString           View    = KStringCreateTransientDetectEncoding(Utf16, sizeof(Utf16) - 1);
+    KS_CHECK(KSTRING_ENCODING_UTF16LE == KStringGetEncoding(View) && true == KS_TestBytesEqual(View, Utf16 + 2, sizeof(Utf16) - 3));
+    KS_CHECK(Utf16 + 2 == KStringData(&View, NULL));
+
+    // Copies own their payload, UTF-8 detected by validation (no BOM) is recorded as validated
+    static const char Utf8[] = "\xEF\xBB\xBF" "detected text \xE2\x82\xAC";
+    KString           Copy   = KStringCreateDetectEncoding(Utf8, sizeof(Utf8) - 1);
+    KS_CHECK(KSTRING_ENCODING_UTF8 == KStringGetEncoding(Copy) && true == KS_TestBytesEqual(Copy, Utf8 + 3, sizeof(Utf8) - 4));
+    KS_CHECK(false == KStringIsBorrowed(Copy));
+    KString Detected = KStringCreateDetectEncoding(Utf8 + 3, sizeof(Utf8) - 4);
+    KS_CHECK(true == KStringIsValidatedUtf8(Detected) && true == KStringEquals(Detected, Copy));
+
+    KString Ansi = KStringCreatePersistentDetectEncoding("Windows-1252 text \x80", 19);
+    KS_CHECK(KSTRING_ENCODING_ANSI == KStringGetEncoding(Ansi) && true == KStringIsBorrowed(Ansi));
+
+    KStringDestroy(Detected);
+    KStringDestroy(Copy);
+}
+
+int main(void)
+{
+    KS_TestDetection();
+    KS_TestCreate();
+    return KS_TEST_RESULT();
+}
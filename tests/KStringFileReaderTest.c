@@ -0,0 +1,168 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#if !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 200809L // mkstemp, ftruncate, ssize_t, off_t
+#endif
+
+#include "KStringTest.h"
+#include <stdlib.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <unistd.h>
+    #define KSTRING_TEST_TEMP_FILE 1
+#endif
+
+//
+// File reader iteration: line endings, records, and end of file versus a line beyond the regular size limit
+//
+
+#if defined(KSTRING_TEST_TEMP_FILE)
+
+// A line of zero bytes just beyond the regular size limit (1 GiB)
+#define KS_TEST_OVERSIZED_LINE ((size_t)1 << 30)
+
+// Create a temporary file holding Size bytes of pContent followed by Padding zero bytes (sparse)
+static bool KS_WriteTempFile(char* pPath, const char* pContent, const size_t Size, const size_t Padding)
+{
+    strcpy(pPath, "/tmp/kstring_test_XXXXXX");
+    int Fd = mkstemp(pPath);
+    if (Fd < 0)
+    {
+        return false;
+    }
+
+    bool Written = (ssize_t)Size == write(Fd, pContent, Size) && 0 == ftruncate(Fd, (off_t)(Size + Padding));
+    close(Fd);
+    if (false == Written)
+    {
+        unlink(pPath);
+    }
+    return Written;
+}
+
+static void KS_TestLines(void)
+{
+    static const char Content[] = "one\r\ntwo\n\nlast";
+    char              Path[32];
+    KS_CHECK(true == KS_WriteTempFile(Path, Content, sizeof(Content) - 1, 0));
+
+    KStringFileReader* pReader = KStringFileReaderOpen(Path);
+    unlink(Path);
+    KS_CHECK(NULL != pReader);
+    if (NULL == pReader)
+    {
+        return;
+    }
+
+    KString Line;
+    KS_CHECK(false == KStringFileReaderIsEof(pReader));
+    KS_CHECK(true == KStringFileReaderNextLine(pReader, &Line) && true == KS_TestBytesEqual(Line, "one", 3));
+    KS_CHECK(true == KStringFileReaderNextLine(pReader, &Line) && true == KS_TestBytesEqual(Line, "two", 3));
+    KS_CHECK(true == KStringFileReaderNextLine(pReader, &Line) && true == KS_TestBytesEqual(Line, "", 0));
+    KS_CHECK(true == KStringFileReaderNextLine(pReader, &Line) && true == KS_TestBytesEqual(Line, "last", 4));
+    KS_CHECK(false == KStringFileReaderNextLine(pReader, &Line));
+    KS_CHECK(true == KStringFileReaderIsEof(pReader));
+
+    // Records keep carriage returns, the last record runs to the end of the file
+    KStringFileReaderRewind(pReader);
+    KS_CHECK(false == KStringFileReaderIsEof(pReader));
+    KS_CHECK(true == KStringFileReaderNextRecord(pReader, '\n', &Line) && true == KS_TestBytesEqual(Line, "one\r", 4));
+    KS_CHECK(true == KStringFileReaderNextRecord(pReader, 'l', &Line) && true == KS_TestBytesEqual(Line, "two\n\n", 5));
+    KS_CHECK(true == KStringFileReaderNextRecord(pReader, 'l', &Line) && true == KS_TestBytesEqual(Line, "ast", 3));
+    KS_CHECK(false == KStringFileReaderNextRecord(pReader, 'l', &Line));
+    KS_CHECK(true == KStringFileReaderIsEof(pReader));
+
+    KStringFileReaderClose(pReader);
+}
+
+// Long lines are unterminated views into the mapping
+static void KS_TestLongLine(void)
+{
+    static const char Content[] = "a line beyond twelve bytes\nnext";
+    char              Path[32];
+    KS_CHECK(true == KS_WriteTempFile(Path, Content, sizeof(Content) - 1, 0));
+
+    KStringFileReader* pReader = KStringFileReaderOpen(Path);
+    unlink(Path);
+    KS_CHECK(NULL != pReader);
+    if (NULL == pReader)
+    {
+        return;
+    }
+
+    KString Line;
+    size_t  Size = 0;
+    KS_CHECK(true == KStringFileReaderNextLine(pReader, &Line) && NULL == KStringCStr(Line));
+    const char* pData = KStringData(&Line, &Size);
+    KS_CHECK(NULL != pData && 26 == Size && 0 == memcmp(pData, Content, 26));
+
+    KStringFileReaderClose(pReader);
+}
+
+// A line that cannot be viewed fails without moving the position and without reporting the end of the file
+static void KS_TestOversizedLine(void)
+{
+    char Path[32];
+    if (false == KS_WriteTempFile(Path, "a\n", 2, KS_TEST_OVERSIZED_LINE))
+    {
+        fprintf(stderr, "skipped: no room for a sparse %zu byte file\n", KS_TEST_OVERSIZED_LINE);
+        return;
+    }
+
+    KStringFileReader* pReader = KStringFileReaderOpen(Path);
+    unlink(Path);
+    if (NULL == pReader)
+    {
+        fprintf(stderr, "skipped: cannot map a %zu byte file\n", KS_TEST_OVERSIZED_LINE);
+        return;
+    }
+
+    KString Line;
+    KS_CHECK(true == KStringFileReaderNextLine(pReader, &Line) && true == KS_TestBytesEqual(Line, "a", 1));
+    KS_CHECK(false == KStringFileReaderNextLine(pReader, &Line));
+    KS_CHECK(false == KStringFileReaderIsEof(pReader));
+    KS_CHECK(2 == KStringFileReaderPosition(pReader));
+    KS_CHECK(false == KStringFileReaderNextRecord(pReader, '\n', &Line));
+    KS_CHECK(false == KStringFileReaderIsEof(pReader));
+
+    KStringFileReaderClose(pReader);
+}
+
+#endif
+
+int main(void)
+{
+    KS_CHECK(true == KStringFileReaderIsEof(NULL));
+
+#if defined(KSTRING_TEST_TEMP_FILE)
+    KS_TestLines();
+    KS_TestLongLine();
+    KS_TestOversizedLine();
+#endif
+
+    return KS_TEST_RESULT();
+}
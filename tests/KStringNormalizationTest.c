@@ -0,0 +1,113 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "KStringTest.h"
+
+//
+// Normalization known answers (Unicode 14.0, cross-checked against Python unicodedata)
+//
+
+typedef struct KS_NormalizationCase
+{
+    const char* pName;
+    const char* pInput;
+    const char* pNfc;
+    const char* pNfd;
+} KS_NormalizationCase;
+
+static const KS_NormalizationCase KS_Cases[] = {
+    // Canonical reordering: dot below (ccc 220) moves before dot above (ccc 230), then composes with d
+    {"U+1E0B U+0323", "\xE1\xB8\x8B\xCC\xA3", "\xE1\xB8\x8D\xCC\x87", "d\xCC\xA3\xCC\x87"},
+    // Hangul LV syllable + trailing consonant composes algorithmically
+    {"U+AC00 U+11A8", "\xEA\xB0\x80\xE1\x86\xA8", "\xEA\xB0\x81", "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8"},
+    // Hangul leading + vowel jamo compose to the LV syllable
+    {"U+1100 U+1161", "\xE1\x84\x80\xE1\x85\xA1", "\xEA\xB0\x80", "\xE1\x84\x80\xE1\x85\xA1"},
+    // Composition exclusion: combining Greek dialytika tonos never recomposes
+    {"U+0344", "\xCD\x84", "\xCC\x88\xCC\x81", "\xCC\x88\xCC\x81"},
+    // Singleton decomposition: Angstrom sign becomes A with ring above
+    {"U+212B", "\xE2\x84\xAB", "\xC3\x85", "A\xCC\x8A"},
+    // Long input (not inline) with the reordering case at the end
+    {"long U+1E0B U+0323",
+     "normalization of a long string \xE1\xB8\x8B\xCC\xA3",
+     "normalization of a long string \xE1\xB8\x8D\xCC\x87",
+     "normalization of a long string d\xCC\xA3\xCC\x87"},
+};
+
+static void KS_TestForm(const KS_NormalizationCase* pCase, const KStringEncoding Encoding)
+{
+    KString Utf8   = KStringCreate(pCase->pInput, strlen(pCase->pInput));
+    KString Input  = (KSTRING_ENCODING_UTF8 == Encoding) ? Utf8 : KStringConvertToEncoding(Utf8, Encoding);
+    KString Nfc    = KStringNormalizeNFC(Input);
+    KString Nfd    = KStringNormalizeNFD(Input);
+    KString NfcOut = (KSTRING_ENCODING_UTF8 == Encoding) ? Nfc : KStringConvertToEncoding(Nfc, KSTRING_ENCODING_UTF8);
+    KString NfdOut = (KSTRING_ENCODING_UTF8 == Encoding) ? Nfd : KStringConvertToEncoding(Nfd, KSTRING_ENCODING_UTF8);
+
+    bool NfcMatches = KS_TestBytesEqual(NfcOut, pCase->pNfc, strlen(pCase->pNfc));
+    bool NfdMatches = KS_TestBytesEqual(NfdOut, pCase->pNfd, strlen(pCase->pNfd));
+    if (false == NfcMatches || false == NfdMatches)
+    {
+        fprintf(stderr, "case %s (encoding %d):\n", pCase->pName, (int)Encoding);
+    }
+    KS_CHECK(NfcMatches);
+    KS_CHECK(NfdMatches);
+    KS_CHECK(KStringGetEncoding(Nfc) == Encoding);
+    KS_CHECK(KStringGetEncoding(Nfd) == Encoding);
+
+    // Results are normalized, the input only if it already matched
+    KS_CHECK(KStringIsNormalized(Nfc, KSTRING_NORMALIZATION_NFC));
+    KS_CHECK(KStringIsNormalized(Nfd, KSTRING_NORMALIZATION_NFD));
+    KS_CHECK(KStringIsNormalized(Input, KSTRING_NORMALIZATION_NFC) == (0 == strcmp(pCase->pInput, pCase->pNfc)));
+    KS_CHECK(KStringIsNormalized(Input, KSTRING_NORMALIZATION_NFD) == (0 == strcmp(pCase->pInput, pCase->pNfd)));
+
+    if (KSTRING_ENCODING_UTF8 != Encoding)
+    {
+        KStringDestroy(NfcOut);
+        KStringDestroy(NfdOut);
+        KStringDestroy(Input);
+    }
+    KStringDestroy(Nfc);
+    KStringDestroy(Nfd);
+    KStringDestroy(Utf8);
+}
+
+int main(void)
+{
+    for (size_t i = 0; i < sizeof(KS_Cases) / sizeof(KS_Cases[0]); i++)
+    {
+        KS_TestForm(&KS_Cases[i], KSTRING_ENCODING_UTF8);
+        KS_TestForm(&KS_Cases[i], KSTRING_ENCODING_UTF16LE);
+        KS_TestForm(&KS_Cases[i], KSTRING_ENCODING_UTF16BE);
+    }
+
+    // Invalid bytes pass through unchanged
+    KString Invalid = KStringCreate("a\xFF" "b", 3);
+    KString Nfc     = KStringNormalizeNFC(Invalid);
+    KS_CHECK(KS_TestBytesEqual(Nfc, "a\xFF" "b", 3));
+    KStringDestroy(Nfc);
+    KStringDestroy(Invalid);
+
+    return KS_TEST_RESULT();
+}
@@ -0,0 +1,97 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "KStringTest.h"
+
+//
+// Relocatable strings: resolution through the region registry, and failure instead of a NULL read
+// once the region is gone or smaller than the string
+//
+
+#define KS_TEST_REGION 11
+
+static const char KS_Heap[] = "header..relocatable string number one|relocatable string number two";
+
+int main(void)
+{
+    KS_CHECK(KStringRegisterRegion(KS_TEST_REGION, KS_Heap, sizeof(KS_Heap)));
+    KString One   = KStringCreateRelocatable(KS_TEST_REGION, 8, 29);
+    KString Two   = KStringCreateRelocatable(KS_TEST_REGION, 38, 29);
+    KString Short = KStringCreateRelocatable(KS_TEST_REGION, 0, 6);
+
+    // Registered: relocatable strings behave like any other string
+    KS_CHECK(KStringIsRelocatable(One) && false == KStringIsRelocatable(Short));
+    KS_CHECK(KS_TestBytesEqual(One, "relocatable string number one", 29));
+    KS_CHECK(KS_TestBytesEqual(Short, "header", 6));
+
+    uint8_t RegionId = 0;
+    size_t  Offset   = 0;
+    KS_CHECK(KStringGetRelocation(Two, &RegionId, &Offset) && KS_TEST_REGION == RegionId && 38 == Offset);
+
+    KString View = KStringSubstringView(One, 12, 17);
+    KS_CHECK(KStringIsRelocatable(View) && KS_TestBytesEqual(View, "string number one", 17));
+
+    // Ranges beyond the region are refused at creation
+    KS_CHECK(false == KStringIsValid(KStringCreateRelocatable(KS_TEST_REGION, 60, 20)));
+
+    // Shrinking the region leaves Two beyond its end, unregistering strands every long string
+    KS_CHECK(KStringRegisterRegion(KS_TEST_REGION, KS_Heap, 40));
+    KS_CHECK(false == KStringIsValid(KStringSubstring(Two, 0, 20)));
+    KS_CHECK(KS_TestBytesEqual(KStringSubstring(One, 0, 11), "relocatable", 11));
+    KStringUnregisterRegion(KS_TEST_REGION);
+
+    const KString Parts[2] = {Short, One};
+    KString       Slices[4];
+    KStringArena* pArena = KStringArenaCreate(0);
+    KString       Batch[2];
+    char          Buffer[64];
+    size_t        Written = 0;
+
+    KS_CHECK(false == KStringIsValid(KStringConcatN(Parts, 2)));
+    KS_CHECK(false == KStringIsValid(KStringJoin(Parts, 2, KStringCreate(",", 1))));
+    KS_CHECK(false == KStringIsValid(KStringSubstring(One, 0, 20)));
+    KS_CHECK(false == KStringIsValid(KStringSubstringView(One, 0, 20)));
+    KS_CHECK(0 == KStringSplitInto(One, KStringCreate(" ", 1), Slices, 4));
+    KS_CHECK(false == KStringIsValid(KStringConvertToEncoding(One, KSTRING_ENCODING_UTF16LE)));
+    KS_CHECK(false == KStringIsValid(KStringConvertToEncoding(One, KSTRING_ENCODING_UTF8)));
+    KS_CHECK(0 == KStringConvertedSize(One, KSTRING_ENCODING_UTF16BE));
+    KS_CHECK(false == KStringConvertInto(One, KSTRING_ENCODING_ANSI, Buffer, sizeof(Buffer), &Written));
+    KS_CHECK(KStringConvertBatch(Parts, 2, KSTRING_ENCODING_UTF16LE, pArena, Batch));
+    KS_CHECK(KStringIsValid(Batch[0]) && false == KStringIsValid(Batch[1]));
+    KS_CHECK(false == KStringIsValid(KStringConcatWithEncoding(Short, One, KSTRING_ENCODING_UTF16LE)));
+    KS_CHECK(false == KStringIsValid(KStringToUpper(One)));
+    KS_CHECK(false == KStringIsValid(KStringNormalizeNFC(One)));
+    KS_CHECK(0 == KStringCopyTo(One, 0, Buffer, sizeof(Buffer)));
+    KS_CHECK(NULL == KStringCStr(One));
+    KS_CHECK(-1 == KStringByteAt(One, 0));
+    KS_CHECK(false == KStringEquals(One, Two) && false == KStringStartsWith(One, KStringCreate("relocatable", 11)));
+
+    // Short strings are inline and never depend on the region
+    KS_CHECK(KS_TestBytesEqual(Short, "header", 6));
+
+    KStringArenaDestroy(pArena);
+    return KS_TEST_RESULT();
+}
@@ -0,0 +1,127 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "KStringTest.h"
+#include <stdio.h>
+
+//
+// Rope known answers: a rope built from many appends reads, slices and compares like its flat copy
+//
+
+#define KS_TEST_LINES     1000
+#define KS_TEST_LINE_SIZE 10
+
+static char KS_Expected[KS_TEST_LINES * KS_TEST_LINE_SIZE + 1];
+
+// Append "line NNNN\n" lines one at a time
+static KString KS_BuildRope(void)
+{
+    KString Rope = KStringCreate("", 0);
+    for (unsigned i = 0; i < KS_TEST_LINES; ++i)
+    {
+        char* pLine = KS_Expected + i * KS_TEST_LINE_SIZE;
+        snprintf(pLine, KS_TEST_LINE_SIZE + 1, "line %04u\n", i % 10000);
+
+        KString Line = KStringCreate(pLine, KS_TEST_LINE_SIZE);
+        KString Next = KStringRopeConcat(Rope, Line);
+        KStringDestroy(Line);
+        KStringDestroy(Rope);
+        Rope = Next;
+    }
+
+    return Rope;
+}
+
+static void KS_TestReads(const KString Rope)
+{
+    const size_t Size = sizeof(KS_Expected) - 1;
+    KS_CHECK(true == KStringIsRope(Rope) && Size == KStringSize(Rope));
+    KS_CHECK('l' == KStringByteAt(Rope, 0) && '7' == KStringByteAt(Rope, 7 * KS_TEST_LINE_SIZE + 8) && '\n' == KStringByteAt(Rope, Size - 1));
+    KS_CHECK(-1 == KStringByteAt(Rope, Size));
+
+    // Chunks cover the payload in order without flattening
+    size_t      Offset = 0;
+    size_t      ChunkSize;
+    const char* pChunk;
+    bool        Matches = true;
+    for (; NULL != (pChunk = KStringGetChunk(&Rope, Offset, &ChunkSize)); Offset += ChunkSize)
+    {
+        Matches = Matches && 0 != ChunkSize && Offset + ChunkSize <= Size && 0 == memcmp(pChunk, KS_Expected + Offset, ChunkSize);
+    }
+    KS_CHECK(true == Matches && Size == Offset && true == KStringIsRope(Rope));
+
+    char Buffer[64];
+    KS_CHECK(sizeof(Buffer) == KStringCopyTo(Rope, 4321, Buffer, sizeof(Buffer)) && 0 == memcmp(Buffer, KS_Expected + 4321, sizeof(Buffer)));
+}
+
+static void KS_TestSlicesAndComparisons(const KString Rope)
+{
+    const size_t Size = sizeof(KS_Expected) - 1;
+
+    KString Slice = KStringSubstring(Rope, 995, 30);
+    KS_CHECK(true == KS_TestBytesEqual(Slice, KS_Expected + 995, 30));
+    KStringDestroy(Slice);
+
+    KString Flat = KStringCreate(KS_Expected, Size);
+    KS_CHECK(true == KStringEquals(Rope, Flat) && 0 == KStringCompare(Rope, Flat) && 0 == KStringCompare(Flat, Rope));
+    KS_CHECK(true == KStringStartsWith(Rope, KStringSubstring(Flat, 0, 12)));
+
+    // A difference in the last line orders the strings
+    KS_Expected[Size - 2] = '0';
+    KString Smaller = KStringCreate(KS_Expected, Size);
+    KS_Expected[Size - 2] = '9';
+    KS_CHECK(false == KStringEquals(Rope, Smaller) && KStringCompare(Rope, Smaller) > 0 && KStringCompare(Smaller, Rope) < 0);
+
+    // Appending to a rope keeps it a rope
+    KString Longer = KStringConcat(Rope, Flat);
+    KS_CHECK(true == KStringIsRope(Longer) && 2 * Size == KStringSize(Longer));
+    KS_CHECK('l' == KStringByteAt(Longer, Size) && '9' == KStringByteAt(Longer, 2 * Size - 2));
+
+    KStringDestroy(Longer);
+    KStringDestroy(Smaller);
+    KStringDestroy(Flat);
+}
+
+static void KS_TestFlatten(const KString Rope)
+{
+    const size_t Size  = sizeof(KS_Expected) - 1;
+    const char*  pFlat = KStringCStr(Rope);
+    KS_CHECK(NULL != pFlat && 0 == strcmp(pFlat, KS_Expected));
+
+    // Flattened once, cached for every later access
+    size_t DataSize = 0;
+    KS_CHECK(pFlat == KStringData(&Rope, &DataSize) && Size == DataSize && pFlat == KStringCStr(Rope));
+}
+
+int main(void)
+{
+    KString Rope = KS_BuildRope();
+    KS_TestReads(Rope);
+    KS_TestSlicesAndComparisons(Rope);
+    KS_TestFlatten(Rope);
+    KStringDestroy(Rope);
+    return KS_TEST_RESULT();
+}
@@ -0,0 +1,263 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#if !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 200809L // shm_open, ftruncate
+#endif
+
+#include "KStringTest.h"
+#include <stdlib.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #define KSTRING_TEST_SHARED_MEMORY 1
+#endif
+
+//
+// Shared table attach validation: a forged table must be rejected before its entries are handed out
+//
+
+#if defined(KSTRING_TEST_SHARED_MEMORY)
+
+#define KS_TEST_REGION       5
+#define KS_TEST_OTHER_REGION 6
+
+typedef enum KS_Forgery
+{
+    KS_FORGERY_NONE,             // Untouched copy (must attach)
+    KS_FORGERY_WRAPPING_HEADER,  // Entry offset and count chosen to wrap the bounds arithmetic
+    KS_FORGERY_ENTRIES_PAST_END, // Entry offset beyond the region
+    KS_FORGERY_PERSISTENT,       // Entry pointing at process memory
+    KS_FORGERY_TEMPORARY,        // Entry that KStringDestroy would free
+    KS_FORGERY_OTHER_REGION,     // Entry resolving against another region
+    KS_FORGERY_PAST_HEAP,        // Entry offset beyond the heap
+    KS_FORGERY_TOO_LONG,         // Entry size running past the heap
+    KS_FORGERY_VALIDATED_FLAG,   // Entry claiming validated UTF-8 for a heap that is not
+    KS_FORGERY_RESERVED_BITS,    // Entry with bits set between the region id and the flags
+    KS_FORGERY_COUNT
+} KS_Forgery;
+
+static char KS_Name[64];
+
+// Write an image into a new named shared memory object
+static bool KS_Publish(const void* pImage, const size_t Size)
+{
+    int Fd = shm_open(KS_Name, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (Fd < 0)
+    {
+        return false;
+    }
+
+    void* pMapping = MAP_FAILED;
+    if (0 == ftruncate(Fd, (off_t)Size))
+    {
+        pMapping = mmap(NULL, Size, PROT_READ | PROT_WRITE, MAP_SHARED, Fd, 0);
+    }
+    close(Fd);
+
+    if (MAP_FAILED == pMapping)
+    {
+        shm_unlink(KS_Name);
+        return false;
+    }
+
+    memcpy(pMapping, pImage, Size);
+    munmap(pMapping, Size);
+    return true;
+}
+
+static void KS_Forge(char* pImage, const KS_Forgery Forgery)
+{
+    KStringSharedTableHeader* pHeader  = (KStringSharedTableHeader*)pImage;
+    KString*                  pEntries = (KString*)(pImage + pHeader->EntriesOffset);
+
+    switch (Forgery)
+    {
+        case KS_FORGERY_WRAPPING_HEADER:
+            pHeader->EntriesOffset = (uint64_t)1 << 63;
+            pHeader->Count         = (uint64_t)1 << 59;
+            pHeader->HeapOffset    = 0;
+            break;
+        case KS_FORGERY_ENTRIES_PAST_END:
+            pHeader->EntriesOffset = (pHeader->TotalSize + 31) & ~(uint64_t)15;
+            pHeader->Count         = 0;
+            break;
+        case KS_FORGERY_PERSISTENT:
+            pEntries[1] = KStringCreatePersistent("persistent pointer entry", 24);
+            break;
+        case KS_FORGERY_TEMPORARY:
+            // Only the bit pattern is copied, the allocation itself is released below
+            pEntries[1] = KStringCreate("temporary pointer entry!", 24);
+            KStringDestroy(pEntries[1]);
+            break;
+        case KS_FORGERY_OTHER_REGION:
+            KStringRegisterRegion(KS_TEST_OTHER_REGION, pImage, pHeader->TotalSize);
+            pEntries[1] = KStringCreateRelocatable(KS_TEST_OTHER_REGION, pHeader->HeapOffset, 20);
+            KStringUnregisterRegion(KS_TEST_OTHER_REGION);
+            break;
+        case KS_FORGERY_PAST_HEAP:
+            pEntries[1].LongStr.PtrAndClass += pHeader->HeapSize;
+            break;
+        case KS_FORGERY_TOO_LONG:
+            pEntries[1].Size = (pEntries[1].Size & KSTRING_ENCODING_MASK) | (uint32_t)(pHeader->HeapSize + 1);
+            break;
+        case KS_FORGERY_VALIDATED_FLAG:
+            // Invalid UTF-8 under the flag would let the transcoders skip validation
+            memset(pImage + pHeader->HeapOffset + 6, 0x80, 19);
+            pEntries[1].LongStr.PtrAndClass |= (uint64_t)1 << 61;
+            break;
+        case KS_FORGERY_RESERVED_BITS:
+            pEntries[1].LongStr.PtrAndClass |= (uint64_t)0xF << 56;
+            break;
+        default:
+            break;
+    }
+}
+
+// Ropes are copied without flattening, payloads that cannot be resolved fail the whole table
+static void KS_TestCreateInputs(void)
+{
+    KString Left  = KStringCreate("rope left part, ", 16);
+    KString Right = KStringCreate("rope right part", 15);
+    KString Rope  = KStringRopeConcat(Left, Right);
+    KS_CHECK(true == KStringIsRope(Rope));
+
+    KStringSharedTable* pTable = KStringSharedTableCreate(NULL, KS_TEST_REGION, &Rope, 1);
+    KS_CHECK(NULL != pTable);
+    if (NULL != pTable)
+    {
+        KS_CHECK(KStringEquals(KStringSharedTableGet(pTable, 0), Rope));
+        KStringSharedTableClose(pTable);
+    }
+
+    static const char Buffer[] = "relocatable payload of a region that is gone";
+    KStringRegisterRegion(KS_TEST_OTHER_REGION, Buffer, sizeof(Buffer));
+    KString Orphan = KStringCreateRelocatable(KS_TEST_OTHER_REGION, 0, sizeof(Buffer) - 1);
+    KStringUnregisterRegion(KS_TEST_OTHER_REGION);
+
+    KS_CHECK(NULL == KStringSharedTableCreate(KS_Name, KS_TEST_REGION, &Orphan, 1));
+    KS_CHECK(false == KStringSharedTableUnlink(KS_Name)); // Failed create leaves no object behind
+
+    KStringDestroy(Rope);
+    KStringDestroy(Right);
+    KStringDestroy(Left);
+}
+
+int main(void)
+{
+    snprintf(KS_Name, sizeof(KS_Name), "/kstring_test_%ld", (long)getpid());
+
+    const KString Strings[3] = {
+        KStringCreate("short", 5),
+        KStringCreate("a long string in the heap", 25),
+        KStringCreate("another long string", 19),
+    };
+
+    KS_TestCreateInputs();
+
+    // Build a genuine table and keep a private copy of its image
+    KStringSharedTable* pTable = KStringSharedTableCreate(KS_Name, KS_TEST_REGION, Strings, 3);
+    KS_CHECK(NULL != pTable);
+    if (NULL == pTable)
+    {
+        return KS_TEST_RESULT();
+    }
+
+    // A second table cannot claim the same region id
+    KS_CHECK(NULL == KStringSharedTableCreate(NULL, KS_TEST_REGION, Strings, 1));
+    KS_CHECK(NULL == KStringSharedTableAttachFd(KStringSharedTableGetFd(pTable)));
+
+    struct stat Info;
+    size_t      Size     = 0;
+    void*       pMapping = MAP_FAILED;
+    if (0 == fstat(KStringSharedTableGetFd(pTable), &Info))
+    {
+        Size     = (size_t)Info.st_size;
+        pMapping = mmap(NULL, Size, PROT_READ, MAP_SHARED, KStringSharedTableGetFd(pTable), 0);
+    }
+    KS_CHECK(MAP_FAILED != pMapping);
+    if (MAP_FAILED == pMapping)
+    {
+        KStringSharedTableClose(pTable);
+        KStringSharedTableUnlink(KS_Name);
+        return KS_TEST_RESULT();
+    }
+
+    char* pImage = malloc(Size);
+    char* pCopy  = malloc(Size);
+    if (NULL != pImage)
+    {
+        memcpy(pImage, pMapping, Size);
+    }
+    munmap(pMapping, Size);
+    KStringSharedTableClose(pTable);
+    KStringSharedTableUnlink(KS_Name);
+
+    KS_CHECK(NULL != pImage && NULL != pCopy);
+    for (int Forgery = KS_FORGERY_NONE; NULL != pImage && NULL != pCopy && Forgery < KS_FORGERY_COUNT; Forgery++)
+    {
+        memcpy(pCopy, pImage, Size);
+        KS_Forge(pCopy, (KS_Forgery)Forgery);
+        KS_CHECK(KS_Publish(pCopy, Size));
+
+        KStringSharedTable* pAttached = KStringSharedTableAttach(KS_Name);
+        if ((KS_FORGERY_NONE == Forgery) != (NULL != pAttached))
+        {
+            fprintf(stderr, "forgery %d:\n", Forgery);
+        }
+        KS_CHECK((KS_FORGERY_NONE == Forgery) == (NULL != pAttached));
+
+        if (NULL != pAttached)
+        {
+            KS_CHECK(3 == KStringSharedTableCount(pAttached));
+            KS_CHECK(KStringEquals(KStringSharedTableGet(pAttached, 1), Strings[1]));
+            KStringSharedTableClose(pAttached);
+        }
+        KStringSharedTableUnlink(KS_Name);
+    }
+
+    free(pCopy);
+    free(pImage);
+    for (size_t i = 0; i < 3; i++)
+    {
+        KStringDestroy(Strings[i]);
+    }
+
+    return KS_TEST_RESULT();
+}
+
+#else
+
+int main(void)
+{
+    // No POSIX shared memory on this platform: nothing to validate
+    return 0;
+}
+
+#endif
@@ -0,0 +1,134 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "KStringTest.h"
+
+//
+// Zero-copy slices: substring views and split slices keep their bytes in the source,
+// KStringCStr only hands out terminated payloads while KStringData reads every string
+//
+
+static const char KS_Source[] = "alpha-bravo-charlie,delta-echo-foxtrot,golf";
+
+static void KS_TestSplit(void)
+{
+    KString Source    = KStringCreate(KS_Source, sizeof(KS_Source) - 1);
+    KString Delimiter = KStringCreate(",", 1);
+    KString Slices[4];
+    KS_CHECK(3 == KStringSplitInto(Source, Delimiter, Slices, 4));
+    KS_CHECK(true == KS_TestBytesEqual(Slices[0], "alpha-bravo-charlie", 19));
+    KS_CHECK(true == KS_TestBytesEqual(Slices[1], "delta-echo-foxtrot", 18));
+    KS_CHECK(true == KS_TestBytesEqual(Slices[2], "golf", 4));
+
+    // Long slices ending before the source are unterminated, short slices are inline copies
+    size_t Size = 0;
+    KS_CHECK(true == KStringIsBorrowed(Slices[0]) && NULL == KStringCStr(Slices[0]) && NULL == KStringCStr(Slices[1]));
+    KS_CHECK(KStringData(&Slices[0], &Size) == KStringData(&Source, NULL) && 19 == Size);
+    KS_CHECK(0 == strcmp("golf", KStringCStr(Slices[2])));
+    KS_CHECK(0 == memcmp("golf", KStringData(&Slices[2], &Size), 4) && 4 == Size);
+
+    // Iterator form, stopping early and at a trailing delimiter
+    KStringSplitIterator Iterator;
+    KString              Slice;
+    KString              Trailing = KStringCreate("one,,two,", 9);
+    KStringSplitBegin(&Iterator, Trailing, Delimiter);
+    KS_CHECK(true == KStringSplitNext(&Iterator, &Slice) && true == KS_TestBytesEqual(Slice, "one", 3));
+    KS_CHECK(true == KStringSplitNext(&Iterator, &Slice) && true == KS_TestBytesEqual(Slice, "", 0));
+    KS_CHECK(true == KStringSplitNext(&Iterator, &Slice) && true == KS_TestBytesEqual(Slice, "two", 3));
+    KS_CHECK(true == KStringSplitNext(&Iterator, &Slice) && true == KS_TestBytesEqual(Slice, "", 0));
+    KS_CHECK(false == KStringSplitNext(&Iterator, &Slice));
+
+    // Multi-byte delimiter
+    KString Dash = KStringCreate("o-", 2);
+    KS_CHECK(3 == KStringSplitInto(Source, Dash, Slices, 4));
+    KS_CHECK(true == KS_TestBytesEqual(Slices[0], "alpha-brav", 10));
+    KS_CHECK(true == KS_TestBytesEqual(Slices[1], "charlie,delta-ech", 17));
+    KS_CHECK(true == KS_TestBytesEqual(Slices[2], "foxtrot,golf", 12));
+
+    KStringDestroy(Trailing);
+    KStringDestroy(Source);
+}
+
+static void KS_TestSubstringView(void)
+{
+    KString Source = KStringCreate(KS_Source, sizeof(KS_Source) - 1);
+
+    // A view running to the end of a terminated payload is terminated as well
+    KString Tail = KStringSubstringView(Source, 20, 100);
+    KS_CHECK(true == KS_TestBytesEqual(Tail, "delta-echo-foxtrot,golf", 23));
+    KS_CHECK(NULL != KStringCStr(Tail) && 0 == strcmp("delta-echo-foxtrot,golf", KStringCStr(Tail)));
+
+    // Views ending inside the payload, and views of those, are not
+    KString Inner = KStringSubstringView(Source, 6, 24);
+    KString Nested = KStringSubstringView(Inner, 6, 100);
+    KS_CHECK(true == KS_TestBytesEqual(Inner, "bravo-charlie,delta-echo", 24));
+    KS_CHECK(true == KS_TestBytesEqual(Nested, "charlie,delta-echo", 18));
+    KS_CHECK(NULL == KStringCStr(Inner) && NULL == KStringCStr(Nested));
+
+    size_t Size = 0;
+    KS_CHECK(KStringData(&Nested, &Size) == KStringData(&Source, NULL) + 12 && 18 == Size);
+
+    // Copies own a terminated payload again
+    KString Copy = KStringSubstring(Inner, 0, 100);
+    KS_CHECK(NULL != KStringCStr(Copy) && 0 == strcmp("bravo-charlie,delta-echo", KStringCStr(Copy)));
+    KStringDestroy(Copy);
+
+    // Caller-created views of unterminated bytes
+    KString View = KStringCreateTransientView(KS_Source, 13);
+    KS_CHECK(true == KS_TestBytesEqual(View, "alpha-bravo-c", 13) && NULL == KStringCStr(View));
+    KS_CHECK(KS_Source == KStringData(&View, &Size) && 13 == Size);
+
+    KStringDestroy(Source);
+}
+
+static void KS_TestData(void)
+{
+    size_t Size = 1;
+    KString Invalid = KStringInvalid();
+    KS_CHECK(NULL == KStringData(&Invalid, &Size) && 0 == Size);
+    KS_CHECK(NULL == KStringData(NULL, &Size));
+
+    // Ropes are flattened once
+    KString Left  = KStringCreate("0123456789abcdef", 16);
+    KString Right = KStringCreate("ghijklmnopqrstuv", 16);
+    KString Rope  = KStringRopeConcat(Left, Right);
+    KS_CHECK(true == KStringIsRope(Rope));
+    const char* pData = KStringData(&Rope, &Size);
+    KS_CHECK(NULL != pData && 32 == Size && 0 == memcmp(pData, "0123456789abcdefghijklmnopqrstuv", 32));
+    KS_CHECK(pData == KStringData(&Rope, NULL) && pData == KStringCStr(Rope));
+
+    KStringDestroy(Rope);
+    KStringDestroy(Right);
+    KStringDestroy(Left);
+}
+
+int main(void)
+{
+    KS_TestSplit();
+    KS_TestSubstringView();
+    KS_TestData();
+    return KS_TEST_RESULT();
+}
@@ -0,0 +1,61 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef KSTRING_TEST_H
+#define KSTRING_TEST_H
+
+#include "KString.h"
+#include <stdio.h>
+#include <string.h>
+
+//
+// Minimal test harness shared by the known-answer tests
+// KS_CHECK reports failures and keeps going, KS_TEST_RESULT turns the count into the exit code
+//
+
+static int KS_TestFailures = 0;
+
+#define KS_CHECK(Condition)                                                               \
+    do                                                                                    \
+    {                                                                                     \
+        if (!(Condition))                                                                 \
+        {                                                                                 \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            KS_TestFailures++;                                                            \
+        }                                                                                 \
+    } while (0)
+
+#define KS_TEST_RESULT() ((0 == KS_TestFailures) ? 0 : 1)
+
+// Check that a string holds exactly the expected bytes
+static inline bool KS_TestBytesEqual(const KString Str, const char* pExpected, const size_t Size)
+{
+    char Buffer[256];
+    return true == KStringIsValid(Str) && Size == KStringSize(Str) && Size <= sizeof(Buffer) && Size == KStringCopyTo(Str, 0, Buffer, sizeof(Buffer)) &&
+           0 == memcmp(Buffer, pExpected, Size);
+}
+
+#endif // KSTRING_TEST_H
@@ -0,0 +1,126 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "KStringTest.h"
+
+//
+// UTF-8 validation known answers (Unicode Table 3-7) and the recorded validation state
+//
+
+// Valid input must pass and invalid input must fail wherever it sits relative to the 64-byte ASCII blocks
+static bool KS_ValidateAt(const char* pSequence, const size_t SequenceSize, const size_t Offset)
+{
+    char Buffer[160];
+    memset(Buffer, 'a', sizeof(Buffer));
+    memcpy(Buffer + Offset, pSequence, SequenceSize);
+
+    KString Str = KStringCreate(Buffer, Offset + SequenceSize + 3);
+    bool    Valid = KStringValidateUtf8(&Str);
+    KStringDestroy(Str);
+    return Valid;
+}
+
+static void KS_TestSequences(void)
+{
+    static const struct
+    {
+        const char* pSequence;
+        bool        Valid;
+    } Cases[] = {
+        {"\xC2\x80", true},          // U+0080
+        {"\xDF\xBF", true},          // U+07FF
+        {"\xE0\xA0\x80", true},      // U+0800
+        {"\xED\x9F\xBF", true},      // U+D7FF
+        {"\xEE\x80\x80", true},      // U+E000
+        {"\xF0\x90\x80\x80", true},  // U+10000
+        {"\xF4\x8F\xBF\xBF", true},  // U+10FFFF
+        {"\x80", false},             // Lone continuation byte
+        {"\xC0\x80", false},         // Overlong NUL
+        {"\xC1\xBF", false},         // Overlong ASCII
+        {"\xE0\x9F\xBF", false},     // Overlong U+07FF
+        {"\xED\xA0\x80", false},     // Surrogate U+D800
+        {"\xED\xBF\xBF", false},     // Surrogate U+DFFF
+        {"\xF0\x8F\xBF\xBF", false}, // Overlong U+FFFF
+        {"\xF4\x90\x80\x80", false}, // Beyond U+10FFFF
+        {"\xF5\x80\x80\x80", false}, // Invalid lead byte
+        {"\xE2\x82", false},         // Truncated sequence
+    };
+
+    for (size_t i = 0; i < sizeof(Cases) / sizeof(Cases[0]); ++i)
+    {
+        size_t Size    = strlen(Cases[i].pSequence);
+        bool   Matches = true;
+        for (size_t Offset = 0; Offset <= 140; ++Offset)
+        {
+            Matches = Matches && Cases[i].Valid == KS_ValidateAt(Cases[i].pSequence, Size, Offset);
+        }
+        KS_CHECK(true == Matches);
+    }
+
+    // A sequence cut off by the end of the string
+    KString Truncated = KStringCreate("0123456789abc\xE2\x82", 15);
+    KS_CHECK(false == KStringValidateUtf8(&Truncated));
+    KStringDestroy(Truncated);
+}
+
+static void KS_TestState(void)
+{
+    static const char Text[] = "validated text with \xC3\xA4 and \xE2\x82\xAC";
+
+    // Long strings remember a successful validation, short strings are checked on the fly
+    KString Long = KStringCreate(Text, sizeof(Text) - 1);
+    KS_CHECK(false == KStringIsValidatedUtf8(Long));
+    KS_CHECK(true == KStringValidateUtf8(&Long) && true == KStringIsValidatedUtf8(Long));
+
+    KString Short = KStringCreate("\xC3\xA4", 2);
+    KString Bad   = KStringCreate("\xC3", 1);
+    KS_CHECK(true == KStringIsValidatedUtf8(Short) && false == KStringIsValidatedUtf8(Bad));
+
+    // Concatenating validated strings keeps the state
+    KString Joined = KStringConcat(Long, Long);
+    KS_CHECK(true == KStringIsValidatedUtf8(Joined));
+
+    // Validated constructors fail without creating a string
+    KS_CHECK(false == KStringIsValid(KStringCreateValidated("0123456789abc\xFF", 14)));
+    KString Created = KStringCreateValidated(Text, sizeof(Text) - 1);
+    KS_CHECK(true == KStringIsValidatedUtf8(Created) && true == KStringEquals(Created, Long));
+
+    // Other encodings are never validated UTF-8
+    KString Ansi = KStringCreateWithEncoding(Text, sizeof(Text) - 1, KSTRING_ENCODING_ANSI);
+    KS_CHECK(false == KStringValidateUtf8(&Ansi) && false == KStringIsValidatedUtf8(Ansi));
+
+    KStringDestroy(Ansi);
+    KStringDestroy(Created);
+    KStringDestroy(Joined);
+    KStringDestroy(Long);
+}
+
+int main(void)
+{
+    KS_TestSequences();
+    KS_TestState();
+    return KS_TEST_RESULT();
+}
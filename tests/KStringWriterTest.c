@@ -0,0 +1,124 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "KStringTest.h"
+#include <stdlib.h>
+
+//
+// Streaming writer known answers: chunked writes, inline and regular results, and a large string
+// beyond the 30-bit Size field (skipped when 1 GiB cannot be allocated)
+//
+
+#define KS_TEST_CHUNK_SIZE ((size_t)1 << 20)
+
+static void KS_TestRegular(void)
+{
+    KStringWriter Writer;
+    KS_CHECK(true == KStringWriterBegin(&Writer, KSTRING_ENCODING_UTF8, 0));
+    KS_CHECK(true == KStringWriterWrite(&Writer, "short", 5));
+    KString Short = KStringWriterFinish(&Writer);
+    KS_CHECK(true == KStringIsShort(Short) && true == KS_TestBytesEqual(Short, "short", 5));
+    KS_CHECK(NULL == Writer.pBlock && 0 == Writer.Size);
+
+    // Chunks of every size up to 40 bytes, the payload is moved to the start of the block
+    char   Expected[820];
+    size_t Size = 0;
+    KS_CHECK(true == KStringWriterBegin(&Writer, KSTRING_ENCODING_ANSI, 16));
+    for (size_t Chunk = 1; Chunk <= 40; ++Chunk)
+    {
+        char Buffer[40];
+        memset(Buffer, (int)('a' + Chunk % 26), Chunk);
+        memcpy(Expected + Size, Buffer, Chunk);
+        Size += Chunk;
+        KS_CHECK(true == KStringWriterWrite(&Writer, Buffer, Chunk));
+    }
+
+    KString Long = KStringWriterFinish(&Writer);
+    KS_CHECK(false == KStringIsLarge(Long) && KSTRING_ENCODING_ANSI == KStringGetEncoding(Long) && Size == KStringSize(Long));
+    KS_CHECK(NULL != KStringCStr(Long) && 0 == memcmp(KStringCStr(Long), Expected, Size) && '\0' == KStringCStr(Long)[Size]);
+    KStringDestroy(Long);
+
+    // Abort discards everything
+    KS_CHECK(true == KStringWriterBegin(&Writer, KSTRING_ENCODING_UTF8, 0));
+    KS_CHECK(true == KStringWriterWrite(&Writer, Expected, Size));
+    KStringWriterAbort(&Writer);
+    KS_CHECK(NULL == Writer.pBlock && 0 == Writer.Size);
+}
+
+static void KS_TestLarge(void)
+{
+    // Just beyond the Size field: 1 GiB in 1 MiB chunks of a repeating byte pattern
+    size_t        Total  = (size_t)KSTRING_LARGE_SIZE + KS_TEST_CHUNK_SIZE - (size_t)KSTRING_LARGE_SIZE % KS_TEST_CHUNK_SIZE;
+    char*         pChunk = malloc(KS_TEST_CHUNK_SIZE);
+    KStringWriter Writer;
+    if (NULL == pChunk || false == KStringWriterBegin(&Writer, KSTRING_ENCODING_UTF8, Total))
+    {
+        fprintf(stderr, "skipped: cannot reserve %zu bytes\n", Total);
+        free(pChunk);
+        return;
+    }
+
+    for (size_t i = 0; i < KS_TEST_CHUNK_SIZE; ++i)
+    {
+        pChunk[i] = (char)('A' + i % 23);
+    }
+
+    bool Written = true;
+    for (size_t Offset = 0; Offset < Total; Offset += KS_TEST_CHUNK_SIZE)
+    {
+        Written = Written && KStringWriterWrite(&Writer, pChunk, KS_TEST_CHUNK_SIZE);
+    }
+    KS_CHECK(true == Written);
+
+    KString Large = KStringWriterFinish(&Writer);
+    KS_CHECK(true == KStringIsLarge(Large) && Total == KStringSize(Large));
+
+    // Byte access, chunk walks and copies see the same pattern at both ends
+    size_t      Size  = 0;
+    const char* pData = KStringData(&Large, &Size);
+    KS_CHECK(NULL != pData && Total == Size && '\0' == pData[Size]);
+    KS_CHECK('A' == KStringByteAt(Large, 0) && 'A' + (int)((Total - 1) % KS_TEST_CHUNK_SIZE % 23) == KStringByteAt(Large, Total - 1));
+
+    char Tail[8];
+    KS_CHECK(sizeof(Tail) == KStringCopyTo(Large, Total - sizeof(Tail), Tail, sizeof(Tail)));
+    KS_CHECK(0 == memcmp(Tail, pChunk + KS_TEST_CHUNK_SIZE - sizeof(Tail), sizeof(Tail)));
+
+    // Slices of a large string are regular strings
+    KString Slice = KStringSubstring(Large, Total - 20, 20);
+    KS_CHECK(false == KStringIsLarge(Slice) && true == KS_TestBytesEqual(Slice, pChunk + KS_TEST_CHUNK_SIZE - 20, 20));
+    KS_CHECK(true == KStringEquals(Large, Large));
+
+    KStringDestroy(Slice);
+    KStringDestroy(Large);
+    free(pChunk);
+}
+
+int main(void)
+{
+    KS_TestRegular();
+    KS_TestLarge();
+    return KS_TEST_RESULT();
+}
@@ -0,0 +1,234 @@
+#!/usr/bin/env python3
+#
+# Generates src/KStringUnicodeData.h from the Unicode Character Database bundled with Python
+# (unicodedata). Run from the repository root: python3 tools/GenerateUnicodeTables.py
+#
+# Mappings are stored as three-stage tables of deltas:
+#   Delta = Deltas[Stage3[Stage2[Stage1[CodePoint >> 9] * 32 + ((CodePoint >> 4) & 31)] * 16 + (CodePoint & 15)]]
+# Code points at or above the table limit map to themselves.
+#
+
+import sys
+import unicodedata
+
+LICENSE_BANNER = """//////////////////////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright (c) 2025 Heiko Panjas
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+
+"""
+
+STAGE2_SIZE = 32
+STAGE3_SIZE = 16
+
+
+def simple_case_fold(code_point):
+    # CaseFolding.txt status C and S: the single-character full folding, else the single-character lowercase
+    char   = chr(code_point)
+    folded = char.casefold()
+    if 1 == len(folded):
+        return ord(folded)
+    lower = char.lower()
+    return ord(lower) if 1 == len(lower) else code_point
+
+
+def simple_lowercase(code_point):
+    # UnicodeData.txt simple lowercase: single-character lower(); U+0130 only has a two-character full mapping
+    lower = chr(code_point).lower()
+    if 1 == len(lower):
+        return ord(lower)
+    return 0x69 if 0x130 == code_point else code_point
+
+
+def simple_uppercase(code_point):
+    # UnicodeData.txt simple uppercase: single-character upper(), else the single-character titlecase
+    # (U+1F80 etc. uppercase to two characters but have a one-character simple mapping equal to their titlecase)
+    char  = chr(code_point)
+    upper = char.upper()
+    if 1 == len(upper):
+        return ord(upper)
+    title = char.title()
+    return ord(title) if 1 == len(title) else code_point
+
+
+def build_mapping(function):
+    return {cp: function(cp) for cp in range(0x110000) if not 0xD800 <= cp < 0xE000 and function(cp) != cp}
+
+
+def emit_array(out, ctype, array_name, values, per_line):
+    out.write(f"static const {ctype} {array_name}[{len(values)}] = {{\n")
+    for i in range(0, len(values), per_line):
+        out.write("    " + ", ".join(str(v) for v in values[i:i + per_line]) + ",\n")
+    out.write("};\n\n")
+
+
+def emit_stage_table(out, name, mapping, values_name, values_ctype, values_per_line):
+    # Stage3 holds indices into a list of distinct values, index 0 is the default value 0
+    block = STAGE2_SIZE * STAGE3_SIZE
+    limit = (max(mapping) // block + 1) * block
+
+    values      = [0] + sorted(set(mapping.values()) - {0})
+    value_index = {value: i for i, value in enumerate(values)}
+
+    stage3_blocks = {}
+    stage2        = []
+    for start in range(0, limit, STAGE3_SIZE):
+        entries = tuple(value_index[mapping.get(cp, 0)] for cp in range(start, start + STAGE3_SIZE))
+        stage2.append(stage3_blocks.setdefault(entries, len(stage3_blocks)))
+
+    stage2_blocks = {}
+    stage1        = []
+    for start in range(0, len(stage2), STAGE2_SIZE):
+        entries = tuple(stage2[start:start + STAGE2_SIZE])
+        stage1.append(stage2_blocks.setdefault(entries, len(stage2_blocks)))
+
+    assert len(values) < 256 and len(stage3_blocks) < 256 and len(stage2_blocks) < 256
+
+    out.write(f"#define KSTRING_{name.upper()}_LIMIT 0x{limit:X}\n\n")
+    emit_array(out, "uint8_t", f"KS_{name}Stage1", stage1, 32)
+    emit_array(out, "uint8_t", f"KS_{name}Stage2", [v for entries in stage2_blocks for v in entries], 32)
+    emit_array(out, "uint8_t", f"KS_{name}Stage3", [v for entries in stage3_blocks for v in entries], 32)
+    emit_array(out, values_ctype, f"KS_{name}{values_name}", values, values_per_line)
+
+
+def emit_delta_table(out, name, mapping):
+    emit_stage_table(out, name, {source: target - source for source, target in mapping.items()}, "Deltas", "int32_t", 12)
+
+
+# Normalization property bits above the 8-bit canonical combining class
+NFD_QC_NO    = 0x100
+NFC_QC_NO    = 0x200
+NFC_QC_MAYBE = 0x400
+
+HANGUL_FIRST = 0xAC00
+HANGUL_LAST  = 0xD7A3
+
+
+def canonical_decomposition(code_point):
+    # Immediate canonical mapping (compatibility mappings are tagged with <...>)
+    fields = unicodedata.decomposition(chr(code_point)).split()
+    if not fields or fields[0].startswith("<"):
+        return []
+    return [int(field, 16) for field in fields]
+
+
+def is_scalar(code_point):
+    return not 0xD800 <= code_point < 0xE000
+
+
+def emit_normalization_tables(out):
+    # Hangul syllables are decomposed and composed algorithmically and are left out of the tables
+    scalars = [cp for cp in range(0x110000) if is_scalar(cp)]
+
+    decompositions = {}
+    compositions   = {}
+    for cp in scalars:
+        if HANGUL_FIRST <= cp <= HANGUL_LAST:
+            continue
+        nfd = unicodedata.normalize("NFD", chr(cp))
+        if nfd != chr(cp):
+            decompositions[cp] = [ord(c) for c in nfd]
+        mapping = canonical_decomposition(cp)
+        if 2 == len(mapping) and unicodedata.normalize("NFC", chr(cp)) == chr(cp):
+            compositions[(mapping[0], mapping[1])] = cp
+
+    # NFC_QC=Maybe: characters that can combine with a preceding character (second of a primary composite, Hangul V and T jamo)
+    maybe = {second for _, second in compositions} | set(range(0x1161, 0x1176)) | set(range(0x11A8, 0x11C3))
+
+    properties = {}
+    for cp in scalars:
+        char  = chr(cp)
+        value = unicodedata.combining(char)
+        if unicodedata.normalize("NFD", char) != char:
+            value |= NFD_QC_NO
+        if unicodedata.normalize("NFC", char) != char:
+            value |= NFC_QC_NO
+        elif cp in maybe:
+            value |= NFC_QC_MAYBE
+        if 0 != value:
+            properties[cp] = value
+
+    # Code points below the quick limits need no lookup (rounded down to a UTF-8 lead byte boundary)
+    def quick_limit(flags):
+        first = min(cp for cp, value in properties.items() if value & (0xFF | flags))
+        assert first < 0x800
+        return first & ~63
+
+    out.write(f"#define KSTRING_NFC_QUICK_LIMIT 0x{quick_limit(NFC_QC_NO | NFC_QC_MAYBE):X}\n")
+    out.write(f"#define KSTRING_NFD_QUICK_LIMIT 0x{quick_limit(NFD_QC_NO):X}\n\n")
+
+    out.write(f"#define KSTRING_NFD_QC_NO    0x{NFD_QC_NO:X}\n")
+    out.write(f"#define KSTRING_NFC_QC_NO    0x{NFC_QC_NO:X}\n")
+    out.write(f"#define KSTRING_NFC_QC_MAYBE 0x{NFC_QC_MAYBE:X}\n\n")
+    emit_stage_table(out, "Normalization", properties, "Properties", "uint16_t", 16)
+
+    # Full canonical decompositions, sorted by code point (binary search)
+    keys    = sorted(decompositions)
+    offsets = [0]
+    data    = []
+    for cp in keys:
+        data.extend(decompositions[cp])
+        offsets.append(len(data))
+    assert len(data) < 0x10000
+
+    out.write(f"#define KSTRING_DECOMPOSITION_MAX_LENGTH {max(len(d) for d in decompositions.values())}\n\n")
+    emit_array(out, "uint32_t", "KS_DecompositionCodePoints", keys, 12)
+    emit_array(out, "uint16_t", "KS_DecompositionOffsets", offsets, 16)
+    emit_array(out, "uint32_t", "KS_DecompositionData", data, 12)
+
+    # Primary composites by pair (First << 21 | Second), sorted (binary search)
+    pairs = sorted(compositions)
+    emit_array(out, "uint64_t", "KS_CompositionPairs", [f"0x{(first << 21) | second:X}ULL" for first, second in pairs], 6)
+    emit_array(out, "uint32_t", "KS_CompositionResults", [compositions[pair] for pair in pairs], 12)
+
+
+def main():
+    path = sys.argv[1] if len(sys.argv) > 1 else "src/KStringUnicodeData.h"
+    with open(path, "w", newline="\n") as out:
+        out.write(LICENSE_BANNER)
+        out.write(f"// Generated by tools/GenerateUnicodeTables.py from Unicode {unicodedata.unidata_version}, do not edit\n\n")
+        out.write("#ifndef KSTRING_UNICODE_DATA_H\n#define KSTRING_UNICODE_DATA_H\n\n#include <stdint.h>\n\n")
+
+        out.write("//\n// Simple Case Folding (CaseFolding.txt status C and S)\n//\n\n")
+        emit_delta_table(out, "CaseFold", build_mapping(simple_case_fold))
+
+        # Case conversion relies on no mapping crossing the BMP boundary (UTF-16 sizes never change)
+        lowercase = build_mapping(simple_lowercase)
+        uppercase = build_mapping(simple_uppercase)
+        for mapping in (lowercase, uppercase):
+            assert all((source < 0x10000) == (target < 0x10000) for source, target in mapping.items())
+
+        out.write("//\n// Simple Case Mapping (UnicodeData.txt simple lowercase and uppercase)\n//\n\n")
+        emit_delta_table(out, "LowerCase", lowercase)
+        emit_delta_table(out, "UpperCase", uppercase)
+
+        out.write("//\n// Canonical Normalization (combining classes, NFC/NFD quick check, decompositions and compositions)\n//\n\n")
+        emit_normalization_tables(out)
+
+        out.write("#endif // KSTRING_UNICODE_DATA_H\n")
+
+
+if __name__ == "__main__":
+    main()